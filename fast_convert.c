@@ -11,6 +11,10 @@
 #include <ctype.h>
 #include <math.h>
 #include <locale.h>
+#include <float.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
 #include "fast_convert.h"
 
 #ifndef __WORDSIZE
@@ -20,17 +24,81 @@
 #ifdef __GNUC__
 #define LIKELY(x)               __builtin_expect ((x), 1)
 #define UNLIKELY(x)             __builtin_expect ((x), 0)
+#define ALWAYS_INLINE           inline __attribute__((always_inline))
 #else
 #define LIKELY(x)               (x)
 #define UNLIKELY(x)             (x)
+#define ALWAYS_INLINE           inline
 #endif
 
-#define	DO_BASE(b) case b: do { *--p = d[u % b]; u /= b; } while (u); break
-
 #ifdef __attribute__
 #undef __attribute__
 #endif
 
+/* x87 80 bit long double. fast_ldtoa/fast_strtold need 128 bit integers */
+#if defined (__SIZEOF_INT128__) && LDBL_MANT_DIG == 64
+#define	LDBL_X87	1
+#endif
+
+/* __float128: fast_qtoa/fast_strtoq need 128 bit integers */
+#if defined (__SIZEOF_FLOAT128__) && defined (__SIZEOF_INT128__)
+#define	FLOAT128	1
+#endif
+
+/* AVX2 code of fast_infer_column_type and fast_scan_numbers, selected
+   at run time */
+#if defined (__GNUC__) && (defined (__x86_64__) || defined (__i386__))
+#include <immintrin.h>
+#define	X86_AVX2	1
+#endif
+
+#ifdef FAST_CONVERT_STATS
+#include <pthread.h>
+
+/* Counters are per thread so the hot paths only do a plain increment.
+ * Each thread links its counters in a list on first use. When a thread
+ * exits its counters are added to stats_retired. */
+struct stats_thread
+{
+  struct fast_convert_stats s;
+  struct stats_thread *next;
+  struct stats_thread *prev;
+  int registered;
+};
+
+static __thread struct stats_thread stats_thread;
+static struct stats_thread stats_list = { {0}, &stats_list, &stats_list, 1 };
+static struct fast_convert_stats stats_retired;
+static pthread_mutex_t stats_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_key_t stats_key;
+
+static void stats_register (void);
+
+#define	STAT_INC(x)	do { if (UNLIKELY (!stats_thread.registered)) { \
+			       stats_register (); } stats_thread.s.x++; \
+			} while (0)
+#else
+#define	STAT_INC(x)
+#endif
+
+/* Power table entries for double (96 bit) and float (64 bit). With
+   FAST_CONVERT_COMPACT_TABLES the tables below are not compiled and
+   the entries are calculated from cpowers10 (see compact_pow10).
+   With FAST_CONVERT_SHARED_TABLES only the float tables are left out
+   and calculated from dpowers10 (see shared_fpowers2). */
+struct dpower
+{
+  uint64_t mul1;
+  uint32_t mul2;
+  int32_t exp;
+};
+
+struct fpower
+{
+  uint64_t mul;
+  int32_t exp;
+};
+
 #if 0
 /* gcc -g -O3 -Wall a.c -o a -lmpfr -lgmp */
 #include <stdio.h>
@@ -69,12 +137,7 @@ main (void)
   mpfr_ui_pow_ui (p32, 2, 32, MPFR_RNDN);
   mpfr_ui_pow_ui (p24, 2, 24, MPFR_RNDN);
 
-  printf ("static const struct\n");
-  printf ("{\n");
-  printf ("  uint64_t mul1;\n");
-  printf ("  uint32_t mul2;\n");
-  printf ("  int32_t exp;\n");
-  printf ("} dpowers2[] = {\n");
+  printf ("static const struct dpower dpowers2[] = {\n");
   for (i = -1022 - 53 + 64 - 11 - 54; i <= 1025 - 53 + 64 - 11; i++) {
     /* t1 = powl (2.0, i); */
     mpfr_set_ui (t3, 2, MPFR_RNDN);
@@ -151,11 +214,7 @@ main (void)
     }
   }
   printf ("};\n\n");
-  printf ("static const struct\n");
-  printf ("{\n");
-  printf ("  uint64_t mul;\n");
-  printf ("  int32_t exp;\n");
-  printf ("} fpowers2[] = {\n");
+  printf ("static const struct fpower fpowers2[] = {\n");
   for (i = -126 - 24 + 32 - 8 - 25; i <= 129 - 24 + 32 - 8; i++) {
     /* t1 = powl (2.0, i); */
     mpfr_set_ui (t3, 2, MPFR_RNDN);
@@ -233,12 +292,8 @@ main (void)
 }
 #endif
 
-static const struct
-{
-  uint64_t mul1;
-  uint32_t mul2;
-  int32_t exp;
-} dpowers2[] = {
+#ifndef FAST_CONVERT_COMPACT_TABLES
+static const struct dpower dpowers2[] = {
   { /* -1076 */ UINT64_C (0xAB69D82E364948D4), 0x6A0A4F6C, -343},
   { /* -1075 */ UINT64_C (0x22485E6FA4750E90), 0xE2020FE2, -342},
   { /* -1074 */ UINT64_C (0x4490BCDF48EA1D21), 0xC4041FC5, -342},
@@ -2343,11 +2398,8 @@ static const struct
   { /*  1025 */ UINT64_C (0x31E560C35D40E307), 0x75677D6E, 290},
 };
 
-static const struct
-{
-  uint64_t mul;
-  int32_t exp;
-} fpowers2[] = {
+#ifndef FAST_CONVERT_SHARED_TABLES
+static const struct fpower fpowers2[] = {
   { /*  -151 */ UINT64_C (0x5190F96B91344AE4), -57},
   { /*  -150 */ UINT64_C (0xA321F2D7226895C8), -57},
   { /*  -149 */ UINT64_C (0x20A063C4A07B5128), -56},
@@ -2630,6 +2682,8 @@ static const struct
   { /*   128 */ UINT64_C (0x4F3A68DBC8F03F24), 27},
   { /*   129 */ UINT64_C (0x9E74D1B791E07E48), 27},
 };
+#endif
+#endif
 
 #if 0
 /* gcc -g -O3 -Wall b.c -o b -lmpfr -lgmp */
@@ -2664,12 +2718,7 @@ main (void)
   mpfr_ui_pow_ui (p64, 2, 64, MPFR_RNDN);
   mpfr_ui_pow_ui (p32, 2, 32, MPFR_RNDN);
 
-  printf ("static const struct\n");
-  printf ("{\n");
-  printf ("  uint64_t mul1;\n");
-  printf ("  uint32_t mul2;\n");
-  printf ("  int32_t exp;\n");
-  printf ("} dpowers10[] = {\n");
+  printf ("static const struct dpower dpowers10[] = {\n");
   for (i = -362; i <= 309; i++) {
     /* t1 = powl (10.0, i); */
     mpfr_set_ui (t3, 10, MPFR_RNDN);
@@ -2752,11 +2801,7 @@ main (void)
     }
   }
   printf ("};\n\n");
-  printf ("static const struct\n");
-  printf ("{\n");
-  printf ("  uint64_t mul;\n");
-  printf ("  int32_t exp;\n");
-  printf ("} fpowers10[] = {\n");
+  printf ("static const struct fpower fpowers10[] = {\n");
   for (i = -64; i <= 39; i++) {
     /* t1 = powl (10.0, i); */
     mpfr_set_ui (t3, 10, MPFR_RNDN);
@@ -2852,12 +2897,8 @@ main (void)
 }
 #endif
 
-static const struct
-{
-  uint64_t mul1;
-  uint32_t mul2;
-  int32_t exp;
-} dpowers10[] = {
+#ifndef FAST_CONVERT_COMPACT_TABLES
+static const struct dpower dpowers10[] = {
   { /*  -362 */ UINT64_C (0xB05135F614BB847D), 0x8DA339E8, -1266},
   { /*  -361 */ UINT64_C (0xDC65837399EA659C), 0xF10C0861, -1263},
   { /*  -360 */ UINT64_C (0x89BF722840327F82), 0x16A7853D, -1259},
@@ -3532,11 +3573,8 @@ static const struct
   { /*   309 */ UINT64_C (0xB201833B35D63F73), 0x2CD2CC65, 963},
 };
 
-static const struct
-{
-  uint64_t mul;
-  int32_t exp;
-} fpowers10[] = {
+#ifndef FAST_CONVERT_SHARED_TABLES
+static const struct fpower fpowers10[] = {
   { /*   -64 */ UINT64_C (0xA87FEA27A539E9A5), -244},
   { /*   -63 */ UINT64_C (0xD29FE4B18E88640F), -241},
   { /*   -62 */ UINT64_C (0x83A3EEEEF9153E89), -237},
@@ -3642,6 +3680,1846 @@ static const struct
   { /*    38 */ UINT64_C (0x96769950B50D88F4), 95},
   { /*    39 */ UINT64_C (0xBC143FA4E250EB31), 98},
 };
+#endif
+#else
+#if 0
+/* gcc -g -O3 -Wall c.c -o c -lmpfr -lgmp */
+#include <stdio.h>
+#include <mpfr.h>
+
+int
+main (void)
+{
+  int i;
+  long exp;
+  mpfr_t t;
+  mpz_t z;
+  mpz_t h;
+
+  mpfr_init2 (t, 128);
+  mpz_init (z);
+  mpz_init (h);
+  printf ("static const struct\n");
+  printf ("{\n");
+  printf ("  uint64_t mul1;\n");
+  printf ("  uint64_t mul2;\n");
+  printf ("  int32_t exp;\n");
+  printf ("} cpowers10[] = {\n");
+  for (i = -19; i <= 17; i++) {
+    /* t = 10^(20 * i) rounded to 128 bits */
+    mpfr_set_ui (t, 10, MPFR_RNDN);
+    mpfr_pow_si (t, t, i * 20, MPFR_RNDN);
+    exp = mpfr_get_exp (t) - 128;
+    mpfr_mul_2si (t, t, -exp, MPFR_RNDN);
+    mpfr_get_z (z, t, MPFR_RNDN);
+    mpz_tdiv_q_2exp (h, z, 64);
+    printf ("  { /* %5d */ UINT64_C (0x%016lX),\n", i * 20, mpz_get_ui (h));
+    mpz_tdiv_r_2exp (h, z, 64);
+    printf ("    UINT64_C (0x%016lX), %6ld},\n", mpz_get_ui (h), exp);
+  }
+  printf ("};\n");
+  mpz_clear (h);
+  mpz_clear (z);
+  mpfr_clear (t);
+  mpfr_free_cache ();
+  return 0;
+}
+#endif
+
+static const struct
+{
+  uint64_t mul1;
+  uint64_t mul2;
+  int32_t exp;
+} cpowers10[] = {
+  { /*  -380 */ UINT64_C (0xCB47A9358C317FAE),
+    UINT64_C (0xDA9018CFCC9BE08A),  -1390},
+  { /*  -360 */ UINT64_C (0x89BF722840327F82),
+    UINT64_C (0x16A7853CE21F945F),  -1323},
+  { /*  -340 */ UINT64_C (0xBAAEE17FA23EBF76),
+    UINT64_C (0x5D79BCF00D2DF64A),  -1257},
+  { /*  -320 */ UINT64_C (0xFD00B897478238D0),
+    UINT64_C (0x8920B098955522B5),  -1191},
+  { /*  -300 */ UINT64_C (0xAB70FE17C79AC6CA),
+    UINT64_C (0x6DBD630A48AAF407),  -1124},
+  { /*  -280 */ UINT64_C (0xE858AD248F5C22C9),
+    UINT64_C (0xD1B3400F8F9CFF69),  -1058},
+  { /*  -260 */ UINT64_C (0x9D71AC8FADA6C9B5),
+    UINT64_C (0x6F773FC3603DB4A9),   -991},
+  { /*  -240 */ UINT64_C (0xD5605FCDCF32E1D6),
+    UINT64_C (0xFB1E4A9A90880A65),   -925},
+  { /*  -220 */ UINT64_C (0x9096EA6F3848984F),
+    UINT64_C (0x3FF0D2C85DEF7622),   -858},
+  { /*  -200 */ UINT64_C (0xC3F490AA77BD60FC),
+    UINT64_C (0xBEDBFC4411068A9D),   -792},
+  { /*  -180 */ UINT64_C (0x84C8D4DFD2C63F3B),
+    UINT64_C (0x29ECD9F40041E073),   -725},
+  { /*  -160 */ UINT64_C (0xB3F4E093DB73A093),
+    UINT64_C (0x59ED216765690F57),   -659},
+  { /*  -140 */ UINT64_C (0xF3E2F893DEC3F126),
+    UINT64_C (0x5A89DBA3C3EFCCFB),   -593},
+  { /*  -120 */ UINT64_C (0xA54394FE1EEDB8FE),
+    UINT64_C (0xC2974EB4EE658829),   -526},
+  { /*  -100 */ UINT64_C (0xDFF9772470297EBD),
+    UINT64_C (0x59787E2B93BC56F7),   -460},
+  { /*   -80 */ UINT64_C (0x97C560BA6B0919A5),
+    UINT64_C (0xDCCD879FC967D41A),   -393},
+  { /*   -60 */ UINT64_C (0xCDB02555653131B6),
+    UINT64_C (0x3792F412CB06794D),   -327},
+  { /*   -40 */ UINT64_C (0x8B61313BBABCE2C6),
+    UINT64_C (0x2323AC4B3B3DA015),   -260},
+  { /*   -20 */ UINT64_C (0xBCE5086492111AEA),
+    UINT64_C (0x88F4BB1CA6BCF584),   -194},
+  { /*     0 */ UINT64_C (0x8000000000000000),
+    UINT64_C (0x0000000000000000),   -127},
+  { /*    20 */ UINT64_C (0xAD78EBC5AC620000),
+    UINT64_C (0x0000000000000000),    -61},
+  { /*    40 */ UINT64_C (0xEB194F8E1AE525FD),
+    UINT64_C (0x5DCFAB0800000000),      5},
+  { /*    60 */ UINT64_C (0x9F4F2726179A2245),
+    UINT64_C (0x01D762422C946591),     72},
+  { /*    80 */ UINT64_C (0xD7E77A8F87DAF7FB),
+    UINT64_C (0xDC33745EC97BE906),    138},
+  { /*   100 */ UINT64_C (0x924D692CA61BE758),
+    UINT64_C (0x593C2626705F9C56),    205},
+  { /*   120 */ UINT64_C (0xC646D63501A1511D),
+    UINT64_C (0xB281E1FD541501B9),    271},
+  { /*   140 */ UINT64_C (0x865B86925B9BC5C2),
+    UINT64_C (0x0B8A2392BA45A9B2),    338},
+  { /*   160 */ UINT64_C (0xB616A12B7FE617AA),
+    UINT64_C (0x577B986B314D6009),    404},
+  { /*   180 */ UINT64_C (0xF6C69A72A3989F5B),
+    UINT64_C (0x8AAD549E57273D45),    470},
+  { /*   200 */ UINT64_C (0xA738C6BEBB12D16C),
+    UINT64_C (0xB428F8AC016561DB),    537},
+  { /*   220 */ UINT64_C (0xE2A0B5DC971F303A),
+    UINT64_C (0x2E44AE64840FD61E),    603},
+  { /*   240 */ UINT64_C (0x9991A6F3D6BF1765),
+    UINT64_C (0xACCA6DA1E0A8EF29),    670},
+  { /*   260 */ UINT64_C (0xD01FEF10A657842C),
+    UINT64_C (0x2D2B7569B0432D85),    736},
+  { /*   280 */ UINT64_C (0x8D07E33455637EB2),
+    UINT64_C (0xDB0B487B6423E1E8),    803},
+  { /*   300 */ UINT64_C (0xBF21E44003ACDD2C),
+    UINT64_C (0xE0470A63E6BD56C3),    869},
+  { /*   320 */ UINT64_C (0x81842F29F2CCE375),
+    UINT64_C (0xE6A1158300D46640),    936},
+  { /*   340 */ UINT64_C (0xAF87023B9BF0EE6A),
+    UINT64_C (0xEB8FAD7C7F8680B4),   1002},
+};
+#endif
+
+#ifdef LDBL_X87
+#if 0
+/* gcc -g -O3 -Wall l.c -o l -lmpfr -lgmp */
+#include <stdio.h>
+#include <mpfr.h>
+
+static void
+print_power (int i)
+{
+  long exp;
+  mpfr_t t;
+  mpz_t z;
+  mpz_t h;
+
+  mpfr_init2 (t, 128);
+  mpz_init (z);
+  mpz_init (h);
+  /* t = 10^i rounded to 128 bits */
+  mpfr_set_ui (t, 10, MPFR_RNDN);
+  mpfr_pow_si (t, t, i, MPFR_RNDN);
+  exp = mpfr_get_exp (t) - 128;
+  mpfr_mul_2si (t, t, -exp, MPFR_RNDN);
+  mpfr_get_z (z, t, MPFR_RNDN);
+  mpz_tdiv_q_2exp (h, z, 64);
+  printf ("  { /* %5d */ UINT64_C (0x%016lX),\n", i, mpz_get_ui (h));
+  mpz_tdiv_r_2exp (h, z, 64);
+  printf ("    UINT64_C (0x%016lX), %6ld},\n", mpz_get_ui (h), exp);
+  mpz_clear (h);
+  mpz_clear (z);
+  mpfr_clear (t);
+}
+
+static void
+print_header (const char *name)
+{
+  printf ("static const struct\n");
+  printf ("{\n");
+  printf ("  uint64_t mul1;\n");
+  printf ("  uint64_t mul2;\n");
+  printf ("  int32_t exp;\n");
+  printf ("} %s[] = {\n", name);
+}
+
+int
+main (void)
+{
+  int i;
+
+  print_header ("ldpowers10");
+  for (i = -179; i <= 178; i++) {
+    print_power (i * 28);
+  }
+  printf ("};\n\n");
+  print_header ("ldpowers10_28");
+  for (i = 0; i < 28; i++) {
+    print_power (i);
+  }
+  printf ("};\n");
+  mpfr_free_cache ();
+  return 0;
+}
+#endif
+
+static const struct
+{
+  uint64_t mul1;
+  uint64_t mul2;
+  int32_t exp;
+} ldpowers10[] = {
+  { /* -5012 */ UINT64_C (0xB491165AC6B0AD76),
+    UINT64_C (0x6DE87D653E43DF31), -16777},
+  { /* -4984 */ UINT64_C (0xB6536903BF8F2BDA),
+    UINT64_C (0x2B55C9E70E00C558), -16684},
+  { /* -4956 */ UINT64_C (0xB81A1EC0EBF12AF1),
+    UINT64_C (0xBAD933E1F4E65074), -16591},
+  { /* -4928 */ UINT64_C (0xB9E5428330737362),
+    UINT64_C (0xBDDB2DFDE3F8A6E3), -16498},
+  { /* -4900 */ UINT64_C (0xBBB4DF56BAF62972),
+    UINT64_C (0x692AA2588216D185), -16405},
+  { /* -4872 */ UINT64_C (0xBD89006346A9A34D),
+    UINT64_C (0x88227FDFC13AB53E), -16312},
+  { /* -4844 */ UINT64_C (0xBF61B0EC60C4F5DC),
+    UINT64_C (0x8EE3A73EE750B832), -16219},
+  { /* -4816 */ UINT64_C (0xC13EFC51ADE7DF64),
+    UINT64_C (0xE05FE4207CA3D508), -16126},
+  { /* -4788 */ UINT64_C (0xC320EE0F3029BB57),
+    UINT64_C (0xFF5733244E3B6BAA), -16033},
+  { /* -4760 */ UINT64_C (0xC50791BD8DD72EDB),
+    UINT64_C (0x3C55F3F947FEF0E9), -15940},
+  { /* -4732 */ UINT64_C (0xC6F2F31258E041C6),
+    UINT64_C (0xAFDE347F46FDB9E0), -15847},
+  { /* -4704 */ UINT64_C (0xC8E31DE056F89C19),
+    UINT64_C (0x0915564D8AB057EE), -15754},
+  { /* -4676 */ UINT64_C (0xCAD81E17CA6BA427),
+    UINT64_C (0x08B7D94AF9C24E41), -15661},
+  { /* -4648 */ UINT64_C (0xCCD1FFC6BBA63E21),
+    UINT64_C (0x801E38463183FC89), -15568},
+  { /* -4620 */ UINT64_C (0xCED0CF194377F1EB),
+    UINT64_C (0x77707CAB526FA3EC), -15475},
+  { /* -4592 */ UINT64_C (0xD0D49859D60D40A3),
+    UINT64_C (0xCFADF6B2AA7C4F44), -15382},
+  { /* -4564 */ UINT64_C (0xD2DD67F18EA4F7BA),
+    UINT64_C (0x6819FCBC5DBA0576), -15289},
+  { /* -4536 */ UINT64_C (0xD4EB4A687C0253E8),
+    UINT64_C (0x9E601E707A2C3488), -15196},
+  { /* -4508 */ UINT64_C (0xD6FE4C65ED9DCAF0),
+    UINT64_C (0x0910B187A046B5A5), -15103},
+  { /* -4480 */ UINT64_C (0xD9167AB0C1965798),
+    UINT64_C (0xA8EDFFDCCFE4DB4C), -15010},
+  { /* -4452 */ UINT64_C (0xDB33E22FB3652809),
+    UINT64_C (0x9B246C227911DB44), -14917},
+  { /* -4424 */ UINT64_C (0xDD568FE9AB559344),
+    UINT64_C (0xB17CD86E7FCECE75), -14824},
+  { /* -4396 */ UINT64_C (0xDF7E91060EC33F46),
+    UINT64_C (0x5AAFDC42CA320902), -14731},
+  { /* -4368 */ UINT64_C (0xE1ABF2CD11206610),
+    UINT64_C (0x1151250681D59706), -14638},
+  { /* -4340 */ UINT64_C (0xE3DEC2A805C62CB4),
+    UINT64_C (0x38B47F50C3E497A0), -14545},
+  { /* -4312 */ UINT64_C (0xE6170E21B2910457),
+    UINT64_C (0x025A8E1E5DBB41D6), -14452},
+  { /* -4284 */ UINT64_C (0xE854E2E6A34B1200),
+    UINT64_C (0xC9D524DFDFE4E2D9), -14359},
+  { /* -4256 */ UINT64_C (0xEA984EC57DE69F13),
+    UINT64_C (0x66E849253E5DA0C2), -14266},
+  { /* -4228 */ UINT64_C (0xECE15FAF578A9935),
+    UINT64_C (0x647E32D3C54DF9DE), -14173},
+  { /* -4200 */ UINT64_C (0xEF3023B80A732D93),
+    UINT64_C (0xF5A7800F23EF67B8), -14080},
+  { /* -4172 */ UINT64_C (0xF184A9168CA89077),
+    UINT64_C (0x07776B7971F752FE), -13987},
+  { /* -4144 */ UINT64_C (0xF3DEFE25478E074A),
+    UINT64_C (0x0E85FC7F4EDBD3CB), -13894},
+  { /* -4116 */ UINT64_C (0xF63F3162704B5070),
+    UINT64_C (0x48FE1D3430B5E548), -13801},
+  { /* -4088 */ UINT64_C (0xF8A551706112897C),
+    UINT64_C (0x4268A54F70BD28C5), -13708},
+  { /* -4060 */ UINT64_C (0xFB116D15F344B9B0),
+    UINT64_C (0x953D136B9A19CDB5), -13615},
+  { /* -4032 */ UINT64_C (0xFD83933EDA772C0B),
+    UINT64_C (0x5052E9289F0F2333), -13522},
+  { /* -4004 */ UINT64_C (0xFFFBD2FC005BC986),
+    UINT64_C (0x2C9AF917DDC988C9), -13429},
+  { /* -3976 */ UINT64_C (0x813D1DC1F0C754D6),
+    UINT64_C (0x01B02378A405B421), -13335},
+  { /* -3948 */ UINT64_C (0x827F6E1975A58A93),
+    UINT64_C (0xEC2CAA7B143CE01A), -13242},
+  { /* -3920 */ UINT64_C (0x83C4E245ED051DC1),
+    UINT64_C (0xB782DB1FC6ABA49B), -13149},
+  { /* -3892 */ UINT64_C (0x850D821C0C86F175),
+    UINT64_C (0x753F080DAB88EE0A), -13056},
+  { /* -3864 */ UINT64_C (0x86595584116CAF3C),
+    UINT64_C (0x4250BE2EEBA87D15), -12963},
+  { /* -3836 */ UINT64_C (0x87A86479F14D8EA3),
+    UINT64_C (0x9031FECC0841642E), -12870},
+  { /* -3808 */ UINT64_C (0x88FAB70D8B44952A),
+    UINT64_C (0x3F1F93F1943CA9B6), -12777},
+  { /* -3780 */ UINT64_C (0x8A505562D9997D8A),
+    UINT64_C (0x268889F30FC7A121), -12684},
+  { /* -3752 */ UINT64_C (0x8BA947B223E5783E),
+    UINT64_C (0x2C87F18B39478AA3), -12591},
+  { /* -3724 */ UINT64_C (0x8D05964831B4FA23),
+    UINT64_C (0xED1E8AD53278B982), -12498},
+  { /* -3696 */ UINT64_C (0x8E6549867DA7D11A),
+    UINT64_C (0x4054F5360249EBD1), -12405},
+  { /* -3668 */ UINT64_C (0x8FC869E36910B987),
+    UINT64_C (0xBDFB5DAA8751F12C), -12312},
+  { /* -3640 */ UINT64_C (0x912EFFEA7015B2C5),
+    UINT64_C (0xC1187FA0C18ADBBE), -12219},
+  { /* -3612 */ UINT64_C (0x9299143C5E525385),
+    UINT64_C (0x772CED20F3BE4934), -12126},
+  { /* -3584 */ UINT64_C (0x9406AF8F83FD6265),
+    UINT64_C (0x4B4DE34E0EBC3E06), -12033},
+  { /* -3556 */ UINT64_C (0x9577DAAFEB92FA15),
+    UINT64_C (0x8E08F0978AC01650), -11940},
+  { /* -3528 */ UINT64_C (0x96EC9E7F9004839B),
+    UINT64_C (0xAC73F0226EFF5EA1), -11847},
+  { /* -3500 */ UINT64_C (0x986503F6936FD47B),
+    UINT64_C (0xAE686CF29A7B688D), -11754},
+  { /* -3472 */ UINT64_C (0x99E11423765EC1D0),
+    UINT64_C (0x2184706EA46A4C38), -11661},
+  { /* -3444 */ UINT64_C (0x9B60D82B4F907CA1),
+    UINT64_C (0x202C9C950E81F6F2), -11568},
+  { /* -3416 */ UINT64_C (0x9CE4594A044E0F1B),
+    UINT64_C (0xDDADB80577B906BE), -11475},
+  { /* -3388 */ UINT64_C (0x9E6BA0D2814B55A5),
+    UINT64_C (0x1F2A6E9BA997D195), -11382},
+  { /* -3360 */ UINT64_C (0x9FF6B82EF415D222),
+    UINT64_C (0x60DBD8AA443B560F), -11289},
+  { /* -3332 */ UINT64_C (0xA185A8E10512BB3F),
+    UINT64_C (0x2D22A5F73DE44D43), -11196},
+  { /* -3304 */ UINT64_C (0xA3187C82120DACE6),
+    UINT64_C (0x7401C6F091F87727), -11103},
+  { /* -3276 */ UINT64_C (0xA4AF3CC3695962A2),
+    UINT64_C (0x9314C38AF248CEAD), -11010},
+  { /* -3248 */ UINT64_C (0xA649F36E8583E81A),
+    UINT64_C (0x4D5B32F713D7F477), -10917},
+  { /* -3220 */ UINT64_C (0xA7E8AA65499FAF6D),
+    UINT64_C (0x44ED06A6C73283F2), -10824},
+  { /* -3192 */ UINT64_C (0xA98B6BA23E2300C7),
+    UINT64_C (0xB4B39DD9DDB8D317), -10731},
+  { /* -3164 */ UINT64_C (0xAB324138CE5F3A23),
+    UINT64_C (0x43AB66AA259BB141), -10638},
+  { /* -3136 */ UINT64_C (0xACDD3555869159D1),
+    UINT64_C (0xEC41C1793D69D0D1), -10545},
+  { /* -3108 */ UINT64_C (0xAE8C523E528D5220),
+    UINT64_C (0x2F9B11C68554E06E), -10452},
+  { /* -3080 */ UINT64_C (0xB03FA252BD05A815),
+    UINT64_C (0x3CA5A7540D9D56C9), -10359},
+  { /* -3052 */ UINT64_C (0xB1F7300C2F70E31A),
+    UINT64_C (0x6CC8610FE1204DB6), -10266},
+  { /* -3024 */ UINT64_C (0xB3B305FE328E571F),
+    UINT64_C (0x92E1BC1FBB33F18D), -10173},
+  { /* -2996 */ UINT64_C (0xB5732ED6AF8BD6A7),
+    UINT64_C (0x2C9155C7F2F76A10), -10080},
+  { /* -2968 */ UINT64_C (0xB737B55E31CDDE04),
+    UINT64_C (0xA908FD4A88728B6B),  -9987},
+  { /* -2940 */ UINT64_C (0xB900A478295BCCFF),
+    UINT64_C (0xC3BC70DAED20545E),  -9894},
+  { /* -2912 */ UINT64_C (0xBACE07232DF1C802),
+    UINT64_C (0x7C4C65D15C614C56),  -9801},
+  { /* -2884 */ UINT64_C (0xBC9FE87942B9DDF3),
+    UINT64_C (0x984B360DB52F4727),  -9708},
+  { /* -2856 */ UINT64_C (0xBE7653B01AAE13E5),
+    UINT64_C (0xEF84CC99CB4C5D18),  -9615},
+  { /* -2828 */ UINT64_C (0xC05154195DA4FBD5),
+    UINT64_C (0x2112BEF1B26149FE),  -9522},
+  { /* -2800 */ UINT64_C (0xC230F522EE0A7FC2),
+    UINT64_C (0xCFC147ADE4843A24),  -9429},
+  { /* -2772 */ UINT64_C (0xC41542572F468EAC),
+    UINT64_C (0x4068E186399DC436),  -9336},
+  { /* -2744 */ UINT64_C (0xC5FE475D4CD35CFF),
+    UINT64_C (0x4668677D5F46C29C),  -9243},
+  { /* -2716 */ UINT64_C (0xC7EC0FF98204EE6E),
+    UINT64_C (0xEB22603AA63048DA),  -9150},
+  { /* -2688 */ UINT64_C (0xC9DEA80D6283A34C),
+    UINT64_C (0x474B3CB1FE1D6A80),  -9057},
+  { /* -2660 */ UINT64_C (0xCBD61B98237B87D6),
+    UINT64_C (0xB23C80CFBE16ABC0),  -8964},
+  { /* -2632 */ UINT64_C (0xCDD276B6E582284F),
+    UINT64_C (0xD6EA3B733029EF0C),  -8871},
+  { /* -2604 */ UINT64_C (0xCFD3C5A4FF34B104),
+    UINT64_C (0x824F4075B7D3949B),  -8778},
+  { /* -2576 */ UINT64_C (0xD1DA14BC489025EA),
+    UINT64_C (0x3736730A9E47FEF9),  -8685},
+  { /* -2548 */ UINT64_C (0xD3E57075670581EB),
+    UINT64_C (0xDA84BEAC12680510),  -8592},
+  { /* -2520 */ UINT64_C (0xD5F5E5681A4B9285),
+    UINT64_C (0x3D24E68DC1027247),  -8499},
+  { /* -2492 */ UINT64_C (0xD80B804B89F068DE),
+    UINT64_C (0x014DA5D423752D8B),  -8406},
+  { /* -2464 */ UINT64_C (0xDA264DF693AC3E30),
+    UINT64_C (0x742AB8F3864562C9),  -8313},
+  { /* -2436 */ UINT64_C (0xDC465B601A77ADF0),
+    UINT64_C (0x8F5F77DFDC869AC6),  -8220},
+  { /* -2408 */ UINT64_C (0xDE6BB59F56672CDA),
+    UINT64_C (0x8C119F3680212414),  -8127},
+  { /* -2380 */ UINT64_C (0xE09669EC254DA8CF),
+    UINT64_C (0x60203BCBC6354D53),  -8034},
+  { /* -2352 */ UINT64_C (0xE2C6859F5C284230),
+    UINT64_C (0x43190B523F872B9D),  -7941},
+  { /* -2324 */ UINT64_C (0xE4FC163319551441),
+    UINT64_C (0x10EAA1481B149E5B),  -7848},
+  { /* -2296 */ UINT64_C (0xE7372943179706FC),
+    UINT64_C (0x2A0969BF88679396),  -7755},
+  { /* -2268 */ UINT64_C (0xE977CC8D01E8A9B1),
+    UINT64_C (0x69D9C1F7D0B33E4A),  -7662},
+  { /* -2240 */ UINT64_C (0xEBBE0DF0C8201AC5),
+    UINT64_C (0x131565BE33DDA91A),  -7569},
+  { /* -2212 */ UINT64_C (0xEE09FB70F46605EB),
+    UINT64_C (0x453DBEA8FF260AC3),  -7476},
+  { /* -2184 */ UINT64_C (0xF05BA3330181C750),
+    UINT64_C (0xCCFB1CC2EF1F44DF),  -7383},
+  { /* -2156 */ UINT64_C (0xF2B3137FB1FCC743),
+    UINT64_C (0x0AD3B225CC56A181),  -7290},
+  { /* -2128 */ UINT64_C (0xF5105AC3681F2716),
+    UINT64_C (0x5F8385B3A882FF4C),  -7197},
+  { /* -2100 */ UINT64_C (0xF773878E7EC7DD45),
+    UINT64_C (0x2B566EF4CAF507B1),  -7104},
+  { /* -2072 */ UINT64_C (0xF9DCA895A3226409),
+    UINT64_C (0x166C15F456786C27),  -7011},
+  { /* -2044 */ UINT64_C (0xFC4BCCB22F3C2305),
+    UINT64_C (0x2B49C17CF287A651),  -6918},
+  { /* -2016 */ UINT64_C (0xFEC102E2857BC1F9),
+    UINT64_C (0x6C656C3B1F2C9D92),  -6825},
+  { /* -1988 */ UINT64_C (0x809E2D25367E4BF4),
+    UINT64_C (0x0CC90239661BB26F),  -6731},
+  { /* -1960 */ UINT64_C (0x81DEF119B76837C8),
+    UINT64_C (0xFA70B9A2CA60B004),  -6638},
+  { /* -1932 */ UINT64_C (0x8322D5069A14EFDC),
+    UINT64_C (0xD0BE910FA323527D),  -6545},
+  { /* -1904 */ UINT64_C (0x8469E0B6F2B8BD9B),
+    UINT64_C (0x6A22490E8E9EC98C),  -6452},
+  { /* -1876 */ UINT64_C (0x85B41C0945241144),
+    UINT64_C (0x5015E086841D2C29),  -6359},
+  { /* -1848 */ UINT64_C (0x87018EEFB53C6325),
+    UINT64_C (0x69138459B0FA72D4),  -6266},
+  { /* -1820 */ UINT64_C (0x8852417037EDF7DA),
+    UINT64_C (0x9A8A962EDA71E86D),  -6173},
+  { /* -1792 */ UINT64_C (0x89A63BA4C497B50E),
+    UINT64_C (0x6C83AD1260FF20F5),  -6080},
+  { /* -1764 */ UINT64_C (0x8AFD85BB86F23727),
+    UINT64_C (0x9F2BBAD927B779D2),  -5987},
+  { /* -1736 */ UINT64_C (0x8C5827F711735B46),
+    UINT64_C (0xD82EF2860273DE8E),  -5894},
+  { /* -1708 */ UINT64_C (0x8DB62AAE902F73F6),
+    UINT64_C (0x28E92E707150BC1E),  -5801},
+  { /* -1680 */ UINT64_C (0x8F17964DFC3961F2),
+    UINT64_C (0x416D7F9AB1E67580),  -5708},
+  { /* -1652 */ UINT64_C (0x907C73564F82CD82),
+    UINT64_C (0xC1E15A2C8FF4DF56),  -5615},
+  { /* -1624 */ UINT64_C (0x91E4CA5DB93DBFEC),
+    UINT64_C (0x56700866B85D57FF),  -5522},
+  { /* -1596 */ UINT64_C (0x9350A40FD2C0DFA4),
+    UINT64_C (0x352E1FC6A1AADA9A),  -5429},
+  { /* -1568 */ UINT64_C (0x94C0092DD4EF9511),
+    UINT64_C (0x43CF71D5C4FD7868),  -5336},
+  { /* -1540 */ UINT64_C (0x9633028ECE2760D3),
+    UINT64_C (0xB070FBDE944761C1),  -5243},
+  { /* -1512 */ UINT64_C (0x97A9991FD8B3AFC0),
+    UINT64_C (0x387898A6E22F821C),  -5150},
+  { /* -1484 */ UINT64_C (0x9923D5E451C97BF8),
+    UINT64_C (0xC66B5979A2CE2EF6),  -5057},
+  { /* -1456 */ UINT64_C (0x9AA1C1F6110C0DD0),
+    UINT64_C (0x8F8857E875E7774F),  -4964},
+  { /* -1428 */ UINT64_C (0x9C236685A09C3276),
+    UINT64_C (0x801125C857604CA6),  -4871},
+  { /* -1400 */ UINT64_C (0x9DA8CCDA75B341B5),
+    UINT64_C (0xA5C58D5F91A476D8),  -4778},
+  { /* -1372 */ UINT64_C (0x9F31FE5329CB4F78),
+    UINT64_C (0x77BB986469851F56),  -4685},
+  { /* -1344 */ UINT64_C (0xA0BF0465B455E921),
+    UINT64_C (0x6E1F7F1642EBAAC8),  -4592},
+  { /* -1316 */ UINT64_C (0xA24FE89FA502C239),
+    UINT64_C (0x68758CBF71B19436),  -4499},
+  { /* -1288 */ UINT64_C (0xA3E4B4A65E97B76A),
+    UINT64_C (0xFAD2BE1679765F27),  -4406},
+  { /* -1260 */ UINT64_C (0xA57D7237525B9240),
+    UINT64_C (0xF77D1A9FF40226F3),  -4313},
+  { /* -1232 */ UINT64_C (0xA71A2B283C14FBA6),
+    UINT64_C (0x800CFAB80C4E2EB1),  -4220},
+  { /* -1204 */ UINT64_C (0xA8BAE9675E9F0EB7),
+    UINT64_C (0xAD3CB74FD4CAC6DF),  -4127},
+  { /* -1176 */ UINT64_C (0xAA5FB6FBC115010B),
+    UINT64_C (0x850B0C5976B21028),  -4034},
+  { /* -1148 */ UINT64_C (0xAC089E056C965942),
+    UINT64_C (0x99DAEEEDE2E0EB1C),  -3941},
+  { /* -1120 */ UINT64_C (0xADB5A8BDAAA53051),
+    UINT64_C (0x61363686961A41E5),  -3848},
+  { /* -1092 */ UINT64_C (0xAF66E177441FFDB2),
+    UINT64_C (0x2C638FCBB822F998),  -3755},
+  { /* -1064 */ UINT64_C (0xB11C529EC0D87268),
+    UINT64_C (0xC6F075C4B81FC72D),  -3662},
+  { /* -1036 */ UINT64_C (0xB2D606BAA7C8EA89),
+    UINT64_C (0x2EB30A609088263E),  -3569},
+  { /* -1008 */ UINT64_C (0xB494086BBFEA00C3),
+    UINT64_C (0xB4E4BE5B6455EF96),  -3476},
+  { /*  -980 */ UINT64_C (0xB656626D51A9D353),
+    UINT64_C (0x384EFD538D690C57),  -3383},
+  { /*  -952 */ UINT64_C (0xB81D1F9569068D8E),
+    UINT64_C (0x24D256C540A50309),  -3290},
+  { /*  -924 */ UINT64_C (0xB9E84AD5184DCD48),
+    UINT64_C (0x94CDE1BA3CFCA943),  -3197},
+  { /*  -896 */ UINT64_C (0xBBB7EF38BB827F2D),
+    UINT64_C (0x6D4AA5B50BB5DC0D),  -3104},
+  { /*  -868 */ UINT64_C (0xBD8C17E83C6AD135),
+    UINT64_C (0xAEBCC797B23B9BB6),  -3011},
+  { /*  -840 */ UINT64_C (0xBF64D0275747DE70),
+    UINT64_C (0x925624C0D7D93317),  -2918},
+  { /*  -812 */ UINT64_C (0xC1422355E038BB64),
+    UINT64_C (0x8035810006A8CFB7),  -2825},
+  { /*  -784 */ UINT64_C (0xC3241CF0094A8E70),
+    UINT64_C (0x8E5A2E5116BAF191),  -2732},
+  { /*  -756 */ UINT64_C (0xC50AC88EA93763C0),
+    UINT64_C (0x249494D1BF7C86EC),  -2639},
+  { /*  -728 */ UINT64_C (0xC6F631E782D57096),
+    UINT64_C (0xB0560C246F90E9E8),  -2546},
+  { /*  -700 */ UINT64_C (0xC8E664CD8D387DF8),
+    UINT64_C (0x1E2BD23627C69802),  -2453},
+  { /*  -672 */ UINT64_C (0xCADB6D313C8736FC),
+    UINT64_C (0x2FFFF1289A804C5B),  -2360},
+  { /*  -644 */ UINT64_C (0xCCD55720CB861B6E),
+    UINT64_C (0xD95729515330F114),  -2267},
+  { /*  -616 */ UINT64_C (0xCED42EC885D9DBBE),
+    UINT64_C (0xA855E127113C887C),  -2174},
+  { /*  -588 */ UINT64_C (0xD0D800731302E7A4),
+    UINT64_C (0x064B9E215703F180),  -2081},
+  { /*  -560 */ UINT64_C (0xD2E0D889C213FD60),
+    UINT64_C (0xE00BAD8DFC0D8C8E),  -1988},
+  { /*  -532 */ UINT64_C (0xD4EEC394D6258BF8),
+    UINT64_C (0x28E54542D9B56DC9),  -1895},
+  { /*  -504 */ UINT64_C (0xD701CE3BD387BF47),
+    UINT64_C (0xC654D07271E6C3A0),  -1802},
+  { /*  -476 */ UINT64_C (0xD91A0545CDB51185),
+    UINT64_C (0xE287C2AD77EAD648),  -1709},
+  { /*  -448 */ UINT64_C (0xDB377599B6074244),
+    UINT64_C (0x84C663CEE6B86E7C),  -1616},
+  { /*  -420 */ UINT64_C (0xDD5A2C3EAB3097CB),
+    UINT64_C (0xBD54467EEC6DD2BB),  -1523},
+  { /*  -392 */ UINT64_C (0xDF82365C497B5453),
+    UINT64_C (0xCB285CEB2FED040E),  -1430},
+  { /*  -364 */ UINT64_C (0xE1AFA13AFBD14D6D),
+    UINT64_C (0x82189C09A3A1EC21),  -1337},
+  { /*  -336 */ UINT64_C (0xE3E27A444D8D98B7),
+    UINT64_C (0xFD1B1B2308169B25),  -1244},
+  { /*  -308 */ UINT64_C (0xE61ACF033D1A45DF),
+    UINT64_C (0x6FB92487298E33BE),  -1151},
+  { /*  -280 */ UINT64_C (0xE858AD248F5C22C9),
+    UINT64_C (0xD1B3400F8F9CFF69),  -1058},
+  { /*  -252 */ UINT64_C (0xEA9C227723EE8BCB),
+    UINT64_C (0x465E15A979C1CADC),   -965},
+  { /*  -224 */ UINT64_C (0xECE53CEC4A314EBD),
+    UINT64_C (0xA4F8BF5635246428),   -872},
+  { /*  -196 */ UINT64_C (0xEF340A98172AACE4),
+    UINT64_C (0x86FB897116C87C35),   -779},
+  { /*  -168 */ UINT64_C (0xF18899B1BC3F8CA1),
+    UINT64_C (0xDC44E6C3CB279AC2),   -686},
+  { /*  -140 */ UINT64_C (0xF3E2F893DEC3F126),
+    UINT64_C (0x5A89DBA3C3EFCCFB),   -593},
+  { /*  -112 */ UINT64_C (0xF64335BCF065D37D),
+    UINT64_C (0x4D4617B5FF4A16D6),   -500},
+  { /*   -84 */ UINT64_C (0xF8A95FCF88747D94),
+    UINT64_C (0x75A44C6397CE912A),   -407},
+  { /*   -56 */ UINT64_C (0xFB158592BE068D2E),
+    UINT64_C (0xEED6E2F0F0D56713),   -314},
+  { /*   -28 */ UINT64_C (0xFD87B5F28300CA0D),
+    UINT64_C (0x8BCA9D6E188853FC),   -221},
+  { /*     0 */ UINT64_C (0x8000000000000000),
+    UINT64_C (0x0000000000000000),   -127},
+  { /*    28 */ UINT64_C (0x813F3978F8940984),
+    UINT64_C (0x4000000000000000),    -34},
+  { /*    56 */ UINT64_C (0x82818F1281ED449F),
+    UINT64_C (0xBFF8F10E7A8921A4),     59},
+  { /*    84 */ UINT64_C (0x83C7088E1AAB65DB),
+    UINT64_C (0x792667C6DA79E0FA),    152},
+  { /*   112 */ UINT64_C (0x850FADC09923329E),
+    UINT64_C (0x03E2CF6BC604DDB0),    245},
+  { /*   140 */ UINT64_C (0x865B86925B9BC5C2),
+    UINT64_C (0x0B8A2392BA45A9B2),    338},
+  { /*   168 */ UINT64_C (0x87AA9AFF79042286),
+    UINT64_C (0x90FB44D2F05D0843),    431},
+  { /*   196 */ UINT64_C (0x88FCF317F22241E2),
+    UINT64_C (0x441FECE3BDF81F03),    524},
+  { /*   224 */ UINT64_C (0x8A5296FFE33CC92F),
+    UINT64_C (0x82BD6B70D99AAA70),    617},
+  { /*   252 */ UINT64_C (0x8BAB8EEFB6409C1A),
+    UINT64_C (0x1AD089B6C2F7548E),    710},
+  { /*   280 */ UINT64_C (0x8D07E33455637EB2),
+    UINT64_C (0xDB0B487B6423E1E8),    803},
+  { /*   308 */ UINT64_C (0x8E679C2F5E44FF8F),
+    UINT64_C (0x570F09EAA7EA7648),    896},
+  { /*   336 */ UINT64_C (0x8FCAC257558EE4E6),
+    UINT64_C (0x213A4F0AA5E8A7B2),    989},
+  { /*   364 */ UINT64_C (0x91315E37DB165AA9),
+    UINT64_C (0x2C0DE8DD3D020C0C),   1082},
+  { /*   392 */ UINT64_C (0x929B7871DE7F22B9),
+    UINT64_C (0x1C306F5D1B0B5FDF),   1175},
+  { /*   420 */ UINT64_C (0x940919BBD4620B6D),
+    UINT64_C (0x250535BCC387778F),   1268},
+  { /*   448 */ UINT64_C (0x957A4AE1EBF7F3D3),
+    UINT64_C (0xA7EA9C8838CE9437),   1361},
+  { /*   476 */ UINT64_C (0x96EF14C6454AA840),
+    UINT64_C (0x4CF76E8DF8D89498),   1454},
+  { /*   504 */ UINT64_C (0x9867806127ECE4F4),
+    UINT64_C (0xBF1D49CACCCD5E68),   1547},
+  { /*   532 */ UINT64_C (0x99E396C13A3ACFF1),
+    UINT64_C (0xB0C5560A402AC0B3),   1640},
+  { /*   560 */ UINT64_C (0x9B63610BB9243E46),
+    UINT64_C (0x655494C5C95D77F2),   1733},
+  { /*   588 */ UINT64_C (0x9CE6E87CB0821C85),
+    UINT64_C (0xC3BFBAE0F3E130E3),   1826},
+  { /*   616 */ UINT64_C (0x9E6E366733F85561),
+    UINT64_C (0x02E008393FD60B56),   1919},
+  { /*   644 */ UINT64_C (0x9FF95435986594C9),
+    UINT64_C (0x6632249F8A06C2C7),   2012},
+  { /*   672 */ UINT64_C (0xA1884B69ADE24964),
+    UINT64_C (0x55E04DBA4B3BD4DE),   2105},
+  { /*   700 */ UINT64_C (0xA31B259CFA50498F),
+    UINT64_C (0x7478A3CBBA44EC49),   2198},
+  { /*   728 */ UINT64_C (0xA4B1EC80F47C84AD),
+    UINT64_C (0x44B222741EB1EBBF),   2291},
+  { /*   756 */ UINT64_C (0xA64CA9DF3FD42CF6),
+    UINT64_C (0x8F96BEE42FDA4243),   2384},
+  { /*   784 */ UINT64_C (0xA7EB6799E8AEC999),
+    UINT64_C (0x1CF4A5C3BC09FA6F),   2477},
+  { /*   812 */ UINT64_C (0xA98E2FABA12EA481),
+    UINT64_C (0x8AF70B7BE4ECB751),   2570},
+  { /*   840 */ UINT64_C (0xAB350C27FEB90ACC),
+    UINT64_C (0x3C4A575151B294DD),   2663},
+  { /*   868 */ UINT64_C (0xACE0073BB807DA80),
+    UINT64_C (0x8480950470D805EE),   2756},
+  { /*   896 */ UINT64_C (0xAE8F2B2CE3D5DBE9),
+    UINT64_C (0x870A8D87239D8F35),   2849},
+  { /*   924 */ UINT64_C (0xB042825B38276899),
+    UINT64_C (0xBCC0502652E7E71E),   2942},
+  { /*   952 */ UINT64_C (0xB1FA17404A30E5E8),
+    UINT64_C (0xDD929F09C3EFF5AD),   3035},
+  { /*   980 */ UINT64_C (0xB3B5F46FCEDC9C88),
+    UINT64_C (0x16C0208E3CC9E874),   3128},
+  { /*  1008 */ UINT64_C (0xB5762497DBF17A9E),
+    UINT64_C (0x1931B583A9431D7E),   3221},
+  { /*  1036 */ UINT64_C (0xB73AB28129DC51BB),
+    UINT64_C (0xBF0F83FB9A0D7ED8),   3314},
+  { /*  1064 */ UINT64_C (0xB903A90F561D25E2),
+    UINT64_C (0xE30DB03E0F8DD286),   3407},
+  { /*  1092 */ UINT64_C (0xBAD11341265A26CB),
+    UINT64_C (0x9F7165AE2B921943),   3500},
+  { /*  1120 */ UINT64_C (0xBCA2FC30CC19F090),
+    UINT64_C (0x9EB5CB19647508C5),   3593},
+  { /*  1148 */ UINT64_C (0xBE796F142926B4F1),
+    UINT64_C (0x8C9281465B0C0F44),   3686},
+  { /*  1176 */ UINT64_C (0xC054773D149BF26B),
+    UINT64_C (0x24BD4C00042AD125),   3779},
+  { /*  1204 */ UINT64_C (0xC2342019A0A0627E),
+    UINT64_C (0xEE1F4EA0CEC13422),   3872},
+  { /*  1232 */ UINT64_C (0xC418753460CDCCA9),
+    UINT64_C (0x7EA30DBD7EA479E3),   3965},
+  { /*  1260 */ UINT64_C (0xC6018234B1486FB5),
+    UINT64_C (0x46C1734E983D9305),   4058},
+  { /*  1288 */ UINT64_C (0xC7EF52DEFE87B751),
+    UINT64_C (0x764F4CF916B4DECE),   4151},
+  { /*  1316 */ UINT64_C (0xC9E1F3150DD1F818),
+    UINT64_C (0xA7C8570E77A19E03),   4244},
+  { /*  1344 */ UINT64_C (0xCBD96ED6466CF081),
+    UINT64_C (0xBEB7FBDC1CBE8B37),   4337},
+  { /*  1372 */ UINT64_C (0xCDD5D23FFB84D18E),
+    UINT64_C (0xE373203B69F2EB6A),   4430},
+  { /*  1400 */ UINT64_C (0xCFD7298DB6CB9672),
+    UINT64_C (0xDCE472C619AA3F63),   4523},
+  { /*  1428 */ UINT64_C (0xD1DD811983D276D4),
+    UINT64_C (0x53C35AD3235D128D),   4616},
+  { /*  1456 */ UINT64_C (0xD3E8E55C3C1F43D0),
+    UINT64_C (0xE47DEFC14A406E50),   4709},
+  { /*  1484 */ UINT64_C (0xD5F962EDD3FF8467),
+    UINT64_C (0x69FD88C48E1AC6B2),   4802},
+  { /*  1512 */ UINT64_C (0xD80F0685A81B2A81),
+    UINT64_C (0xB7157C60A24A056A),   4895},
+  { /*  1540 */ UINT64_C (0xDA29DCFACBC8BE72),
+    UINT64_C (0x22FC05BE6269F879),   4988},
+  { /*  1568 */ UINT64_C (0xDC49F3445824E360),
+    UINT64_C (0xFB0B98F6BBC4F0CC),   5081},
+  { /*  1596 */ UINT64_C (0xDE6F5679BBEF1BD9),
+    UINT64_C (0x35E3A416F04CA9AB),   5174},
+  { /*  1624 */ UINT64_C (0xE09A13D30C2DBA62),
+    UINT64_C (0xC6C6C1764E047E15),   5267},
+  { /*  1652 */ UINT64_C (0xE2CA38A9559AEEE3),
+    UINT64_C (0xC905DE537F07EC9C),   5360},
+  { /*  1680 */ UINT64_C (0xE4FFD276EEDCE658),
+    UINT64_C (0x87E8DCFC09DBC33B),   5453},
+  { /*  1708 */ UINT64_C (0xE73AEED7CB8AF755),
+    UINT64_C (0x45A4713B13D24707),   5546},
+  { /*  1736 */ UINT64_C (0xE97B9B89D001DAB3),
+    UINT64_C (0xB1A3642A8DA3CF50),   5639},
+  { /*  1764 */ UINT64_C (0xEBC1E66D2608F4C9),
+    UINT64_C (0x5A1B25540EB6B8AB),   5732},
+  { /*  1792 */ UINT64_C (0xEE0DDD84924AB88C),
+    UINT64_C (0x2D4070F33B21AB7C),   5825},
+  { /*  1820 */ UINT64_C (0xF05F8EF5CAA2331E),
+    UINT64_C (0x727544D538F3F31F),   5918},
+  { /*  1848 */ UINT64_C (0xF2B70909CD3FD35C),
+    UINT64_C (0xA2BF0C63A814E04F),   6011},
+  { /*  1876 */ UINT64_C (0xF5145A2D38A78635),
+    UINT64_C (0x51528E351ACE7C2C),   6104},
+  { /*  1904 */ UINT64_C (0xF77790F0A48A45CE),
+    UINT64_C (0x08F13995CF9C2748),   6197},
+  { /*  1932 */ UINT64_C (0xF9E0BC08FB7D3EBF),
+    UINT64_C (0xC167073AC21593D6),   6290},
+  { /*  1960 */ UINT64_C (0xFC4FEA4FD590B40A),
+    UINT64_C (0x7A37993EB21444FB),   6383},
+  { /*  1988 */ UINT64_C (0xFEC52AC3D3C8CFC1),
+    UINT64_C (0xBD4C24B2C0457431),   6476},
+  { /*  2016 */ UINT64_C (0x80A046447E3D49F1),
+    UINT64_C (0xB7B1ADA9CDEBA84E),   6570},
+  { /*  2044 */ UINT64_C (0x81E10F748C479223),
+    UINT64_C (0xC2CE91A881EDD192),   6663},
+  { /*  2072 */ UINT64_C (0x8324F8AA08D7D411),
+    UINT64_C (0x0CC6866C5D69B2CC),   6756},
+  { /*  2100 */ UINT64_C (0x846C09B028AE0395),
+    UINT64_C (0x04F609974DD3FFE9),   6849},
+  { /*  2128 */ UINT64_C (0x85B64A659077660E),
+    UINT64_C (0x7FE2B4308DCBF1A4),   6942},
+  { /*  2156 */ UINT64_C (0x8703C2BC85483E07),
+    UINT64_C (0x38D0EF9AB8A8F2C9),   7035},
+  { /*  2184 */ UINT64_C (0x88547ABB1D8E5BD9),
+    UINT64_C (0x1D73EF3EAAC3C964),   7128},
+  { /*  2212 */ UINT64_C (0x89A87A7B727DC0D2),
+    UINT64_C (0x5C7015CD0E51679A),   7221},
+  { /*  2240 */ UINT64_C (0x8AFFCA2BD1F88549),
+    UINT64_C (0x1E34291B1EF566C7),   7314},
+  { /*  2268 */ UINT64_C (0x8C5A720EF0F33507),
+    UINT64_C (0x11C0B3BACD7601B3),   7407},
+  { /*  2296 */ UINT64_C (0x8DB87A7C1E56D873),
+    UINT64_C (0x9E9383D73D486882),   7500},
+  { /*  2324 */ UINT64_C (0x8F19EBDF7661E3E9),
+    UINT64_C (0xAC89BFA5E79484A7),   7593},
+  { /*  2352 */ UINT64_C (0x907ECEBA168949B3),
+    UINT64_C (0x9CC5EE51962C011A),   7686},
+  { /*  2380 */ UINT64_C (0x91E72BA251DAEE3D),
+    UINT64_C (0x564F722FCAA40DD4),   7779},
+  { /*  2408 */ UINT64_C (0x93530B43E5E2C129),
+    UINT64_C (0x413407CFEEAC9744),   7872},
+  { /*  2436 */ UINT64_C (0x94C276603013C119),
+    UINT64_C (0xC69F0B71EF89019F),   7965},
+  { /*  2464 */ UINT64_C (0x963575CE63B6332D),
+    UINT64_C (0x7EFA7D29C44E11B7),   8058},
+  { /*  2492 */ UINT64_C (0x97AC127BC05C5A60),
+    UINT64_C (0xB450373470F0746B),   8151},
+  { /*  2520 */ UINT64_C (0x9926556BC8DEFE43),
+    UINT64_C (0x5A848859645D1C70),   8244},
+  { /*  2548 */ UINT64_C (0x9AA447B87AE313B7),
+    UINT64_C (0x2C95A08E49A4C15B),   8337},
+  { /*  2576 */ UINT64_C (0x9C25F29286E9DDB6),
+    UINT64_C (0x51EDEA897B34601F),   8430},
+  { /*  2604 */ UINT64_C (0x9DAB5F4188ECDF77),
+    UINT64_C (0xDD5DAEBB2F169C8B),   8523},
+  { /*  2632 */ UINT64_C (0x9F3497244186FCA4),
+    UINT64_C (0xB50008D92529E91F),   8616},
+  { /*  2660 */ UINT64_C (0xA0C1A3B0CFAC27B5),
+    UINT64_C (0x13E15517552A7BC8),   8709},
+  { /*  2688 */ UINT64_C (0xA2528E74EAF101FC),
+    UINT64_C (0xF09E780BCC8238D9),   8802},
+  { /*  2716 */ UINT64_C (0xA3E761161E63D464),
+    UINT64_C (0x3C85A6192EBF4818),   8895},
+  { /*  2744 */ UINT64_C (0xA580255203F84B47),
+    UINT64_C (0x3A5828869701A166),   8988},
+  { /*  2772 */ UINT64_C (0xA71CE4FE80876383),
+    UINT64_C (0x3033D77325DAF288),   9081},
+  { /*  2800 */ UINT64_C (0xA8BDAA0A0064FA44),
+    UINT64_C (0x8B231A70EB5444CE),   9174},
+  { /*  2828 */ UINT64_C (0xAA627E7BB48C74C5),
+    UINT64_C (0x4251FF2792301CE6),   9267},
+  { /*  2856 */ UINT64_C (0xAC0B6C73D065F8CC),
+    UINT64_C (0xFA1BDE1F473556A5),   9360},
+  { /*  2884 */ UINT64_C (0xADB87E2BC825B270),
+    UINT64_C (0x2A73F1628AA4208F),   9453},
+  { /*  2912 */ UINT64_C (0xAF69BDF68FC6A740),
+    UINT64_C (0x7730E00421DA4D55),   9546},
+  { /*  2940 */ UINT64_C (0xB11F3640DAA29ADE),
+    UINT64_C (0x9254AA6FBBB55F5C),   9639},
+  { /*  2968 */ UINT64_C (0xB2D8F1915BA88CA5),
+    UINT64_C (0x7F959CB702329D14),   9732},
+  { /*  2996 */ UINT64_C (0xB496FA89063359F7),
+    UINT64_C (0xFC797C10226CDA5B),   9825},
+  { /*  3024 */ UINT64_C (0xB6595BE34F821493),
+    UINT64_C (0x40C3A071220F5568),   9918},
+  { /*  3052 */ UINT64_C (0xB820207670D3A02E),
+    UINT64_C (0x57854716B3F18898),  10011},
+  { /*  3080 */ UINT64_C (0xB9EB5333AA272E9B),
+    UINT64_C (0x11C48D02B8326BD4),  10104},
+  { /*  3108 */ UINT64_C (0xBBBAFF2785A33595),
+    UINT64_C (0x209D5496B884CD00),  10197},
+  { /*  3136 */ UINT64_C (0xBD8F2F7A1BA47D6D),
+    UINT64_C (0x566765461BD2F61C),  10290},
+  { /*  3164 */ UINT64_C (0xBF67EF6F5776EBCA),
+    UINT64_C (0x7D7ACEBF8AADFB4B),  10383},
+  { /*  3192 */ UINT64_C (0xC1454A673CB9B1CE),
+    UINT64_C (0xB889018E4F6E9A52),  10476},
+  { /*  3220 */ UINT64_C (0xC3274BDE2D708910),
+    UINT64_C (0x1556481F9C26F53D),  10569},
+  { /*  3248 */ UINT64_C (0xC50DFF6D30C3AEFC),
+    UINT64_C (0xF85333A94848659F),  10662},
+  { /*  3276 */ UINT64_C (0xC6F970CA3A705279),
+    UINT64_C (0x67CE61CCFD48C510),  10755},
+  { /*  3304 */ UINT64_C (0xC8E9ABC872EB2BC1),
+    UINT64_C (0x1A1AEAE7CF8A9D3E),  10848},
+  { /*  3332 */ UINT64_C (0xCADEBC588036FAE3),
+    UINT64_C (0x9D3D9605B201EB8A),  10941},
+  { /*  3360 */ UINT64_C (0xCCD8AE88CF70AD84),
+    UINT64_C (0x12E29F09D906160A),  11034},
+  { /*  3388 */ UINT64_C (0xCED78E85DF12F0E4),
+    UINT64_C (0xEB3149759843E989),  11127},
+  { /*  3416 */ UINT64_C (0xD0DB689A89F2F9B1),
+    UINT64_C (0xDF7601457CA20B36),  11220},
+  { /*  3444 */ UINT64_C (0xD2E4493052F84F6F),
+    UINT64_C (0x45BEEBB8A6B94A98),  11313},
+  { /*  3472 */ UINT64_C (0xD4F23CCFB1916DF5),
+    UINT64_C (0xCBDCD02F23CC7690),  11406},
+  { /*  3500 */ UINT64_C (0xD70550205EE713EC),
+    UINT64_C (0xD67AEFFBFCACC7B9),  11499},
+  { /*  3528 */ UINT64_C (0xD91D8FE9A3D019CC),
+    UINT64_C (0x44289DD21B589D7B),  11592},
+  { /*  3556 */ UINT64_C (0xDB3B0912A787B190),
+    UINT64_C (0x4881D9E963E4CE8F),  11685},
+  { /*  3584 */ UINT64_C (0xDD5DC8A2BF27F3F7),
+    UINT64_C (0x95AA118EC1D08318),  11778},
+  { /*  3612 */ UINT64_C (0xDF85DBC1BDEAA4DD),
+    UINT64_C (0x36D5B4A1A7071960),  11871},
+  { /*  3640 */ UINT64_C (0xE1B34FB846321D04),
+    UINT64_C (0x72C4D2CAD73B0A7B),  11964},
+  { /*  3668 */ UINT64_C (0xE3E631F01B5C4C7D),
+    UINT64_C (0xE6331D95A376B8C8),  12057},
+  { /*  3696 */ UINT64_C (0xE61E8FF47461CDA9),
+    UINT64_C (0xE20A88F1134F906D),  12150},
+  { /*  3724 */ UINT64_C (0xE85C77724F4305C5),
+    UINT64_C (0x158950EF08DE22BF),  12243},
+  { /*  3752 */ UINT64_C (0xEA9FF638C54554E1),
+    UINT64_C (0xC7C91D5C341ED39E),  12336},
+  { /*  3780 */ UINT64_C (0xECE91A3960025C31),
+    UINT64_C (0x7CB5735C85C60AD7),  12429},
+  { /*  3808 */ UINT64_C (0xEF37F1886F4B6690),
+    UINT64_C (0xF659EDE2159A45ED),  12522},
+  { /*  3836 */ UINT64_C (0xF18C8A5D5FE30463),
+    UINT64_C (0x33A802CDAED28CF4),  12615},
+  { /*  3864 */ UINT64_C (0xF3E6F313130EF0EF),
+    UINT64_C (0x78D946BAB954B82F),  12708},
+  { /*  3892 */ UINT64_C (0xF6473A2837045CAA),
+    UINT64_C (0xB325712DD8C98917),  12801},
+  { /*  3920 */ UINT64_C (0xF8AD6E3FA030BD15),
+    UINT64_C (0xC9B1474D8F89C26A),  12894},
+  { /*  3948 */ UINT64_C (0xFB199E20A3614828),
+    UINT64_C (0xC8C37010926872B0),  12987},
+  { /*  3976 */ UINT64_C (0xFD8BD8B770CB469E),
+    UINT64_C (0x6B1D2745340E7B15),  13080},
+  { /*  4004 */ UINT64_C (0x8002168AB7FBB6EE),
+    UINT64_C (0x3C67B6BBB284E49E),  13174},
+  { /*  4032 */ UINT64_C (0x81415538CE493BD5),
+    UINT64_C (0xF22E502FCDD4BCA2),  13267},
+  { /*  4060 */ UINT64_C (0x8283B014721299BB),
+    UINT64_C (0xD00832554D9149C7),  13360},
+  { /*  4088 */ UINT64_C (0x83C92EDF425B292D),
+    UINT64_C (0x7C1735FC3B813C8D),  13453},
+  { /*  4116 */ UINT64_C (0x8511D96E362C1A73),
+    UINT64_C (0xFA9D4D41A7042941),  13546},
+  { /*  4144 */ UINT64_C (0x865DB7A9CCD2839E),
+    UINT64_C (0x0367500A8E9A1790),  13639},
+  { /*  4172 */ UINT64_C (0x87ACD18E3E95BEDA),
+    UINT64_C (0x8F1672EC7D776C86),  13732},
+  { /*  4200 */ UINT64_C (0x88FF2F2BADE74531),
+    UINT64_C (0xC9AC50475E25293A),  13825},
+  { /*  4228 */ UINT64_C (0x8A54D8A6590D3496),
+    UINT64_C (0xE9CC6E8725EC5D92),  13918},
+  { /*  4256 */ UINT64_C (0x8BADD636CC48B341),
+    UINT64_C (0x0879B2E5F6EE8B1D),  14011},
+  { /*  4284 */ UINT64_C (0x8D0A302A14796534),
+    UINT64_C (0x0DDC924865236FC7),  14104},
+  { /*  4312 */ UINT64_C (0x8E69EEE1F23F2BE5),
+    UINT64_C (0x2F33C652BD12FAB8),  14197},
+  { /*  4340 */ UINT64_C (0x8FCD1AD50D9B6AF0),
+    UINT64_C (0x62FE50CE55EED183),  14290},
+  { /*  4368 */ UINT64_C (0x9133BC8F2A130FE5),
+    UINT64_C (0xAD6A6308A8E8B557),  14383},
+  { /*  4396 */ UINT64_C (0x929DDCB15B529E4E),
+    UINT64_C (0x4B07B86F1DB31284),  14476},
+  { /*  4424 */ UINT64_C (0x940B83F23A55842A),
+    UINT64_C (0x9DBAA465EFE141A1),  14569},
+  { /*  4452 */ UINT64_C (0x957CBB1E1B11FE52),
+    UINT64_C (0x6B3C9C8F4DA2A4D8),  14662},
+  { /*  4480 */ UINT64_C (0x96F18B1742AAD751),
+    UINT64_C (0x888C9AB2FC5B3437),  14755},
+  { /*  4508 */ UINT64_C (0x9869FCD61E284E93),
+    UINT64_C (0x8E33034A7A9E5D56),  14848},
+  { /*  4536 */ UINT64_C (0x99E6196979B978F1),
+    UINT64_C (0xBA00864671D10540),  14941},
+  { /*  4564 */ UINT64_C (0x9B65E9F6B87F6EFE),
+    UINT64_C (0xC7FDDFD9302C767D),  15034},
+  { /*  4592 */ UINT64_C (0x9CE977BA0CE3A0BD),
+    UINT64_C (0x61D59D402AAE4FEA),  15127},
+  { /*  4620 */ UINT64_C (0x9E70CC06B17AA9C6),
+    UINT64_C (0xDE85ADFE03E691B6),  15220},
+  { /*  4648 */ UINT64_C (0x9FFBF04722750449),
+    UINT64_C (0x803C1CD864033781),  15313},
+  { /*  4676 */ UINT64_C (0xA18AEDFD579EFCAF),
+    UINT64_C (0x40BBC431F624B546),  15406},
+  { /*  4704 */ UINT64_C (0xA31DCEC2FEF14B30),
+    UINT64_C (0xA28A151725A55E11),  15499},
+  { /*  4732 */ UINT64_C (0xA4B49C49B7B3BC11),
+    UINT64_C (0xFBB16E441EEC585B),  15592},
+  { /*  4760 */ UINT64_C (0xA64F605B4E3352CD),
+    UINT64_C (0x5B8452AF2302FE14),  15685},
+  { /*  4788 */ UINT64_C (0xA7EE24D9F80D57F7),
+    UINT64_C (0x9D2ACF5772F77020),  15778},
+  { /*  4816 */ UINT64_C (0xA990F3C09110C544),
+    UINT64_C (0x82B84CABC828BF94),  15871},
+  { /*  4844 */ UINT64_C (0xAB37D722D8B786AB),
+    UINT64_C (0xEE2722AD5F60D16F),  15964},
+  { /*  4872 */ UINT64_C (0xACE2D92DB0390B59),
+    UINT64_C (0x8D29DD5122E4278D),  16057},
+  { /*  4900 */ UINT64_C (0xAE9204275937A4C0),
+    UINT64_C (0xA8C91282E5AF94EB),  16150},
+  { /*  4928 */ UINT64_C (0xB045626FB50A35E7),
+    UINT64_C (0x58F8FDE02C03A6C7),  16243},
+  { /*  4956 */ UINT64_C (0xB1FCFE8084A3B8BF),
+    UINT64_C (0x35A5744EFFE56F34),  16336},
+  { /*  4984 */ UINT64_C (0xB3B8E2EDA91A232D),
+    UINT64_C (0xD950102978DBD100),  16429},
+};
+
+static const struct
+{
+  uint64_t mul1;
+  uint64_t mul2;
+  int32_t exp;
+} ldpowers10_28[] = {
+  { /*     0 */ UINT64_C (0x8000000000000000),
+    UINT64_C (0x0000000000000000),   -127},
+  { /*     1 */ UINT64_C (0xA000000000000000),
+    UINT64_C (0x0000000000000000),   -124},
+  { /*     2 */ UINT64_C (0xC800000000000000),
+    UINT64_C (0x0000000000000000),   -121},
+  { /*     3 */ UINT64_C (0xFA00000000000000),
+    UINT64_C (0x0000000000000000),   -118},
+  { /*     4 */ UINT64_C (0x9C40000000000000),
+    UINT64_C (0x0000000000000000),   -114},
+  { /*     5 */ UINT64_C (0xC350000000000000),
+    UINT64_C (0x0000000000000000),   -111},
+  { /*     6 */ UINT64_C (0xF424000000000000),
+    UINT64_C (0x0000000000000000),   -108},
+  { /*     7 */ UINT64_C (0x9896800000000000),
+    UINT64_C (0x0000000000000000),   -104},
+  { /*     8 */ UINT64_C (0xBEBC200000000000),
+    UINT64_C (0x0000000000000000),   -101},
+  { /*     9 */ UINT64_C (0xEE6B280000000000),
+    UINT64_C (0x0000000000000000),    -98},
+  { /*    10 */ UINT64_C (0x9502F90000000000),
+    UINT64_C (0x0000000000000000),    -94},
+  { /*    11 */ UINT64_C (0xBA43B74000000000),
+    UINT64_C (0x0000000000000000),    -91},
+  { /*    12 */ UINT64_C (0xE8D4A51000000000),
+    UINT64_C (0x0000000000000000),    -88},
+  { /*    13 */ UINT64_C (0x9184E72A00000000),
+    UINT64_C (0x0000000000000000),    -84},
+  { /*    14 */ UINT64_C (0xB5E620F480000000),
+    UINT64_C (0x0000000000000000),    -81},
+  { /*    15 */ UINT64_C (0xE35FA931A0000000),
+    UINT64_C (0x0000000000000000),    -78},
+  { /*    16 */ UINT64_C (0x8E1BC9BF04000000),
+    UINT64_C (0x0000000000000000),    -74},
+  { /*    17 */ UINT64_C (0xB1A2BC2EC5000000),
+    UINT64_C (0x0000000000000000),    -71},
+  { /*    18 */ UINT64_C (0xDE0B6B3A76400000),
+    UINT64_C (0x0000000000000000),    -68},
+  { /*    19 */ UINT64_C (0x8AC7230489E80000),
+    UINT64_C (0x0000000000000000),    -64},
+  { /*    20 */ UINT64_C (0xAD78EBC5AC620000),
+    UINT64_C (0x0000000000000000),    -61},
+  { /*    21 */ UINT64_C (0xD8D726B7177A8000),
+    UINT64_C (0x0000000000000000),    -58},
+  { /*    22 */ UINT64_C (0x878678326EAC9000),
+    UINT64_C (0x0000000000000000),    -54},
+  { /*    23 */ UINT64_C (0xA968163F0A57B400),
+    UINT64_C (0x0000000000000000),    -51},
+  { /*    24 */ UINT64_C (0xD3C21BCECCEDA100),
+    UINT64_C (0x0000000000000000),    -48},
+  { /*    25 */ UINT64_C (0x84595161401484A0),
+    UINT64_C (0x0000000000000000),    -44},
+  { /*    26 */ UINT64_C (0xA56FA5B99019A5C8),
+    UINT64_C (0x0000000000000000),    -41},
+  { /*    27 */ UINT64_C (0xCECB8F27F4200F3A),
+    UINT64_C (0x0000000000000000),    -38},
+};
+#endif
+
+#ifdef FLOAT128
+#if 0
+/* gcc -g -O3 -Wall q.c -o q -lmpfr -lgmp */
+#include <stdio.h>
+#include <mpfr.h>
+
+static void
+print_power (int i)
+{
+  long exp;
+  mpfr_t t;
+  mpz_t z;
+  mpz_t h;
+
+  mpfr_init2 (t, 192);
+  mpz_init (z);
+  mpz_init (h);
+  /* t = 10^i rounded to 192 bits */
+  mpfr_set_ui (t, 10, MPFR_RNDN);
+  mpfr_pow_si (t, t, i, MPFR_RNDN);
+  exp = mpfr_get_exp (t) - 192;
+  mpfr_mul_2si (t, t, -exp, MPFR_RNDN);
+  mpfr_get_z (z, t, MPFR_RNDN);
+  mpz_tdiv_q_2exp (h, z, 128);
+  printf ("  { /* %5d */ UINT64_C (0x%016lX), ", i, mpz_get_ui (h));
+  mpz_tdiv_q_2exp (h, z, 64);
+  mpz_tdiv_r_2exp (h, h, 64);
+  printf ("UINT64_C (0x%016lX),\n", mpz_get_ui (h));
+  mpz_tdiv_r_2exp (h, z, 64);
+  printf ("    UINT64_C (0x%016lX), %6ld},\n", mpz_get_ui (h), exp);
+  mpz_clear (h);
+  mpz_clear (z);
+  mpfr_clear (t);
+}
+
+static void
+print_header (const char *name)
+{
+  printf ("static const struct\n");
+  printf ("{\n");
+  printf ("  uint64_t mul1;\n");
+  printf ("  uint64_t mul2;\n");
+  printf ("  uint64_t mul3;\n");
+  printf ("  int32_t exp;\n");
+  printf ("} %s[] = {\n", name);
+}
+
+int
+main (void)
+{
+  int i;
+
+  print_header ("qpowers10");
+  for (i = -179; i <= 179; i++) {
+    print_power (i * 28);
+  }
+  printf ("};\n\n");
+  print_header ("qpowers10_28");
+  for (i = 0; i < 28; i++) {
+    print_power (i);
+  }
+  printf ("};\n");
+  mpfr_free_cache ();
+  return 0;
+}
+#endif
+
+static const struct
+{
+  uint64_t mul1;
+  uint64_t mul2;
+  uint64_t mul3;
+  int32_t exp;
+} qpowers10[] = {
+  { /* -5012 */ UINT64_C (0xB491165AC6B0AD76), UINT64_C (0x6DE87D653E43DF31),
+    UINT64_C (0x167AF7E091817718), -16841},
+  { /* -4984 */ UINT64_C (0xB6536903BF8F2BDA), UINT64_C (0x2B55C9E70E00C557),
+    UINT64_C (0xF91044C2EFF84751), -16748},
+  { /* -4956 */ UINT64_C (0xB81A1EC0EBF12AF1), UINT64_C (0xBAD933E1F4E65074),
+    UINT64_C (0x2F883425B19D2EA1), -16655},
+  { /* -4928 */ UINT64_C (0xB9E5428330737362), UINT64_C (0xBDDB2DFDE3F8A6E3),
+    UINT64_C (0x73A7380ABA84A6B2), -16562},
+  { /* -4900 */ UINT64_C (0xBBB4DF56BAF62972), UINT64_C (0x692AA2588216D185),
+    UINT64_C (0x7B616B387630F078), -16469},
+  { /* -4872 */ UINT64_C (0xBD89006346A9A34D), UINT64_C (0x88227FDFC13AB53D),
+    UINT64_C (0x9F165C039EAD6D78), -16376},
+  { /* -4844 */ UINT64_C (0xBF61B0EC60C4F5DC), UINT64_C (0x8EE3A73EE750B831),
+    UINT64_C (0x902435A843049D38), -16283},
+  { /* -4816 */ UINT64_C (0xC13EFC51ADE7DF64), UINT64_C (0xE05FE4207CA3D508),
+    UINT64_C (0x4E3CC383EAA17B7B), -16190},
+  { /* -4788 */ UINT64_C (0xC320EE0F3029BB57), UINT64_C (0xFF5733244E3B6BAA),
+    UINT64_C (0x4F9030164ADCA5BB), -16097},
+  { /* -4760 */ UINT64_C (0xC50791BD8DD72EDB), UINT64_C (0x3C55F3F947FEF0E9),
+    UINT64_C (0x5C67BA58680C4CCF), -16004},
+  { /* -4732 */ UINT64_C (0xC6F2F31258E041C6), UINT64_C (0xAFDE347F46FDB9DF),
+    UINT64_C (0xBDF51671234DCF43), -15911},
+  { /* -4704 */ UINT64_C (0xC8E31DE056F89C19), UINT64_C (0x0915564D8AB057EE),
+    UINT64_C (0x25B0419765FDFCDC), -15818},
+  { /* -4676 */ UINT64_C (0xCAD81E17CA6BA427), UINT64_C (0x08B7D94AF9C24E41),
+    UINT64_C (0x3EA7D007F583C048), -15725},
+  { /* -4648 */ UINT64_C (0xCCD1FFC6BBA63E21), UINT64_C (0x801E38463183FC88),
+    UINT64_C (0xE418E9217CE83755), -15632},
+  { /* -4620 */ UINT64_C (0xCED0CF194377F1EB), UINT64_C (0x77707CAB526FA3EB),
+    UINT64_C (0x83BA23061661070C), -15539},
+  { /* -4592 */ UINT64_C (0xD0D49859D60D40A3), UINT64_C (0xCFADF6B2AA7C4F43),
+    UINT64_C (0xEEA173DA1F0EB7B4), -15446},
+  { /* -4564 */ UINT64_C (0xD2DD67F18EA4F7BA), UINT64_C (0x6819FCBC5DBA0576),
+    UINT64_C (0x6140A7119D834450), -15353},
+  { /* -4536 */ UINT64_C (0xD4EB4A687C0253E8), UINT64_C (0x9E601E707A2C3488),
+    UINT64_C (0x451E855D8ACEF835), -15260},
+  { /* -4508 */ UINT64_C (0xD6FE4C65ED9DCAF0), UINT64_C (0x0910B187A046B5A4),
+    UINT64_C (0xECC6FAA867C880DD), -15167},
+  { /* -4480 */ UINT64_C (0xD9167AB0C1965798), UINT64_C (0xA8EDFFDCCFE4DB4B),
+    UINT64_C (0xF290163350ECB3EC), -15074},
+  { /* -4452 */ UINT64_C (0xDB33E22FB3652809), UINT64_C (0x9B246C227911DB44),
+    UINT64_C (0x3A0C2E45CEEF989D), -14981},
+  { /* -4424 */ UINT64_C (0xDD568FE9AB559344), UINT64_C (0xB17CD86E7FCECE75),
+    UINT64_C (0x4FA1860C08A85923), -14888},
+  { /* -4396 */ UINT64_C (0xDF7E91060EC33F46), UINT64_C (0x5AAFDC42CA320902),
+    UINT64_C (0x41E9A05249628A1D), -14795},
+  { /* -4368 */ UINT64_C (0xE1ABF2CD11206610), UINT64_C (0x1151250681D59705),
+    UINT64_C (0xB19FD88FE285B3BC), -14702},
+  { /* -4340 */ UINT64_C (0xE3DEC2A805C62CB4), UINT64_C (0x38B47F50C3E4979F),
+    UINT64_C (0xEB53CD491DEF5AFF), -14609},
+  { /* -4312 */ UINT64_C (0xE6170E21B2910457), UINT64_C (0x025A8E1E5DBB41D6),
+    UINT64_C (0x361243A84B55574E), -14516},
+  { /* -4284 */ UINT64_C (0xE854E2E6A34B1200), UINT64_C (0xC9D524DFDFE4E2D9),
+    UINT64_C (0x02114B1DE70DF324), -14423},
+  { /* -4256 */ UINT64_C (0xEA984EC57DE69F13), UINT64_C (0x66E849253E5DA0C2),
+    UINT64_C (0x18746FCC6A190DBA), -14330},
+  { /* -4228 */ UINT64_C (0xECE15FAF578A9935), UINT64_C (0x647E32D3C54DF9DD),
+    UINT64_C (0xC9943BED45536C8C), -14237},
+  { /* -4200 */ UINT64_C (0xEF3023B80A732D93), UINT64_C (0xF5A7800F23EF67B8),
+    UINT64_C (0x79C93CFF11F09319), -14144},
+  { /* -4172 */ UINT64_C (0xF184A9168CA89077), UINT64_C (0x07776B7971F752FD),
+    UINT64_C (0xC1DC69A3AEDA674C), -14051},
+  { /* -4144 */ UINT64_C (0xF3DEFE25478E074A), UINT64_C (0x0E85FC7F4EDBD3CA),
+    UINT64_C (0xBEC466EE1B586343), -13958},
+  { /* -4116 */ UINT64_C (0xF63F3162704B5070), UINT64_C (0x48FE1D3430B5E548),
+    UINT64_C (0x6DA0190711C4BFD9), -13865},
+  { /* -4088 */ UINT64_C (0xF8A551706112897C), UINT64_C (0x4268A54F70BD28C4),
+    UINT64_C (0xAE16192410D3135F), -13772},
+  { /* -4060 */ UINT64_C (0xFB116D15F344B9B0), UINT64_C (0x953D136B9A19CDB5),
+    UINT64_C (0x3CC4FE5541A1306D), -13679},
+  { /* -4032 */ UINT64_C (0xFD83933EDA772C0B), UINT64_C (0x5052E9289F0F2333),
+    UINT64_C (0x48324E275376DFDE), -13586},
+  { /* -4004 */ UINT64_C (0xFFFBD2FC005BC986), UINT64_C (0x2C9AF917DDC988C9),
+    UINT64_C (0x7B12111BA63A154F), -13493},
+  { /* -3976 */ UINT64_C (0x813D1DC1F0C754D6), UINT64_C (0x01B02378A405B421),
+    UINT64_C (0x24FED95087B9006F), -13399},
+  { /* -3948 */ UINT64_C (0x827F6E1975A58A93), UINT64_C (0xEC2CAA7B143CE01A),
+    UINT64_C (0x416C8344A6AC53FE), -13306},
+  { /* -3920 */ UINT64_C (0x83C4E245ED051DC1), UINT64_C (0xB782DB1FC6ABA49B),
+    UINT64_C (0x15617DA021B89F93), -13213},
+  { /* -3892 */ UINT64_C (0x850D821C0C86F175), UINT64_C (0x753F080DAB88EE0A),
+    UINT64_C (0x3BDE0F304ECBD4B0), -13120},
+  { /* -3864 */ UINT64_C (0x86595584116CAF3C), UINT64_C (0x4250BE2EEBA87D15),
+    UINT64_C (0x2217669197AC1505), -13027},
+  { /* -3836 */ UINT64_C (0x87A86479F14D8EA3), UINT64_C (0x9031FECC0841642D),
+    UINT64_C (0xD30DC3177EFE8C6E), -12934},
+  { /* -3808 */ UINT64_C (0x88FAB70D8B44952A), UINT64_C (0x3F1F93F1943CA9B6),
+    UINT64_C (0x44A66A6D6FD6537B), -12841},
+  { /* -3780 */ UINT64_C (0x8A505562D9997D8A), UINT64_C (0x268889F30FC7A120),
+    UINT64_C (0xC4680D187059864A), -12748},
+  { /* -3752 */ UINT64_C (0x8BA947B223E5783E), UINT64_C (0x2C87F18B39478AA2),
+    UINT64_C (0xDE5BD4572C25A831), -12655},
+  { /* -3724 */ UINT64_C (0x8D05964831B4FA23), UINT64_C (0xED1E8AD53278B981),
+    UINT64_C (0x88762E9B4958C7EC), -12562},
+  { /* -3696 */ UINT64_C (0x8E6549867DA7D11A), UINT64_C (0x4054F5360249EBD1),
+    UINT64_C (0x292F8F2C98D7F44D), -12469},
+  { /* -3668 */ UINT64_C (0x8FC869E36910B987), UINT64_C (0xBDFB5DAA8751F12B),
+    UINT64_C (0x88AB70F5ADED9343), -12376},
+  { /* -3640 */ UINT64_C (0x912EFFEA7015B2C5), UINT64_C (0xC1187FA0C18ADBBE),
+    UINT64_C (0x1789061D717D454D), -12283},
+  { /* -3612 */ UINT64_C (0x9299143C5E525385), UINT64_C (0x772CED20F3BE4933),
+    UINT64_C (0xC6F653CDE0DD0D7B), -12190},
+  { /* -3584 */ UINT64_C (0x9406AF8F83FD6265), UINT64_C (0x4B4DE34E0EBC3E06),
+    UINT64_C (0x45EFB05F20CF48B4), -12097},
+  { /* -3556 */ UINT64_C (0x9577DAAFEB92FA15), UINT64_C (0x8E08F0978AC01650),
+    UINT64_C (0x546D85C24FBE8C58), -12004},
+  { /* -3528 */ UINT64_C (0x96EC9E7F9004839B), UINT64_C (0xAC73F0226EFF5EA1),
+    UINT64_C (0x3BD8754763BDBCA2), -11911},
+  { /* -3500 */ UINT64_C (0x986503F6936FD47B), UINT64_C (0xAE686CF29A7B688D),
+    UINT64_C (0x0CC344899CB13E23), -11818},
+  { /* -3472 */ UINT64_C (0x99E11423765EC1D0), UINT64_C (0x2184706EA46A4C38),
+    UINT64_C (0x72E93FE0CCE7CFD9), -11725},
+  { /* -3444 */ UINT64_C (0x9B60D82B4F907CA1), UINT64_C (0x202C9C950E81F6F2),
+    UINT64_C (0x30EA39BB715CF96D), -11632},
+  { /* -3416 */ UINT64_C (0x9CE4594A044E0F1B), UINT64_C (0xDDADB80577B906BD),
+    UINT64_C (0xD3DE560EE34022B2), -11539},
+  { /* -3388 */ UINT64_C (0x9E6BA0D2814B55A5), UINT64_C (0x1F2A6E9BA997D195),
+    UINT64_C (0x62A12389CA3E5B88), -11446},
+  { /* -3360 */ UINT64_C (0x9FF6B82EF415D222), UINT64_C (0x60DBD8AA443B560F),
+    UINT64_C (0x7A466A75BE73DB21), -11353},
+  { /* -3332 */ UINT64_C (0xA185A8E10512BB3F), UINT64_C (0x2D22A5F73DE44D43),
+    UINT64_C (0x4A3FE8FA377A0E55), -11260},
+  { /* -3304 */ UINT64_C (0xA3187C82120DACE6), UINT64_C (0x7401C6F091F87727),
+    UINT64_C (0x08251C601E346456), -11167},
+  { /* -3276 */ UINT64_C (0xA4AF3CC3695962A2), UINT64_C (0x9314C38AF248CEAC),
+    UINT64_C (0x9637A30CADAE3EC2), -11074},
+  { /* -3248 */ UINT64_C (0xA649F36E8583E81A), UINT64_C (0x4D5B32F713D7F476),
+    UINT64_C (0xF369A11C6F66C05B), -10981},
+  { /* -3220 */ UINT64_C (0xA7E8AA65499FAF6D), UINT64_C (0x44ED06A6C73283F1),
+    UINT64_C (0xF39F4D4B8200A2FF), -10888},
+  { /* -3192 */ UINT64_C (0xA98B6BA23E2300C7), UINT64_C (0xB4B39DD9DDB8D317),
+    UINT64_C (0x3ADF30FF2EB163D5), -10795},
+  { /* -3164 */ UINT64_C (0xAB324138CE5F3A23), UINT64_C (0x43AB66AA259BB140),
+    UINT64_C (0xF036871B88F19096), -10702},
+  { /* -3136 */ UINT64_C (0xACDD3555869159D1), UINT64_C (0xEC41C1793D69D0D1),
+    UINT64_C (0x1C5AF3BD4D2C60B5), -10609},
+  { /* -3108 */ UINT64_C (0xAE8C523E528D5220), UINT64_C (0x2F9B11C68554E06E),
+    UINT64_C (0x0C677417D1FD7899), -10516},
+  { /* -3080 */ UINT64_C (0xB03FA252BD05A815), UINT64_C (0x3CA5A7540D9D56C9),
+    UINT64_C (0x71043692494AA743), -10423},
+  { /* -3052 */ UINT64_C (0xB1F7300C2F70E31A), UINT64_C (0x6CC8610FE1204DB5),
+    UINT64_C (0xB1AED19FE32AC8C6), -10330},
+  { /* -3024 */ UINT64_C (0xB3B305FE328E571F), UINT64_C (0x92E1BC1FBB33F18D),
+    UINT64_C (0x47C9B16AFE8FDF75), -10237},
+  { /* -2996 */ UINT64_C (0xB5732ED6AF8BD6A7), UINT64_C (0x2C9155C7F2F76A10),
+    UINT64_C (0x09002A81DDE70E28), -10144},
+  { /* -2968 */ UINT64_C (0xB737B55E31CDDE04), UINT64_C (0xA908FD4A88728B6A),
+    UINT64_C (0xAC46A7B3F2B4B34E), -10051},
+  { /* -2940 */ UINT64_C (0xB900A478295BCCFF), UINT64_C (0xC3BC70DAED20545D),
+    UINT64_C (0x9BBCD82CC75D8EE0),  -9958},
+  { /* -2912 */ UINT64_C (0xBACE07232DF1C802), UINT64_C (0x7C4C65D15C614C56),
+    UINT64_C (0x359A8FA0D014B9A8),  -9865},
+  { /* -2884 */ UINT64_C (0xBC9FE87942B9DDF3), UINT64_C (0x984B360DB52F4726),
+    UINT64_C (0x8CD15B39ED26708F),  -9772},
+  { /* -2856 */ UINT64_C (0xBE7653B01AAE13E5), UINT64_C (0xEF84CC99CB4C5D17),
+    UINT64_C (0xFB4D9440822AF452),  -9679},
+  { /* -2828 */ UINT64_C (0xC05154195DA4FBD5), UINT64_C (0x2112BEF1B26149FE),
+    UINT64_C (0x70ED0DD82541D1B3),  -9586},
+  { /* -2800 */ UINT64_C (0xC230F522EE0A7FC2), UINT64_C (0xCFC147ADE4843A24),
+    UINT64_C (0x75913092420C9B35),  -9493},
+  { /* -2772 */ UINT64_C (0xC41542572F468EAC), UINT64_C (0x4068E186399DC435),
+    UINT64_C (0x845621B7F2F1C213),  -9400},
+  { /* -2744 */ UINT64_C (0xC5FE475D4CD35CFF), UINT64_C (0x4668677D5F46C29B),
+    UINT64_C (0x860A754894B9A0BD),  -9307},
+  { /* -2716 */ UINT64_C (0xC7EC0FF98204EE6E), UINT64_C (0xEB22603AA63048D9),
+    UINT64_C (0x825737717376CE12),  -9214},
+  { /* -2688 */ UINT64_C (0xC9DEA80D6283A34C), UINT64_C (0x474B3CB1FE1D6A7F),
+    UINT64_C (0x9FB576046AB35018),  -9121},
+  { /* -2660 */ UINT64_C (0xCBD61B98237B87D6), UINT64_C (0xB23C80CFBE16ABC0),
+    UINT64_C (0x5C6DB3249A439732),  -9028},
+  { /* -2632 */ UINT64_C (0xCDD276B6E582284F), UINT64_C (0xD6EA3B733029EF0B),
+    UINT64_C (0x8CA223055819AF55),  -8935},
+  { /* -2604 */ UINT64_C (0xCFD3C5A4FF34B104), UINT64_C (0x824F4075B7D3949B),
+    UINT64_C (0x0EDF5415A6FB803B),  -8842},
+  { /* -2576 */ UINT64_C (0xD1DA14BC489025EA), UINT64_C (0x3736730A9E47FEF8),
+    UINT64_C (0xC9879FC42869F611),  -8749},
+  { /* -2548 */ UINT64_C (0xD3E57075670581EB), UINT64_C (0xDA84BEAC12680510),
+    UINT64_C (0x2362CF9A1702089E),  -8656},
+  { /* -2520 */ UINT64_C (0xD5F5E5681A4B9285), UINT64_C (0x3D24E68DC1027246),
+    UINT64_C (0xCB8EDAE81A295888),  -8563},
+  { /* -2492 */ UINT64_C (0xD80B804B89F068DE), UINT64_C (0x014DA5D423752D8B),
+    UINT64_C (0x1FDEE7377F535295),  -8470},
+  { /* -2464 */ UINT64_C (0xDA264DF693AC3E30), UINT64_C (0x742AB8F3864562C8),
+    UINT64_C (0x9D19C341F5F42F2B),  -8377},
+  { /* -2436 */ UINT64_C (0xDC465B601A77ADF0), UINT64_C (0x8F5F77DFDC869AC6),
+    UINT64_C (0x48FA222B596BCE81),  -8284},
+  { /* -2408 */ UINT64_C (0xDE6BB59F56672CDA), UINT64_C (0x8C119F3680212413),
+    UINT64_C (0xE0EE47C041C9DE0F),  -8191},
+  { /* -2380 */ UINT64_C (0xE09669EC254DA8CF), UINT64_C (0x60203BCBC6354D53),
+    UINT64_C (0x5046B76DFFD59F92),  -8098},
+  { /* -2352 */ UINT64_C (0xE2C6859F5C284230), UINT64_C (0x43190B523F872B9C),
+    UINT64_C (0x9D76EEF2C1543E66),  -8005},
+  { /* -2324 */ UINT64_C (0xE4FC163319551441), UINT64_C (0x10EAA1481B149E5A),
+    UINT64_C (0x96475208DAA03EE3),  -7912},
+  { /* -2296 */ UINT64_C (0xE7372943179706FC), UINT64_C (0x2A0969BF88679396),
+    UINT64_C (0x777C9B2DFBEDE07A),  -7819},
+  { /* -2268 */ UINT64_C (0xE977CC8D01E8A9B1), UINT64_C (0x69D9C1F7D0B33E49),
+    UINT64_C (0xBF3561B01F53D6B5),  -7726},
+  { /* -2240 */ UINT64_C (0xEBBE0DF0C8201AC5), UINT64_C (0x131565BE33DDA91A),
+    UINT64_C (0x0CCC12293F1D7A59),  -7633},
+  { /* -2212 */ UINT64_C (0xEE09FB70F46605EB), UINT64_C (0x453DBEA8FF260AC2),
+    UINT64_C (0xB20087758CA3660C),  -7540},
+  { /* -2184 */ UINT64_C (0xF05BA3330181C750), UINT64_C (0xCCFB1CC2EF1F44DE),
+    UINT64_C (0xEB2106F435F7E1D6),  -7447},
+  { /* -2156 */ UINT64_C (0xF2B3137FB1FCC743), UINT64_C (0x0AD3B225CC56A181),
+    UINT64_C (0x0AD4D6C47A9BD719),  -7354},
+  { /* -2128 */ UINT64_C (0xF5105AC3681F2716), UINT64_C (0x5F8385B3A882FF4C),
+    UINT64_C (0x796D0A8120801513),  -7261},
+  { /* -2100 */ UINT64_C (0xF773878E7EC7DD45), UINT64_C (0x2B566EF4CAF507B0),
+    UINT64_C (0xA785FA19E0323F4B),  -7168},
+  { /* -2072 */ UINT64_C (0xF9DCA895A3226409), UINT64_C (0x166C15F456786C27),
+    UINT64_C (0x23CB9E9DF9331FE5),  -7075},
+  { /* -2044 */ UINT64_C (0xFC4BCCB22F3C2305), UINT64_C (0x2B49C17CF287A651),
+    UINT64_C (0x6CAAD086340FA017),  -6982},
+  { /* -2016 */ UINT64_C (0xFEC102E2857BC1F9), UINT64_C (0x6C656C3B1F2C9D91),
+    UINT64_C (0xEA8242B0030E4A52),  -6889},
+  { /* -1988 */ UINT64_C (0x809E2D25367E4BF4), UINT64_C (0x0CC90239661BB26E),
+    UINT64_C (0x82A82F59E8A3B2F0),  -6795},
+  { /* -1960 */ UINT64_C (0x81DEF119B76837C8), UINT64_C (0xFA70B9A2CA60B004),
+    UINT64_C (0x6188DB81AC8E775E),  -6702},
+  { /* -1932 */ UINT64_C (0x8322D5069A14EFDC), UINT64_C (0xD0BE910FA323527C),
+    UINT64_C (0x905579E0031825C0),  -6609},
+  { /* -1904 */ UINT64_C (0x8469E0B6F2B8BD9B), UINT64_C (0x6A22490E8E9EC98B),
+    UINT64_C (0xE7DF06BC613FDA22),  -6516},
+  { /* -1876 */ UINT64_C (0x85B41C0945241144), UINT64_C (0x5015E086841D2C28),
+    UINT64_C (0xDBE034A37D0FB574),  -6423},
+  { /* -1848 */ UINT64_C (0x87018EEFB53C6325), UINT64_C (0x69138459B0FA72D4),
+    UINT64_C (0x469CFD2E6CA32A78),  -6330},
+  { /* -1820 */ UINT64_C (0x8852417037EDF7DA), UINT64_C (0x9A8A962EDA71E86D),
+    UINT64_C (0x2425940E875A525B),  -6237},
+  { /* -1792 */ UINT64_C (0x89A63BA4C497B50E), UINT64_C (0x6C83AD1260FF20F4),
+    UINT64_C (0xC098E6ED0BFBD6F7),  -6144},
+  { /* -1764 */ UINT64_C (0x8AFD85BB86F23727), UINT64_C (0x9F2BBAD927B779D1),
+    UINT64_C (0x87D2DA5CACFF74CC),  -6051},
+  { /* -1736 */ UINT64_C (0x8C5827F711735B46), UINT64_C (0xD82EF2860273DE8D),
+    UINT64_C (0xE02017175BF040C7),  -5958},
+  { /* -1708 */ UINT64_C (0x8DB62AAE902F73F6), UINT64_C (0x28E92E707150BC1E),
+    UINT64_C (0x24B2CEAF352C2B8F),  -5865},
+  { /* -1680 */ UINT64_C (0x8F17964DFC3961F2), UINT64_C (0x416D7F9AB1E67580),
+    UINT64_C (0x5F07E1E10097D47F),  -5772},
+  { /* -1652 */ UINT64_C (0x907C73564F82CD82), UINT64_C (0xC1E15A2C8FF4DF56),
+    UINT64_C (0x2D7D782820BDD8A9),  -5679},
+  { /* -1624 */ UINT64_C (0x91E4CA5DB93DBFEC), UINT64_C (0x56700866B85D57FE),
+    UINT64_C (0x8B6648E941DE779C),  -5586},
+  { /* -1596 */ UINT64_C (0x9350A40FD2C0DFA4), UINT64_C (0x352E1FC6A1AADA9A),
+    UINT64_C (0x2BC9780C2C9585E1),  -5493},
+  { /* -1568 */ UINT64_C (0x94C0092DD4EF9511), UINT64_C (0x43CF71D5C4FD7868),
+    UINT64_C (0x64D1F15DA2C146B2),  -5400},
+  { /* -1540 */ UINT64_C (0x9633028ECE2760D3), UINT64_C (0xB070FBDE944761C0),
+    UINT64_C (0xF8E996EE82D073FA),  -5307},
+  { /* -1512 */ UINT64_C (0x97A9991FD8B3AFC0), UINT64_C (0x387898A6E22F821B),
+    UINT64_C (0x9B6122AA2B72A13D),  -5214},
+  { /* -1484 */ UINT64_C (0x9923D5E451C97BF8), UINT64_C (0xC66B5979A2CE2EF5),
+    UINT64_C (0xBB2FAB29723EE9B9),  -5121},
+  { /* -1456 */ UINT64_C (0x9AA1C1F6110C0DD0), UINT64_C (0x8F8857E875E7774E),
+    UINT64_C (0xE415D8B25694250A),  -5028},
+  { /* -1428 */ UINT64_C (0x9C236685A09C3276), UINT64_C (0x801125C857604CA5),
+    UINT64_C (0xC299396ED72EDA26),  -4935},
+  { /* -1400 */ UINT64_C (0x9DA8CCDA75B341B5), UINT64_C (0xA5C58D5F91A476D7),
+    UINT64_C (0xF36D1AD779B90E0A),  -4842},
+  { /* -1372 */ UINT64_C (0x9F31FE5329CB4F78), UINT64_C (0x77BB986469851F56),
+    UINT64_C (0x33F5AF8287145AD7),  -4749},
+  { /* -1344 */ UINT64_C (0xA0BF0465B455E921), UINT64_C (0x6E1F7F1642EBAAC8),
+    UINT64_C (0x2822E38FAF74B26E),  -4656},
+  { /* -1316 */ UINT64_C (0xA24FE89FA502C239), UINT64_C (0x68758CBF71B19436),
+    UINT64_C (0x07D4829DF54951F7),  -4563},
+  { /* -1288 */ UINT64_C (0xA3E4B4A65E97B76A), UINT64_C (0xFAD2BE1679765F27),
+    UINT64_C (0x6BF3EEA6F661A32B),  -4470},
+  { /* -1260 */ UINT64_C (0xA57D7237525B9240), UINT64_C (0xF77D1A9FF40226F3),
+    UINT64_C (0x72F87F98C7AD4700),  -4377},
+  { /* -1232 */ UINT64_C (0xA71A2B283C14FBA6), UINT64_C (0x800CFAB80C4E2EB1),
+    UINT64_C (0x6F6583B5B36D5426),  -4284},
+  { /* -1204 */ UINT64_C (0xA8BAE9675E9F0EB7), UINT64_C (0xAD3CB74FD4CAC6DE),
+    UINT64_C (0xDB5F9D8B91221796),  -4191},
+  { /* -1176 */ UINT64_C (0xAA5FB6FBC115010B), UINT64_C (0x850B0C5976B21027),
+    UINT64_C (0xA825F32BC8F6B081),  -4098},
+  { /* -1148 */ UINT64_C (0xAC089E056C965942), UINT64_C (0x99DAEEEDE2E0EB1B),
+    UINT64_C (0xD74E99C585B36DA9),  -4005},
+  { /* -1120 */ UINT64_C (0xADB5A8BDAAA53051), UINT64_C (0x61363686961A41E5),
+    UINT64_C (0x2862B1F61D64DDC3),  -3912},
+  { /* -1092 */ UINT64_C (0xAF66E177441FFDB2), UINT64_C (0x2C638FCBB822F998),
+    UINT64_C (0x5A3C65638E81ABFC),  -3819},
+  { /* -1064 */ UINT64_C (0xB11C529EC0D87268), UINT64_C (0xC6F075C4B81FC72D),
+    UINT64_C (0x6D282FE1B711287A),  -3726},
+  { /* -1036 */ UINT64_C (0xB2D606BAA7C8EA89), UINT64_C (0x2EB30A609088263E),
+    UINT64_C (0x58C728940F715BB7),  -3633},
+  { /* -1008 */ UINT64_C (0xB494086BBFEA00C3), UINT64_C (0xB4E4BE5B6455EF96),
+    UINT64_C (0x3739F15B06AC3C77),  -3540},
+  { /*  -980 */ UINT64_C (0xB656626D51A9D353), UINT64_C (0x384EFD538D690C57),
+    UINT64_C (0x4CA4B33961A6653A),  -3447},
+  { /*  -952 */ UINT64_C (0xB81D1F9569068D8E), UINT64_C (0x24D256C540A50309),
+    UINT64_C (0x6E33CDCDA4367277),  -3354},
+  { /*  -924 */ UINT64_C (0xB9E84AD5184DCD48), UINT64_C (0x94CDE1BA3CFCA943),
+    UINT64_C (0x6C8078D99A0C4DB5),  -3261},
+  { /*  -896 */ UINT64_C (0xBBB7EF38BB827F2D), UINT64_C (0x6D4AA5B50BB5DC0D),
+    UINT64_C (0x00DE73D9D5BE6974),  -3168},
+  { /*  -868 */ UINT64_C (0xBD8C17E83C6AD135), UINT64_C (0xAEBCC797B23B9BB6),
+    UINT64_C (0x6B0F89D3725B7E91),  -3075},
+  { /*  -840 */ UINT64_C (0xBF64D0275747DE70), UINT64_C (0x925624C0D7D93317),
+    UINT64_C (0x1FB6069F8B26F840),  -2982},
+  { /*  -812 */ UINT64_C (0xC1422355E038BB64), UINT64_C (0x8035810006A8CFB6),
+    UINT64_C (0xE97C2E9D000B45D5),  -2889},
+  { /*  -784 */ UINT64_C (0xC3241CF0094A8E70), UINT64_C (0x8E5A2E5116BAF191),
+    UINT64_C (0x6D60D02EAC6309EF),  -2796},
+  { /*  -756 */ UINT64_C (0xC50AC88EA93763C0), UINT64_C (0x249494D1BF7C86EC),
+    UINT64_C (0x19DFAD135D617905),  -2703},
+  { /*  -728 */ UINT64_C (0xC6F631E782D57096), UINT64_C (0xB0560C246F90E9E8),
+    UINT64_C (0x069CF8F51D2E5E65),  -2610},
+  { /*  -700 */ UINT64_C (0xC8E664CD8D387DF8), UINT64_C (0x1E2BD23627C69801),
+    UINT64_C (0xF6EDF0DF20D7694B),  -2517},
+  { /*  -672 */ UINT64_C (0xCADB6D313C8736FC), UINT64_C (0x2FFFF1289A804C5A),
+    UINT64_C (0xC26FFB8E81532726),  -2424},
+  { /*  -644 */ UINT64_C (0xCCD55720CB861B6E), UINT64_C (0xD95729515330F114),
+    UINT64_C (0x20194BE85E11CDE2),  -2331},
+  { /*  -616 */ UINT64_C (0xCED42EC885D9DBBE), UINT64_C (0xA855E127113C887B),
+    UINT64_C (0xC02B302A892B81DC),  -2238},
+  { /*  -588 */ UINT64_C (0xD0D800731302E7A4), UINT64_C (0x064B9E215703F17F),
+    UINT64_C (0xFF3C41E51B2B0BE1),  -2145},
+  { /*  -560 */ UINT64_C (0xD2E0D889C213FD60), UINT64_C (0xE00BAD8DFC0D8C8E),
+    UINT64_C (0x72DB3BC15B0C7015),  -2052},
+  { /*  -532 */ UINT64_C (0xD4EEC394D6258BF8), UINT64_C (0x28E54542D9B56DC9),
+    UINT64_C (0x25F32BBBF830C76A),  -1959},
+  { /*  -504 */ UINT64_C (0xD701CE3BD387BF47), UINT64_C (0xC654D07271E6C39F),
+    UINT64_C (0xA116409A2FDF1E9F),  -1866},
+  { /*  -476 */ UINT64_C (0xD91A0545CDB51185), UINT64_C (0xE287C2AD77EAD647),
+    UINT64_C (0xD6AA698A7F1F5D32),  -1773},
+  { /*  -448 */ UINT64_C (0xDB377599B6074244), UINT64_C (0x84C663CEE6B86E7C),
+    UINT64_C (0x2726C48A85389FA7),  -1680},
+  { /*  -420 */ UINT64_C (0xDD5A2C3EAB3097CB), UINT64_C (0xBD54467EEC6DD2BB),
+    UINT64_C (0x56E9FBCAF309D79C),  -1587},
+  { /*  -392 */ UINT64_C (0xDF82365C497B5453), UINT64_C (0xCB285CEB2FED040D),
+    UINT64_C (0x8BF77D4BC59B35B2),  -1494},
+  { /*  -364 */ UINT64_C (0xE1AFA13AFBD14D6D), UINT64_C (0x82189C09A3A1EC21),
+    UINT64_C (0x7A43516213C7E04C),  -1401},
+  { /*  -336 */ UINT64_C (0xE3E27A444D8D98B7), UINT64_C (0xFD1B1B2308169B25),
+    UINT64_C (0x363B1F2C568DC3E2),  -1308},
+  { /*  -308 */ UINT64_C (0xE61ACF033D1A45DF), UINT64_C (0x6FB92487298E33BD),
+    UINT64_C (0xADD7728C20B99BD2),  -1215},
+  { /*  -280 */ UINT64_C (0xE858AD248F5C22C9), UINT64_C (0xD1B3400F8F9CFF68),
+    UINT64_C (0xF910F9F648232F14),  -1122},
+  { /*  -252 */ UINT64_C (0xEA9C227723EE8BCB), UINT64_C (0x465E15A979C1CADC),
+    UINT64_C (0x0A0CE827EAC11F2E),  -1029},
+  { /*  -224 */ UINT64_C (0xECE53CEC4A314EBD), UINT64_C (0xA4F8BF5635246428),
+    UINT64_C (0x4609AC5C7899CA37),   -936},
+  { /*  -196 */ UINT64_C (0xEF340A98172AACE4), UINT64_C (0x86FB897116C87C34),
+    UINT64_C (0x9C39C1DA4C49278E),   -843},
+  { /*  -168 */ UINT64_C (0xF18899B1BC3F8CA1), UINT64_C (0xDC44E6C3CB279AC1),
+    UINT64_C (0xF80F36174730CA35),   -750},
+  { /*  -140 */ UINT64_C (0xF3E2F893DEC3F126), UINT64_C (0x5A89DBA3C3EFCCFA),
+    UINT64_C (0xD8ECB58659BE9C91),   -657},
+  { /*  -112 */ UINT64_C (0xF64335BCF065D37D), UINT64_C (0x4D4617B5FF4A16D5),
+    UINT64_C (0xAA09501D5954A55A),   -564},
+  { /*   -84 */ UINT64_C (0xF8A95FCF88747D94), UINT64_C (0x75A44C6397CE912A),
+    UINT64_C (0x33CCA6C06B07B74E),   -471},
+  { /*   -56 */ UINT64_C (0xFB158592BE068D2E), UINT64_C (0xEED6E2F0F0D56712),
+    UINT64_C (0xAC2E4F162CFAD40B),   -378},
+  { /*   -28 */ UINT64_C (0xFD87B5F28300CA0D), UINT64_C (0x8BCA9D6E188853FC),
+    UINT64_C (0x76DCB60081CE0FA6),   -285},
+  { /*     0 */ UINT64_C (0x8000000000000000), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -191},
+  { /*    28 */ UINT64_C (0x813F3978F8940984), UINT64_C (0x4000000000000000),
+    UINT64_C (0x0000000000000000),    -98},
+  { /*    56 */ UINT64_C (0x82818F1281ED449F), UINT64_C (0xBFF8F10E7A8921A4),
+    UINT64_C (0x2000000000000000),     -5},
+  { /*    84 */ UINT64_C (0x83C7088E1AAB65DB), UINT64_C (0x792667C6DA79E0FA),
+    UINT64_C (0x0861D3EE22D1CC53),     88},
+  { /*   112 */ UINT64_C (0x850FADC09923329E), UINT64_C (0x03E2CF6BC604DDB0),
+    UINT64_C (0x74A7EF0198791097),    181},
+  { /*   140 */ UINT64_C (0x865B86925B9BC5C2), UINT64_C (0x0B8A2392BA45A9B2),
+    UINT64_C (0x5C6658D409FB8BF7),    274},
+  { /*   168 */ UINT64_C (0x87AA9AFF79042286), UINT64_C (0x90FB44D2F05D0842),
+    UINT64_C (0xFB118FC9C217A1D3),    367},
+  { /*   196 */ UINT64_C (0x88FCF317F22241E2), UINT64_C (0x441FECE3BDF81F03),
+    UINT64_C (0x12F274928400100D),    460},
+  { /*   224 */ UINT64_C (0x8A5296FFE33CC92F), UINT64_C (0x82BD6B70D99AAA6F),
+    UINT64_C (0xBC10C5C5CDA97C8E),    553},
+  { /*   252 */ UINT64_C (0x8BAB8EEFB6409C1A), UINT64_C (0x1AD089B6C2F7548E),
+    UINT64_C (0x25C7B885BA466E37),    646},
+  { /*   280 */ UINT64_C (0x8D07E33455637EB2), UINT64_C (0xDB0B487B6423E1E8),
+    UINT64_C (0x7EC63730F500B407),    739},
+  { /*   308 */ UINT64_C (0x8E679C2F5E44FF8F), UINT64_C (0x570F09EAA7EA7648),
+    UINT64_C (0x5961DB50C6D2B887),    832},
+  { /*   336 */ UINT64_C (0x8FCAC257558EE4E6), UINT64_C (0x213A4F0AA5E8A7B1),
+    UINT64_C (0x949063D8A46F0C0E),    925},
+  { /*   364 */ UINT64_C (0x91315E37DB165AA9), UINT64_C (0x2C0DE8DD3D020C0C),
+    UINT64_C (0x19FAF269CA0434F5),   1018},
+  { /*   392 */ UINT64_C (0x929B7871DE7F22B9), UINT64_C (0x1C306F5D1B0B5FDF),
+    UINT64_C (0x202D895116AA96BE),   1111},
+  { /*   420 */ UINT64_C (0x940919BBD4620B6D), UINT64_C (0x250535BCC387778E),
+    UINT64_C (0xA987E2D026EB98FF),   1204},
+  { /*   448 */ UINT64_C (0x957A4AE1EBF7F3D3), UINT64_C (0xA7EA9C8838CE9437),
+    UINT64_C (0x3C11D8430D5C4803),   1297},
+  { /*   476 */ UINT64_C (0x96EF14C6454AA840), UINT64_C (0x4CF76E8DF8D89498),
+    UINT64_C (0x45DF5607E39C3BBD),   1390},
+  { /*   504 */ UINT64_C (0x9867806127ECE4F4), UINT64_C (0xBF1D49CACCCD5E68),
+    UINT64_C (0x284BA600EE9F6303),   1483},
+  { /*   532 */ UINT64_C (0x99E396C13A3ACFF1), UINT64_C (0xB0C5560A402AC0B2),
+    UINT64_C (0xA8B0AAEE1D1EA5EC),   1576},
+  { /*   560 */ UINT64_C (0x9B63610BB9243E46), UINT64_C (0x655494C5C95D77F2),
+    UINT64_C (0x73F26EB82F6B8067),   1669},
+  { /*   588 */ UINT64_C (0x9CE6E87CB0821C85), UINT64_C (0xC3BFBAE0F3E130E2),
+    UINT64_C (0xA8695AD25784C118),   1762},
+  { /*   616 */ UINT64_C (0x9E6E366733F85561), UINT64_C (0x02E008393FD60B55),
+    UINT64_C (0x8F868688F8EB79EB),   1855},
+  { /*   644 */ UINT64_C (0x9FF95435986594C9), UINT64_C (0x6632249F8A06C2C6),
+    UINT64_C (0x9F65FD031AC4463A),   1948},
+  { /*   672 */ UINT64_C (0xA1884B69ADE24964), UINT64_C (0x55E04DBA4B3BD4DD),
+    UINT64_C (0x84C10A1D22F5ADC5),   2041},
+  { /*   700 */ UINT64_C (0xA31B259CFA50498F), UINT64_C (0x7478A3CBBA44EC48),
+    UINT64_C (0x829669DF04ADC7F0),   2134},
+  { /*   728 */ UINT64_C (0xA4B1EC80F47C84AD), UINT64_C (0x44B222741EB1EBBF),
+    UINT64_C (0x1FC02370C451A756),   2227},
+  { /*   756 */ UINT64_C (0xA64CA9DF3FD42CF6), UINT64_C (0x8F96BEE42FDA4243),
+    UINT64_C (0x7A0E5D37872CDA01),   2320},
+  { /*   784 */ UINT64_C (0xA7EB6799E8AEC999), UINT64_C (0x1CF4A5C3BC09FA6F),
+    UINT64_C (0x75933380CEB5048D),   2413},
+  { /*   812 */ UINT64_C (0xA98E2FABA12EA481), UINT64_C (0x8AF70B7BE4ECB750),
+    UINT64_C (0xD74C6BEAF1400CE7),   2506},
+  { /*   840 */ UINT64_C (0xAB350C27FEB90ACC), UINT64_C (0x3C4A575151B294DC),
+    UINT64_C (0x802C4085068D2DD5),   2599},
+  { /*   868 */ UINT64_C (0xACE0073BB807DA80), UINT64_C (0x8480950470D805ED),
+    UINT64_C (0xA4ACD4C47F0F7A51),   2692},
+  { /*   896 */ UINT64_C (0xAE8F2B2CE3D5DBE9), UINT64_C (0x870A8D87239D8F35),
+    UINT64_C (0x412FE9E72AFD355F),   2785},
+  { /*   924 */ UINT64_C (0xB042825B38276899), UINT64_C (0xBCC0502652E7E71D),
+    UINT64_C (0xF301868AB06AFBF9),   2878},
+  { /*   952 */ UINT64_C (0xB1FA17404A30E5E8), UINT64_C (0xDD929F09C3EFF5AC),
+    UINT64_C (0xE53FD3FCB5B4DF26),   2971},
+  { /*   980 */ UINT64_C (0xB3B5F46FCEDC9C88), UINT64_C (0x16C0208E3CC9E873),
+    UINT64_C (0xC297F40D3A873787),   3064},
+  { /*  1008 */ UINT64_C (0xB5762497DBF17A9E), UINT64_C (0x1931B583A9431D7E),
+    UINT64_C (0x37ED82FE9C75FCCF),   3157},
+  { /*  1036 */ UINT64_C (0xB73AB28129DC51BB), UINT64_C (0xBF0F83FB9A0D7ED7),
+    UINT64_C (0xC957CB550637CC7F),   3250},
+  { /*  1064 */ UINT64_C (0xB903A90F561D25E2), UINT64_C (0xE30DB03E0F8DD286),
+    UINT64_C (0x6A7669BDFC6F699D),   3343},
+  { /*  1092 */ UINT64_C (0xBAD11341265A26CB), UINT64_C (0x9F7165AE2B921943),
+    UINT64_C (0x6616AF5CF28A40F4),   3436},
+  { /*  1120 */ UINT64_C (0xBCA2FC30CC19F090), UINT64_C (0x9EB5CB19647508C5),
+    UINT64_C (0x7FE40DEFE17E55F6),   3529},
+  { /*  1148 */ UINT64_C (0xBE796F142926B4F1), UINT64_C (0x8C9281465B0C0F44),
+    UINT64_C (0x72D3FD8363035FDB),   3622},
+  { /*  1176 */ UINT64_C (0xC054773D149BF26B), UINT64_C (0x24BD4C00042AD125),
+    UINT64_C (0x0DBB1C416EBE6620),   3715},
+  { /*  1204 */ UINT64_C (0xC2342019A0A0627E), UINT64_C (0xEE1F4EA0CEC13421),
+    UINT64_C (0xEE5EB474FA341E22),   3808},
+  { /*  1232 */ UINT64_C (0xC418753460CDCCA9), UINT64_C (0x7EA30DBD7EA479E3),
+    UINT64_C (0x6EAC3085943CCC10),   3901},
+  { /*  1260 */ UINT64_C (0xC6018234B1486FB5), UINT64_C (0x46C1734E983D9305),
+    UINT64_C (0x02DBADAD6F14B731),   3994},
+  { /*  1288 */ UINT64_C (0xC7EF52DEFE87B751), UINT64_C (0x764F4CF916B4DECE),
+    UINT64_C (0x5D5D5A9519E34A43),   4087},
+  { /*  1316 */ UINT64_C (0xC9E1F3150DD1F818), UINT64_C (0xA7C8570E77A19E03),
+    UINT64_C (0x64CC0C0E1460AA3F),   4180},
+  { /*  1344 */ UINT64_C (0xCBD96ED6466CF081), UINT64_C (0xBEB7FBDC1CBE8B37),
+    UINT64_C (0x72435286BAF0E84F),   4273},
+  { /*  1372 */ UINT64_C (0xCDD5D23FFB84D18E), UINT64_C (0xE373203B69F2EB6A),
+    UINT64_C (0x5E12E828FEBB74CF),   4366},
+  { /*  1400 */ UINT64_C (0xCFD7298DB6CB9672), UINT64_C (0xDCE472C619AA3F63),
+    UINT64_C (0x0C6B90B8874D518A),   4459},
+  { /*  1428 */ UINT64_C (0xD1DD811983D276D4), UINT64_C (0x53C35AD3235D128C),
+    UINT64_C (0xB5FC18536DEA96F5),   4552},
+  { /*  1456 */ UINT64_C (0xD3E8E55C3C1F43D0), UINT64_C (0xE47DEFC14A406E4F),
+    UINT64_C (0xEA8D16BD9544E48E),   4645},
+  { /*  1484 */ UINT64_C (0xD5F962EDD3FF8467), UINT64_C (0x69FD88C48E1AC6B1),
+    UINT64_C (0xC99322631C50CBB6),   4738},
+  { /*  1512 */ UINT64_C (0xD80F0685A81B2A81), UINT64_C (0xB7157C60A24A0569),
+    UINT64_C (0xEAE6C2843752AC35),   4831},
+  { /*  1540 */ UINT64_C (0xDA29DCFACBC8BE72), UINT64_C (0x22FC05BE6269F878),
+    UINT64_C (0xBB4948D8533C86F9),   4924},
+  { /*  1568 */ UINT64_C (0xDC49F3445824E360), UINT64_C (0xFB0B98F6BBC4F0CB),
+    UINT64_C (0xCCC52C236DECD779),   5017},
+  { /*  1596 */ UINT64_C (0xDE6F5679BBEF1BD9), UINT64_C (0x35E3A416F04CA9AA),
+    UINT64_C (0xBFDD92295705DC5B),   5110},
+  { /*  1624 */ UINT64_C (0xE09A13D30C2DBA62), UINT64_C (0xC6C6C1764E047E15),
+    UINT64_C (0x5E2BDDD7D12A9E42),   5203},
+  { /*  1652 */ UINT64_C (0xE2CA38A9559AEEE3), UINT64_C (0xC905DE537F07EC9B),
+    UINT64_C (0xFDB064D59E9BA22F),   5296},
+  { /*  1680 */ UINT64_C (0xE4FFD276EEDCE658), UINT64_C (0x87E8DCFC09DBC33A),
+    UINT64_C (0xBC1A3B726B789948),   5389},
+  { /*  1708 */ UINT64_C (0xE73AEED7CB8AF755), UINT64_C (0x45A4713B13D24707),
+    UINT64_C (0x05996F1BC556C7E2),   5482},
+  { /*  1736 */ UINT64_C (0xE97B9B89D001DAB3), UINT64_C (0xB1A3642A8DA3CF4F),
+    UINT64_C (0xA8F09440BE97BFE6),   5575},
+  { /*  1764 */ UINT64_C (0xEBC1E66D2608F4C9), UINT64_C (0x5A1B25540EB6B8AA),
+    UINT64_C (0xD75892BAA34350C0),   5668},
+  { /*  1792 */ UINT64_C (0xEE0DDD84924AB88C), UINT64_C (0x2D4070F33B21AB7B),
+    UINT64_C (0xC20578FA3851488C),   5761},
+  { /*  1820 */ UINT64_C (0xF05F8EF5CAA2331E), UINT64_C (0x727544D538F3F31E),
+    UINT64_C (0xB3344BAF1245CC83),   5854},
+  { /*  1848 */ UINT64_C (0xF2B70909CD3FD35C), UINT64_C (0xA2BF0C63A814E04E),
+    UINT64_C (0xD6919E041129A1A7),   5947},
+  { /*  1876 */ UINT64_C (0xF5145A2D38A78635), UINT64_C (0x51528E351ACE7C2B),
+    UINT64_C (0xB8A7DBE69C67E1EE),   6040},
+  { /*  1904 */ UINT64_C (0xF77790F0A48A45CE), UINT64_C (0x08F13995CF9C2747),
+    UINT64_C (0xE7A0A88981D1A0F9),   6133},
+  { /*  1932 */ UINT64_C (0xF9E0BC08FB7D3EBF), UINT64_C (0xC167073AC21593D6),
+    UINT64_C (0x0375E406F1B32283),   6226},
+  { /*  1960 */ UINT64_C (0xFC4FEA4FD590B40A), UINT64_C (0x7A37993EB21444FA),
+    UINT64_C (0xC851BB3F9AEB1211),   6319},
+  { /*  1988 */ UINT64_C (0xFEC52AC3D3C8CFC1), UINT64_C (0xBD4C24B2C0457430),
+    UINT64_C (0x83C6BA228651E704),   6412},
+  { /*  2016 */ UINT64_C (0x80A046447E3D49F1), UINT64_C (0xB7B1ADA9CDEBA84D),
+    UINT64_C (0xBB3F8498A972F18F),   6506},
+  { /*  2044 */ UINT64_C (0x81E10F748C479223), UINT64_C (0xC2CE91A881EDD191),
+    UINT64_C (0xBF712023FAFDF66D),   6599},
+  { /*  2072 */ UINT64_C (0x8324F8AA08D7D411), UINT64_C (0x0CC6866C5D69B2CB),
+    UINT64_C (0xF231F4B7996B7278),   6692},
+  { /*  2100 */ UINT64_C (0x846C09B028AE0395), UINT64_C (0x04F609974DD3FFE9),
+    UINT64_C (0x3A084C6E9C236157),   6785},
+  { /*  2128 */ UINT64_C (0x85B64A659077660E), UINT64_C (0x7FE2B4308DCBF1A3),
+    UINT64_C (0x8A9AFCDBC940E6FA),   6878},
+  { /*  2156 */ UINT64_C (0x8703C2BC85483E07), UINT64_C (0x38D0EF9AB8A8F2C8),
+    UINT64_C (0xFE41764804C09ABB),   6971},
+  { /*  2184 */ UINT64_C (0x88547ABB1D8E5BD9), UINT64_C (0x1D73EF3EAAC3C964),
+    UINT64_C (0x1F11852A20ED33C6),   7064},
+  { /*  2212 */ UINT64_C (0x89A87A7B727DC0D2), UINT64_C (0x5C7015CD0E51679A),
+    UINT64_C (0x6E3E375AF90D597A),   7157},
+  { /*  2240 */ UINT64_C (0x8AFFCA2BD1F88549), UINT64_C (0x1E34291B1EF566C7),
+    UINT64_C (0x31BE1482014CDAF0),   7250},
+  { /*  2268 */ UINT64_C (0x8C5A720EF0F33507), UINT64_C (0x11C0B3BACD7601B3),
+    UINT64_C (0x1720BEB1E919B4C1),   7343},
+  { /*  2296 */ UINT64_C (0x8DB87A7C1E56D873), UINT64_C (0x9E9383D73D486881),
+    UINT64_C (0xA126C32FF4882BE9),   7436},
+  { /*  2324 */ UINT64_C (0x8F19EBDF7661E3E9), UINT64_C (0xAC89BFA5E79484A6),
+    UINT64_C (0xF4EC157AA4147562),   7529},
+  { /*  2352 */ UINT64_C (0x907ECEBA168949B3), UINT64_C (0x9CC5EE51962C011A),
+    UINT64_C (0x47A0E15DFC7986B9),   7622},
+  { /*  2380 */ UINT64_C (0x91E72BA251DAEE3D), UINT64_C (0x564F722FCAA40DD4),
+    UINT64_C (0x6F6B7DB76199637C),   7715},
+  { /*  2408 */ UINT64_C (0x93530B43E5E2C129), UINT64_C (0x413407CFEEAC9743),
+    UINT64_C (0xD1CBBB7D005A76D4),   7808},
+  { /*  2436 */ UINT64_C (0x94C276603013C119), UINT64_C (0xC69F0B71EF89019E),
+    UINT64_C (0xD7A3A5FC333924C6),   7901},
+  { /*  2464 */ UINT64_C (0x963575CE63B6332D), UINT64_C (0x7EFA7D29C44E11B7),
+    UINT64_C (0x56A3106227B87707),   7994},
+  { /*  2492 */ UINT64_C (0x97AC127BC05C5A60), UINT64_C (0xB450373470F0746B),
+    UINT64_C (0x3DDEB9475642D4C2),   8087},
+  { /*  2520 */ UINT64_C (0x9926556BC8DEFE43), UINT64_C (0x5A848859645D1C6F),
+    UINT64_C (0xB69F01A641DA2A43),   8180},
+  { /*  2548 */ UINT64_C (0x9AA447B87AE313B7), UINT64_C (0x2C95A08E49A4C15B),
+    UINT64_C (0x545226267332D478),   8273},
+  { /*  2576 */ UINT64_C (0x9C25F29286E9DDB6), UINT64_C (0x51EDEA897B34601F),
+    UINT64_C (0x0794FD5E5A51AC30),   8366},
+  { /*  2604 */ UINT64_C (0x9DAB5F4188ECDF77), UINT64_C (0xDD5DAEBB2F169C8B),
+    UINT64_C (0x574C3DA5FCE93E2B),   8459},
+  { /*  2632 */ UINT64_C (0x9F3497244186FCA4), UINT64_C (0xB50008D92529E91F),
+    UINT64_C (0x32B7105223A27365),   8552},
+  { /*  2660 */ UINT64_C (0xA0C1A3B0CFAC27B5), UINT64_C (0x13E15517552A7BC7),
+    UINT64_C (0xA5CE7B7BB7C204B7),   8645},
+  { /*  2688 */ UINT64_C (0xA2528E74EAF101FC), UINT64_C (0xF09E780BCC8238D9),
+    UINT64_C (0x5E997E9F45D7897E),   8738},
+  { /*  2716 */ UINT64_C (0xA3E761161E63D464), UINT64_C (0x3C85A6192EBF4818),
+    UINT64_C (0x2DC5FA5AB83B071E),   8831},
+  { /*  2744 */ UINT64_C (0xA580255203F84B47), UINT64_C (0x3A5828869701A165),
+    UINT64_C (0xA0EAF3F62DC1777D),   8924},
+  { /*  2772 */ UINT64_C (0xA71CE4FE80876383), UINT64_C (0x3033D77325DAF287),
+    UINT64_C (0xC2B9A6B6520185F8),   9017},
+  { /*  2800 */ UINT64_C (0xA8BDAA0A0064FA44), UINT64_C (0x8B231A70EB5444CE),
+    UINT64_C (0x5786F3927EB15BD5),   9110},
+  { /*  2828 */ UINT64_C (0xAA627E7BB48C74C5), UINT64_C (0x4251FF2792301CE5),
+    UINT64_C (0x8B8D9B481656F4E8),   9203},
+  { /*  2856 */ UINT64_C (0xAC0B6C73D065F8CC), UINT64_C (0xFA1BDE1F473556A4),
+    UINT64_C (0x843FDDD10C7006B8),   9296},
+  { /*  2884 */ UINT64_C (0xADB87E2BC825B270), UINT64_C (0x2A73F1628AA4208E),
+    UINT64_C (0xC262D1FA093C4F53),   9389},
+  { /*  2912 */ UINT64_C (0xAF69BDF68FC6A740), UINT64_C (0x7730E00421DA4D55),
+    UINT64_C (0x00DB7D919B136C68),   9482},
+  { /*  2940 */ UINT64_C (0xB11F3640DAA29ADE), UINT64_C (0x9254AA6FBBB55F5C),
+    UINT64_C (0x49E9D38B871397D7),   9575},
+  { /*  2968 */ UINT64_C (0xB2D8F1915BA88CA5), UINT64_C (0x7F959CB702329D14),
+    UINT64_C (0x61C0EDD56BBCB3E8),   9668},
+  { /*  2996 */ UINT64_C (0xB496FA89063359F7), UINT64_C (0xFC797C10226CDA5B),
+    UINT64_C (0x12E8C76425B4C48F),   9761},
+  { /*  3024 */ UINT64_C (0xB6595BE34F821493), UINT64_C (0x40C3A071220F5567),
+    UINT64_C (0x9CC3B1569B1325A4),   9854},
+  { /*  3052 */ UINT64_C (0xB820207670D3A02E), UINT64_C (0x57854716B3F18898),
+    UINT64_C (0x1798E678F1B9E20C),   9947},
+  { /*  3080 */ UINT64_C (0xB9EB5333AA272E9B), UINT64_C (0x11C48D02B8326BD3),
+    UINT64_C (0xBEFF12280D5A1677),  10040},
+  { /*  3108 */ UINT64_C (0xBBBAFF2785A33595), UINT64_C (0x209D5496B884CCFF),
+    UINT64_C (0x998300E1BCF28E49),  10133},
+  { /*  3136 */ UINT64_C (0xBD8F2F7A1BA47D6D), UINT64_C (0x566765461BD2F61B),
+    UINT64_C (0xB494BCC96D53E49C),  10226},
+  { /*  3164 */ UINT64_C (0xBF67EF6F5776EBCA), UINT64_C (0x7D7ACEBF8AADFB4B),
+    UINT64_C (0x0EEBD18245833F49),  10319},
+  { /*  3192 */ UINT64_C (0xC1454A673CB9B1CE), UINT64_C (0xB889018E4F6E9A52),
+    UINT64_C (0x431388EC68AC7A26),  10412},
+  { /*  3220 */ UINT64_C (0xC3274BDE2D708910), UINT64_C (0x1556481F9C26F53D),
+    UINT64_C (0x669C4299E4D69ED4),  10505},
+  { /*  3248 */ UINT64_C (0xC50DFF6D30C3AEFC), UINT64_C (0xF85333A94848659F),
+    UINT64_C (0x132D031FC1D1FEC0),  10598},
+  { /*  3276 */ UINT64_C (0xC6F970CA3A705279), UINT64_C (0x67CE61CCFD48C510),
+    UINT64_C (0x7A1F890F8B95AA7C),  10691},
+  { /*  3304 */ UINT64_C (0xC8E9ABC872EB2BC1), UINT64_C (0x1A1AEAE7CF8A9D3D),
+    UINT64_C (0xF888498A40220657),  10784},
+  { /*  3332 */ UINT64_C (0xCADEBC588036FAE3), UINT64_C (0x9D3D9605B201EB8A),
+    UINT64_C (0x406B39FEC6279B60),  10877},
+  { /*  3360 */ UINT64_C (0xCCD8AE88CF70AD84), UINT64_C (0x12E29F09D9061609),
+    UINT64_C (0xC9CF998035A91665),  10970},
+  { /*  3388 */ UINT64_C (0xCED78E85DF12F0E4), UINT64_C (0xEB3149759843E989),
+    UINT64_C (0x4BEC4E9802D3D8A2),  11063},
+  { /*  3416 */ UINT64_C (0xD0DB689A89F2F9B1), UINT64_C (0xDF7601457CA20B35),
+    UINT64_C (0x8C53E7BEECA4578F),  11156},
+  { /*  3444 */ UINT64_C (0xD2E4493052F84F6F), UINT64_C (0x45BEEBB8A6B94A98),
+    UINT64_C (0x44053FAEC6558C38),  11249},
+  { /*  3472 */ UINT64_C (0xD4F23CCFB1916DF5), UINT64_C (0xCBDCD02F23CC7690),
+    UINT64_C (0x4949D09424B87626),  11342},
+  { /*  3500 */ UINT64_C (0xD70550205EE713EC), UINT64_C (0xD67AEFFBFCACC7B9),
+    UINT64_C (0x1581D1CB0BEBE3CC),  11435},
+  { /*  3528 */ UINT64_C (0xD91D8FE9A3D019CC), UINT64_C (0x44289DD21B589D7A),
+    UINT64_C (0x9B80AAC81B50762A),  11528},
+  { /*  3556 */ UINT64_C (0xDB3B0912A787B190), UINT64_C (0x4881D9E963E4CE8F),
+    UINT64_C (0x033F96B7EDE02C3A),  11621},
+  { /*  3584 */ UINT64_C (0xDD5DC8A2BF27F3F7), UINT64_C (0x95AA118EC1D08317),
+    UINT64_C (0x8909E424A112A3CD),  11714},
+  { /*  3612 */ UINT64_C (0xDF85DBC1BDEAA4DD), UINT64_C (0x36D5B4A1A707195F),
+    UINT64_C (0xC79410972B1AF93D),  11807},
+  { /*  3640 */ UINT64_C (0xE1B34FB846321D04), UINT64_C (0x72C4D2CAD73B0A7B),
+    UINT64_C (0x014344660A175C37),  11900},
+  { /*  3668 */ UINT64_C (0xE3E631F01B5C4C7D), UINT64_C (0xE6331D95A376B8C8),
+    UINT64_C (0x588E52339BD2D711),  11993},
+  { /*  3696 */ UINT64_C (0xE61E8FF47461CDA9), UINT64_C (0xE20A88F1134F906D),
+    UINT64_C (0x0B11160A6EDB5F57),  12086},
+  { /*  3724 */ UINT64_C (0xE85C77724F4305C5), UINT64_C (0x158950EF08DE22BE),
+    UINT64_C (0xB9668C09A8133F1B),  12179},
+  { /*  3752 */ UINT64_C (0xEA9FF638C54554E1), UINT64_C (0xC7C91D5C341ED39D),
+    UINT64_C (0xAA13ACBA1E5511F5),  12272},
+  { /*  3780 */ UINT64_C (0xECE91A3960025C31), UINT64_C (0x7CB5735C85C60AD7),
+    UINT64_C (0x4B177262F816F9BA),  12365},
+  { /*  3808 */ UINT64_C (0xEF37F1886F4B6690), UINT64_C (0xF659EDE2159A45EC),
+    UINT64_C (0xABE33496AFF629B4),  12458},
+  { /*  3836 */ UINT64_C (0xF18C8A5D5FE30463), UINT64_C (0x33A802CDAED28CF3),
+    UINT64_C (0xD56496B7A36BF087),  12551},
+  { /*  3864 */ UINT64_C (0xF3E6F313130EF0EF), UINT64_C (0x78D946BAB954B82F),
+    UINT64_C (0x350E915F7055B1B9),  12644},
+  { /*  3892 */ UINT64_C (0xF6473A2837045CAA), UINT64_C (0xB325712DD8C98916),
+    UINT64_C (0xE697A154D4F1A1CC),  12737},
+  { /*  3920 */ UINT64_C (0xF8AD6E3FA030BD15), UINT64_C (0xC9B1474D8F89C269),
+    UINT64_C (0xF4D4D3202379829F),  12830},
+  { /*  3948 */ UINT64_C (0xFB199E20A3614828), UINT64_C (0xC8C37010926872B0),
+    UINT64_C (0x7514EF932D7C6A33),  12923},
+  { /*  3976 */ UINT64_C (0xFD8BD8B770CB469E), UINT64_C (0x6B1D2745340E7B14),
+    UINT64_C (0xE878EDB67072C26E),  13016},
+  { /*  4004 */ UINT64_C (0x8002168AB7FBB6EE), UINT64_C (0x3C67B6BBB284E49E),
+    UINT64_C (0x0E1C970B6446EAB1),  13110},
+  { /*  4032 */ UINT64_C (0x81415538CE493BD5), UINT64_C (0xF22E502FCDD4BCA2),
+    UINT64_C (0x0151DCD7A53488C4),  13203},
+  { /*  4060 */ UINT64_C (0x8283B014721299BB), UINT64_C (0xD00832554D9149C7),
+    UINT64_C (0x211184A4D529BF70),  13296},
+  { /*  4088 */ UINT64_C (0x83C92EDF425B292D), UINT64_C (0x7C1735FC3B813C8C),
+    UINT64_C (0xE752F53C2F8FA6C1),  13389},
+  { /*  4116 */ UINT64_C (0x8511D96E362C1A73), UINT64_C (0xFA9D4D41A7042940),
+    UINT64_C (0x9B512F20BEEE0F47),  13482},
+  { /*  4144 */ UINT64_C (0x865DB7A9CCD2839E), UINT64_C (0x0367500A8E9A178F),
+    UINT64_C (0xDF0FD2002FF6B3A4),  13575},
+  { /*  4172 */ UINT64_C (0x87ACD18E3E95BEDA), UINT64_C (0x8F1672EC7D776C85),
+    UINT64_C (0xAEF04464E12D3900),  13668},
+  { /*  4200 */ UINT64_C (0x88FF2F2BADE74531), UINT64_C (0xC9AC50475E25293A),
+    UINT64_C (0x71B256ECD954434C),  13761},
+  { /*  4228 */ UINT64_C (0x8A54D8A6590D3496), UINT64_C (0xE9CC6E8725EC5D92),
+    UINT64_C (0x15A73001C7A90DA0),  13854},
+  { /*  4256 */ UINT64_C (0x8BADD636CC48B341), UINT64_C (0x0879B2E5F6EE8B1C),
+    UINT64_C (0xAC376F28B45E5ACC),  13947},
+  { /*  4284 */ UINT64_C (0x8D0A302A14796534), UINT64_C (0x0DDC924865236FC7),
+    UINT64_C (0x4FE70430AD597B21),  14040},
+  { /*  4312 */ UINT64_C (0x8E69EEE1F23F2BE5), UINT64_C (0x2F33C652BD12FAB7),
+    UINT64_C (0xB7F786D14D58173E),  14133},
+  { /*  4340 */ UINT64_C (0x8FCD1AD50D9B6AF0), UINT64_C (0x62FE50CE55EED182),
+    UINT64_C (0xCA347B5985A7B29C),  14226},
+  { /*  4368 */ UINT64_C (0x9133BC8F2A130FE5), UINT64_C (0xAD6A6308A8E8B557),
+    UINT64_C (0x35DC241819DE7182),  14319},
+  { /*  4396 */ UINT64_C (0x929DDCB15B529E4E), UINT64_C (0x4B07B86F1DB31283),
+    UINT64_C (0x90C751361AC3C6DC),  14412},
+  { /*  4424 */ UINT64_C (0x940B83F23A55842A), UINT64_C (0x9DBAA465EFE141A0),
+    UINT64_C (0xE5413D9414142A55),  14505},
+  { /*  4452 */ UINT64_C (0x957CBB1E1B11FE52), UINT64_C (0x6B3C9C8F4DA2A4D8),
+    UINT64_C (0x542B94E552C4F9F4),  14598},
+  { /*  4480 */ UINT64_C (0x96F18B1742AAD751), UINT64_C (0x888C9AB2FC5B3437),
+    UINT64_C (0x186EF2C39ACB4103),  14691},
+  { /*  4508 */ UINT64_C (0x9869FCD61E284E93), UINT64_C (0x8E33034A7A9E5D55),
+    UINT64_C (0x8C8A3E1833584327),  14784},
+  { /*  4536 */ UINT64_C (0x99E6196979B978F1), UINT64_C (0xBA00864671D1053F),
+    UINT64_C (0xBF66D66CC34F0198),  14877},
+  { /*  4564 */ UINT64_C (0x9B65E9F6B87F6EFE), UINT64_C (0xC7FDDFD9302C767D),
+    UINT64_C (0x11856B5941A42B9B),  14970},
+  { /*  4592 */ UINT64_C (0x9CE977BA0CE3A0BD), UINT64_C (0x61D59D402AAE4FEA),
+    UINT64_C (0x6FAAC32D59CC1F5E),  15063},
+  { /*  4620 */ UINT64_C (0x9E70CC06B17AA9C6), UINT64_C (0xDE85ADFE03E691B5),
+    UINT64_C (0xFC14F07179F71BC1),  15156},
+  { /*  4648 */ UINT64_C (0x9FFBF04722750449), UINT64_C (0x803C1CD864033781),
+    UINT64_C (0x19482FA0AC45669D),  15249},
+  { /*  4676 */ UINT64_C (0xA18AEDFD579EFCAF), UINT64_C (0x40BBC431F624B546),
+    UINT64_C (0x72DD9BAF150FF353),  15342},
+  { /*  4704 */ UINT64_C (0xA31DCEC2FEF14B30), UINT64_C (0xA28A151725A55E10),
+    UINT64_C (0x900AA3C2F02AC9D5),  15435},
+  { /*  4732 */ UINT64_C (0xA4B49C49B7B3BC11), UINT64_C (0xFBB16E441EEC585A),
+    UINT64_C (0xCD178677B717AE00),  15528},
+  { /*  4760 */ UINT64_C (0xA64F605B4E3352CD), UINT64_C (0x5B8452AF2302FE13),
+    UINT64_C (0xBD8ECF923D23BEC0),  15621},
+  { /*  4788 */ UINT64_C (0xA7EE24D9F80D57F7), UINT64_C (0x9D2ACF5772F77020),
+    UINT64_C (0x65123C8CC2769C2E),  15714},
+  { /*  4816 */ UINT64_C (0xA990F3C09110C544), UINT64_C (0x82B84CABC828BF93),
+    UINT64_C (0xDEE162A8A1248550),  15807},
+  { /*  4844 */ UINT64_C (0xAB37D722D8B786AB), UINT64_C (0xEE2722AD5F60D16E),
+    UINT64_C (0x9C27FA1901026DE2),  15900},
+  { /*  4872 */ UINT64_C (0xACE2D92DB0390B59), UINT64_C (0x8D29DD5122E4278D),
+    UINT64_C (0x66FA2184CEE0B861),  15993},
+  { /*  4900 */ UINT64_C (0xAE9204275937A4C0), UINT64_C (0xA8C91282E5AF94EA),
+    UINT64_C (0xAD9E14888FCF5E0D),  16086},
+  { /*  4928 */ UINT64_C (0xB045626FB50A35E7), UINT64_C (0x58F8FDE02C03A6C6),
+    UINT64_C (0xDED179C26D9AB829),  16179},
+  { /*  4956 */ UINT64_C (0xB1FCFE8084A3B8BF), UINT64_C (0x35A5744EFFE56F34),
+    UINT64_C (0x35B7BA09EDE9E517),  16272},
+  { /*  4984 */ UINT64_C (0xB3B8E2EDA91A232D), UINT64_C (0xD950102978DBD0FF),
+    UINT64_C (0x8737BD250290CD5B),  16365},
+  { /*  5012 */ UINT64_C (0xB5791A6564CE393D), UINT64_C (0x3CA86245B281998F),
+    UINT64_C (0x47A9B4458C88BE82),  16458},
+};
+
+static const struct
+{
+  uint64_t mul1;
+  uint64_t mul2;
+  uint64_t mul3;
+  int32_t exp;
+} qpowers10_28[] = {
+  { /*     0 */ UINT64_C (0x8000000000000000), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -191},
+  { /*     1 */ UINT64_C (0xA000000000000000), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -188},
+  { /*     2 */ UINT64_C (0xC800000000000000), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -185},
+  { /*     3 */ UINT64_C (0xFA00000000000000), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -182},
+  { /*     4 */ UINT64_C (0x9C40000000000000), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -178},
+  { /*     5 */ UINT64_C (0xC350000000000000), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -175},
+  { /*     6 */ UINT64_C (0xF424000000000000), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -172},
+  { /*     7 */ UINT64_C (0x9896800000000000), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -168},
+  { /*     8 */ UINT64_C (0xBEBC200000000000), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -165},
+  { /*     9 */ UINT64_C (0xEE6B280000000000), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -162},
+  { /*    10 */ UINT64_C (0x9502F90000000000), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -158},
+  { /*    11 */ UINT64_C (0xBA43B74000000000), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -155},
+  { /*    12 */ UINT64_C (0xE8D4A51000000000), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -152},
+  { /*    13 */ UINT64_C (0x9184E72A00000000), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -148},
+  { /*    14 */ UINT64_C (0xB5E620F480000000), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -145},
+  { /*    15 */ UINT64_C (0xE35FA931A0000000), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -142},
+  { /*    16 */ UINT64_C (0x8E1BC9BF04000000), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -138},
+  { /*    17 */ UINT64_C (0xB1A2BC2EC5000000), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -135},
+  { /*    18 */ UINT64_C (0xDE0B6B3A76400000), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -132},
+  { /*    19 */ UINT64_C (0x8AC7230489E80000), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -128},
+  { /*    20 */ UINT64_C (0xAD78EBC5AC620000), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -125},
+  { /*    21 */ UINT64_C (0xD8D726B7177A8000), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -122},
+  { /*    22 */ UINT64_C (0x878678326EAC9000), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -118},
+  { /*    23 */ UINT64_C (0xA968163F0A57B400), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -115},
+  { /*    24 */ UINT64_C (0xD3C21BCECCEDA100), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -112},
+  { /*    25 */ UINT64_C (0x84595161401484A0), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -108},
+  { /*    26 */ UINT64_C (0xA56FA5B99019A5C8), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -105},
+  { /*    27 */ UINT64_C (0xCECB8F27F4200F3A), UINT64_C (0x0000000000000000),
+    UINT64_C (0x0000000000000000),   -102},
+};
+#endif
 
 static const uint64_t ipowers64[] = {
   UINT64_C (1),
@@ -3912,6 +5790,147 @@ static const char num3[3000] = {
   '9', '9', '5', '9', '9', '6', '9', '9', '7', '9', '9', '8', '9', '9', '9',
 };
 
+#ifdef FAST_CONVERT_NUMA_TABLES
+#if defined (FAST_CONVERT_COMPACT_TABLES) || defined (FAST_CONVERT_SHARED_TABLES)
+#error "FAST_CONVERT_NUMA_TABLES needs the full tables"
+#endif
+/* The tables are read through per thread pointers, so a thread can use
+   a copy in the memory of its own NUMA node (fast_convert_tables_use). */
+static __thread const struct dpower *tls_dpowers2 = dpowers2;
+static __thread const struct dpower *tls_dpowers10 = dpowers10;
+static __thread const struct fpower *tls_fpowers2 = fpowers2;
+static __thread const struct fpower *tls_fpowers10 = fpowers10;
+static __thread const char *tls_num3 = num3;
+
+#define	NUM3	tls_num3
+#else
+#define	NUM3	num3
+#endif
+
+#if 0
+/* gcc -g -O3 -Wall d.c -o d */
+#include <stdio.h>
+
+int
+main (void)
+{
+  unsigned int b;
+
+  printf ("static const struct\n");
+  printf ("{\n");
+  printf ("  uint32_t pow;\n");
+  printf ("  uint32_t digits;\n");
+  printf ("  uint64_t pow_recip;\n");
+  printf ("  uint64_t recip;\n");
+  printf ("} base_chunk[37] = {\n");
+  for (b = 0; b <= 36; b++) {
+    unsigned long long pow = 1;
+    unsigned int digits = 0;
+    unsigned __int128 p64 = (unsigned __int128) 1 << 64;
+
+    if (b < 2) {
+      printf ("  { /* %2u */ 0, 0,\n    UINT64_C (0x%016X), UINT64_C (0x%016X)},\n",
+	      b, 0, 0);
+      continue;
+    }
+    while (pow * b <= 0xFFFFFFFFull) {
+      pow *= b;
+      digits++;
+    }
+    /* floor (2^64 / pow) and ceil (2^64 / b) */
+    printf ("  { /* %2u */ %llu, %u,\n    UINT64_C (0x%016llX), "
+	    "UINT64_C (0x%016llX)},\n", b, pow, digits,
+	    (unsigned long long) (p64 / pow),
+	    (unsigned long long) ((p64 + b - 1) / b));
+  }
+  printf ("};\n");
+  return 0;
+}
+#endif
+
+static const struct
+{
+  uint32_t pow;
+  uint32_t digits;
+  uint64_t pow_recip;
+  uint64_t recip;
+} base_chunk[37] = {
+  { /*  0 */ 0, 0,
+    UINT64_C (0x0000000000000000), UINT64_C (0x0000000000000000)},
+  { /*  1 */ 0, 0,
+    UINT64_C (0x0000000000000000), UINT64_C (0x0000000000000000)},
+  { /*  2 */ 2147483648, 31,
+    UINT64_C (0x0000000200000000), UINT64_C (0x8000000000000000)},
+  { /*  3 */ 3486784401, 20,
+    UINT64_C (0x000000013B563C24), UINT64_C (0x5555555555555556)},
+  { /*  4 */ 1073741824, 15,
+    UINT64_C (0x0000000400000000), UINT64_C (0x4000000000000000)},
+  { /*  5 */ 1220703125, 13,
+    UINT64_C (0x0000000384B84D09), UINT64_C (0x3333333333333334)},
+  { /*  6 */ 2176782336, 12,
+    UINT64_C (0x00000001F91BD1B6), UINT64_C (0x2AAAAAAAAAAAAAAB)},
+  { /*  7 */ 1977326743, 11,
+    UINT64_C (0x000000022C0F4597), UINT64_C (0x2492492492492493)},
+  { /*  8 */ 1073741824, 10,
+    UINT64_C (0x0000000400000000), UINT64_C (0x2000000000000000)},
+  { /*  9 */ 3486784401, 10,
+    UINT64_C (0x000000013B563C24), UINT64_C (0x1C71C71C71C71C72)},
+  { /* 10 */ 1000000000, 9,
+    UINT64_C (0x000000044B82FA09), UINT64_C (0x199999999999999A)},
+  { /* 11 */ 2357947691, 9,
+    UINT64_C (0x00000001D24CDE04), UINT64_C (0x1745D1745D1745D2)},
+  { /* 12 */ 429981696, 8,
+    UINT64_C (0x00000009FD1CD5AA), UINT64_C (0x1555555555555556)},
+  { /* 13 */ 815730721, 8,
+    UINT64_C (0x0000000543E2B17F), UINT64_C (0x13B13B13B13B13B2)},
+  { /* 14 */ 1475789056, 8,
+    UINT64_C (0x00000002E908763D), UINT64_C (0x124924924924924A)},
+  { /* 15 */ 2562890625, 8,
+    UINT64_C (0x00000001AD0326C2), UINT64_C (0x1111111111111112)},
+  { /* 16 */ 268435456, 7,
+    UINT64_C (0x0000001000000000), UINT64_C (0x1000000000000000)},
+  { /* 17 */ 410338673, 7,
+    UINT64_C (0x0000000A7785B5EB), UINT64_C (0x0F0F0F0F0F0F0F10)},
+  { /* 18 */ 612220032, 7,
+    UINT64_C (0x0000000703F12287), UINT64_C (0x0E38E38E38E38E39)},
+  { /* 19 */ 893871739, 7,
+    UINT64_C (0x00000004CE0E250A), UINT64_C (0x0D79435E50D79436)},
+  { /* 20 */ 1280000000, 7,
+    UINT64_C (0x000000035AFE5357), UINT64_C (0x0CCCCCCCCCCCCCCD)},
+  { /* 21 */ 1801088541, 7,
+    UINT64_C (0x0000000262787A2B), UINT64_C (0x0C30C30C30C30C31)},
+  { /* 22 */ 2494357888, 7,
+    UINT64_C (0x00000001B8CCA9E0), UINT64_C (0x0BA2E8BA2E8BA2E9)},
+  { /* 23 */ 3404825447, 7,
+    UINT64_C (0x0000000142ED6DE9), UINT64_C (0x0B21642C8590B217)},
+  { /* 24 */ 191102976, 6,
+    UINT64_C (0x000000167980E0BF), UINT64_C (0x0AAAAAAAAAAAAAAB)},
+  { /* 25 */ 244140625, 6,
+    UINT64_C (0x000000119799812D), UINT64_C (0x0A3D70A3D70A3D71)},
+  { /* 26 */ 308915776, 6,
+    UINT64_C (0x0000000DE7429CB3), UINT64_C (0x09D89D89D89D89D9)},
+  { /* 27 */ 387420489, 6,
+    UINT64_C (0x0000000B16081D48), UINT64_C (0x097B425ED097B426)},
+  { /* 28 */ 481890304, 6,
+    UINT64_C (0x00000008E9A9EA1D), UINT64_C (0x0924924924924925)},
+  { /* 29 */ 594823321, 6,
+    UINT64_C (0x000000073877B3A9), UINT64_C (0x08D3DCB08D3DCB09)},
+  { /* 30 */ 729000000, 6,
+    UINT64_C (0x00000005E43F1444), UINT64_C (0x0888888888888889)},
+  { /* 31 */ 887503681, 6,
+    UINT64_C (0x00000004D6E19681), UINT64_C (0x0842108421084211)},
+  { /* 32 */ 1073741824, 6,
+    UINT64_C (0x0000000400000000), UINT64_C (0x0800000000000000)},
+  { /* 33 */ 1291467969, 6,
+    UINT64_C (0x00000003535DA367), UINT64_C (0x07C1F07C1F07C1F1)},
+  { /* 34 */ 1544804416, 6,
+    UINT64_C (0x00000002C7BF8452), UINT64_C (0x0787878787878788)},
+  { /* 35 */ 1838265625, 6,
+    UINT64_C (0x00000002561FDC60), UINT64_C (0x0750750750750751)},
+  { /* 36 */ 2176782336, 6,
+    UINT64_C (0x00000001F91BD1B6), UINT64_C (0x071C71C71C71C71D)},
+};
+
 static uint32_t convert_num[128] = {
   0, 0, 0, 0, 0, 0, 0, 0,
   0, 0, 0, 0, 0, 0, 0, 0,
@@ -4003,6 +6022,85 @@ static void __attribute__((constructor))
   lconv = localeconv ();
 }
 
+#ifdef FAST_CONVERT_STATS
+/** \brief stats_add
+ *
+ * \b Description
+ *
+ * Add counters
+ *
+ * \param d Destination
+ * \param s Source
+ */
+
+static void
+stats_add (struct fast_convert_stats *d, const struct fast_convert_stats *s)
+{
+  d->subnormal += s->subnormal;
+  d->round_half += s->round_half;
+  d->hex_float += s->hex_float;
+  d->inf_nan += s->inf_nan;
+  d->truncated += s->truncated;
+  d->int_overflow += s->int_overflow;
+  d->integer += s->integer;
+}
+
+/** \brief stats_exit
+ *
+ * \b Description
+ *
+ * Save counters of exiting thread
+ *
+ * \param arg Thread counters
+ */
+
+static void
+stats_exit (void *arg)
+{
+  struct stats_thread *t = (struct stats_thread *) arg;
+
+  pthread_mutex_lock (&stats_lock);
+  stats_add (&stats_retired, &t->s);
+  t->prev->next = t->next;
+  t->next->prev = t->prev;
+  pthread_mutex_unlock (&stats_lock);
+}
+
+/** \brief init_stats
+ *
+ * \b Description
+ *
+ * Create key to get notified when a thread exits
+ */
+static void __attribute__((constructor))
+  init_stats (void)
+{
+  pthread_key_create (&stats_key, stats_exit);
+}
+
+/** \brief stats_register
+ *
+ * \b Description
+ *
+ * Link counters of current thread
+ */
+
+static void
+stats_register (void)
+{
+  struct stats_thread *t = &stats_thread;
+
+  pthread_mutex_lock (&stats_lock);
+  t->registered = 1;
+  t->next = stats_list.next;
+  t->prev = &stats_list;
+  stats_list.next->prev = t;
+  stats_list.next = t;
+  pthread_mutex_unlock (&stats_lock);
+  pthread_setspecific (stats_key, t);
+}
+#endif
+
 #ifndef __GNUC__
 
 static const unsigned char fast_clz[256] = {
@@ -4072,6 +6170,26 @@ calc_clz64 (uint64_t x)
 }
 #endif
 
+/** \brief clz64
+ * 
+ * \b Description
+ *
+ * Leading zero's with the compiler builtin when available
+ *
+ * \param x 64 bits input, not 0
+ * \returns Number of leading zero's
+ */
+
+static ALWAYS_INLINE unsigned int
+clz64 (uint64_t x)
+{
+#ifdef __GNUC__
+  return __builtin_clzll (x);
+#else
+  return calc_clz64 (x);
+#endif
+}
+
 static unsigned int
 log10_32 (uint32_t v)
 {
@@ -4135,17 +6253,17 @@ do_uint (uint32_t v, char *p, unsigned int len)
   while (v >= 1000) {
     uint32_t d = v / 1000;
 
-    p = (char *) memcpy (p - 3, &num3[(v - d * 1000) * 3], 3);
+    p = (char *) memcpy (p - 3, &NUM3[(v - d * 1000) * 3], 3);
     v = d;
   }
   if (v >= 100) {
-    memcpy (p - 3, &num3[v * 3], 3);
+    memcpy (p - 3, &NUM3[v * 3], 3);
   }
   else if (v >= 10) {
-    memcpy (p - 2, &num3[v * 3] + 1, 2);
+    memcpy (p - 2, &NUM3[v * 3] + 1, 2);
   }
   else {
-    memcpy (p - 1, &num3[v * 3] + 2, 1);
+    memcpy (p - 1, &NUM3[v * 3] + 2, 1);
   }
 }
 
@@ -4403,6 +6521,226 @@ mul_56 (const uint32_t n, const uint64_t m, uint32_t * low)
 }
 #endif
 
+#ifdef FAST_CONVERT_COMPACT_TABLES
+/** \brief compact_pow10
+ * 
+ * \b Description
+ *
+ * Calculate 10^k as 192 bit mantissa (msb set) from the anchor
+ * cpowers10 (10^(20 * i)) and ipowers64 with one extra multiply.
+ *
+ * \param k power of 10 (-380 <= k <= 359)
+ * \param p returns mantissa (p[2] is msb)
+ * \returns binary exponent
+ */
+
+static ALWAYS_INLINE int
+compact_pow10 (int k, uint64_t * p)
+{
+  unsigned int j = (unsigned int) (k + 380) / 20;
+  unsigned int i = (unsigned int) (k + 380) % 20;
+  uint64_t r;
+  uint64_t c;
+  unsigned int s;
+
+  if (i == 0) {
+    p[2] = cpowers10[j].mul1;
+    p[1] = cpowers10[j].mul2;
+    p[0] = 0;
+    return cpowers10[j].exp - 64;
+  }
+  r = ipowers64[i];
+  c = mul_64 (cpowers10[j].mul2, r);
+  p[0] = cpowers10[j].mul2 * r;
+  p[1] = cpowers10[j].mul1 * r + c;
+  p[2] = mul_64 (cpowers10[j].mul1, r) + (p[1] < c);
+#ifdef __GNUC__
+  s = __builtin_clzll (p[2]);
+#else
+  s = calc_clz64 (p[2]);
+#endif
+  if (s) {
+    p[2] = (p[2] << s) | (p[1] >> (64 - s));
+    p[1] = (p[1] << s) | (p[0] >> (64 - s));
+    p[0] <<= s;
+  }
+  return cpowers10[j].exp - (int) s;
+}
+
+/** \brief compact_dpowers2
+ * 
+ * \b Description
+ *
+ * Calculate dpowers2[j]: 2^(j - 1076) / 10^exp rounded to 96 bits
+ * with 32 fraction bits.
+ *
+ * \param j table index
+ * \returns table entry
+ */
+
+static ALWAYS_INLINE struct dpower
+compact_dpowers2 (int j)
+{
+  struct dpower d;
+  uint64_t p[3];
+  int i = j - 1076;
+  unsigned int s;
+  uint32_t r;
+
+  d.exp = (((i - 64) * 78913) >> 18) + 1;
+  s = -(i + 32 + compact_pow10 (-d.exp, p)) - 96;
+  d.mul1 = p[2] >> s;
+  d.mul2 = (uint32_t) ((p[2] << (32 - s)) | (p[1] >> (32 + s)));
+  r = (p[1] >> (31 + s)) & 1;
+  d.mul2 += r;
+  d.mul1 += d.mul2 < r;
+  return d;
+}
+
+/** \brief compact_fpowers2
+ * 
+ * \b Description
+ *
+ * Calculate fpowers2[j]: 2^(j - 151) / 10^exp rounded to 64 bits
+ * with 24 fraction bits.
+ *
+ * \param j table index
+ * \returns table entry
+ */
+
+static ALWAYS_INLINE struct fpower
+compact_fpowers2 (int j)
+{
+  struct fpower f;
+  uint64_t p[3];
+  int i = j - 151;
+  unsigned int s;
+
+  f.exp = ((i * 78913) >> 18) - 11;
+  s = -(i + 24 + compact_pow10 (-f.exp, p)) - 128;
+  f.mul = (p[2] >> s) + ((((p[2] << 1) | (p[1] >> 63)) >> s) & 1);
+  return f;
+}
+
+/** \brief compact_dpowers10
+ * 
+ * \b Description
+ *
+ * Calculate dpowers10[j]: 10^(j - 362) rounded to 96 bits (msb set).
+ *
+ * \param j table index
+ * \returns table entry
+ */
+
+static ALWAYS_INLINE struct dpower
+compact_dpowers10 (int j)
+{
+  struct dpower d;
+  uint64_t p[3];
+  uint32_t r;
+
+  d.exp = compact_pow10 (j - 362, p) + 128;
+  d.mul1 = p[2];
+  d.mul2 = p[1] >> 32;
+  r = (p[1] >> 31) & 1;
+  d.mul2 += r;
+  d.mul1 += d.mul2 < r;
+  return d;
+}
+
+/** \brief compact_fpowers10
+ * 
+ * \b Description
+ *
+ * Calculate fpowers10[j]: 10^(j - 64) rounded to 64 bits (msb set).
+ *
+ * \param j table index
+ * \returns table entry
+ */
+
+static ALWAYS_INLINE struct fpower
+compact_fpowers10 (int j)
+{
+  struct fpower f;
+  uint64_t p[3];
+
+  f.exp = compact_pow10 (j - 64, p) + 160;
+  f.mul = p[2] + (p[1] >> 63);
+  return f;
+}
+
+/* None of the rounded results overflows into the next power of 2. This
+   is checked by comparing all entries with the full tables. */
+#define	DPOWERS2(j)	compact_dpowers2 (j)
+#define	FPOWERS2(j)	compact_fpowers2 (j)
+#define	DPOWERS10(j)	compact_dpowers10 (j)
+#define	FPOWERS10(j)	compact_fpowers10 (j)
+#elif defined (FAST_CONVERT_SHARED_TABLES)
+/** \brief shared_fpowers2
+ * 
+ * \b Description
+ *
+ * Calculate fpowers2[j]: 2^(j - 151) / 10^exp rounded to 64 bits
+ * with 24 fraction bits, from the 96 bit dpowers10[362 - exp].
+ *
+ * \param j table index
+ * \returns table entry
+ */
+
+static ALWAYS_INLINE struct fpower
+shared_fpowers2 (int j)
+{
+  struct fpower f;
+  int i = j - 151;
+  unsigned int s;
+  uint64_t m;
+
+  f.exp = ((i * 78913) >> 18) - 11;
+  m = dpowers10[362 - f.exp].mul1;
+  s = 8 - i - dpowers10[362 - f.exp].exp - 32;
+  f.mul = (m >> s) + ((((m << 1) |
+			(dpowers10[362 - f.exp].mul2 >> 31)) >> s) & 1);
+  return f;
+}
+
+/** \brief shared_fpowers10
+ * 
+ * \b Description
+ *
+ * Calculate fpowers10[j]: 10^(j - 64) rounded to 64 bits (msb set),
+ * from the 96 bit dpowers10[j + 298].
+ *
+ * \param j table index
+ * \returns table entry
+ */
+
+static ALWAYS_INLINE struct fpower
+shared_fpowers10 (int j)
+{
+  struct fpower f;
+
+  f.mul = dpowers10[j + 298].mul1 + (dpowers10[j + 298].mul2 >> 31);
+  f.exp = dpowers10[j + 298].exp + 32;
+  return f;
+}
+
+/* The rounded results are equal to the float tables for all entries. */
+#define	DPOWERS2(j)	dpowers2[j]
+#define	FPOWERS2(j)	shared_fpowers2 (j)
+#define	DPOWERS10(j)	dpowers10[j]
+#define	FPOWERS10(j)	shared_fpowers10 (j)
+#elif defined (FAST_CONVERT_NUMA_TABLES)
+#define	DPOWERS2(j)	tls_dpowers2[j]
+#define	FPOWERS2(j)	tls_fpowers2[j]
+#define	DPOWERS10(j)	tls_dpowers10[j]
+#define	FPOWERS10(j)	tls_fpowers10[j]
+#else
+#define	DPOWERS2(j)	dpowers2[j]
+#define	FPOWERS2(j)	fpowers2[j]
+#define	DPOWERS10(j)	dpowers10[j]
+#define	FPOWERS10(j)	fpowers10[j]
+#endif
+
 /** \brief fast_sint32
  * 
  * \b Description
@@ -4432,17 +6770,17 @@ fast_sint32 (int32_t v, char *str)
   while (j >= 1000) {
     uint32_t d = j / 1000;
 
-    p = (char *) memcpy (p - 3, &num3[(j - d * 1000) * 3], 3);
+    p = (char *) memcpy (p - 3, &NUM3[(j - d * 1000) * 3], 3);
     j = d;
   }
   if (j >= 100) {
-    memcpy (p - 3, &num3[j * 3], 3);
+    memcpy (p - 3, &NUM3[j * 3], 3);
   }
   else if (j >= 10) {
-    memcpy (p - 2, &num3[j * 3] + 1, 2);
+    memcpy (p - 2, &NUM3[j * 3] + 1, 2);
   }
   else {
-    memcpy (p - 1, &num3[j * 3] + 2, 1);
+    memcpy (p - 1, &NUM3[j * 3] + 2, 1);
   }
   return len + is_signed;
 }
@@ -4477,17 +6815,17 @@ fast_sint64 (int64_t v, char *str)
   while (j >= 1000) {
     uint64_t d = j / 1000;
 
-    p = (char *) memcpy (p - 3, &num3[(j - d * 1000) * 3], 3);
+    p = (char *) memcpy (p - 3, &NUM3[(j - d * 1000) * 3], 3);
     j = d;
   }
   if (j >= 100) {
-    memcpy (p - 3, &num3[j * 3], 3);
+    memcpy (p - 3, &NUM3[j * 3], 3);
   }
   else if (j >= 10) {
-    memcpy (p - 2, &num3[j * 3] + 1, 2);
+    memcpy (p - 2, &NUM3[j * 3] + 1, 2);
   }
   else {
-    memcpy (p - 1, &num3[j * 3] + 2, 1);
+    memcpy (p - 1, &NUM3[j * 3] + 2, 1);
   }
 #else
   if (j >= 1000000000) {
@@ -4532,17 +6870,17 @@ fast_uint32 (uint32_t v, char *str)
   while (v >= 1000) {
     uint32_t d = v / 1000;
 
-    p = (char *) memcpy (p - 3, &num3[(v - d * 1000) * 3], 3);
+    p = (char *) memcpy (p - 3, &NUM3[(v - d * 1000) * 3], 3);
     v = d;
   }
   if (v >= 100) {
-    memcpy (p - 3, &num3[v * 3], 3);
+    memcpy (p - 3, &NUM3[v * 3], 3);
   }
   else if (v >= 10) {
-    memcpy (p - 2, &num3[v * 3] + 1, 2);
+    memcpy (p - 2, &NUM3[v * 3] + 1, 2);
   }
   else {
-    memcpy (p - 1, &num3[v * 3] + 2, 1);
+    memcpy (p - 1, &NUM3[v * 3] + 2, 1);
   }
   return len;
 }
@@ -4569,17 +6907,17 @@ fast_uint64 (uint64_t v, char *str)
   while (v >= 1000) {
     uint64_t d = v / 1000;
 
-    p = (char *) memcpy (p - 3, &num3[(v - d * 1000) * 3], 3);
+    p = (char *) memcpy (p - 3, &NUM3[(v - d * 1000) * 3], 3);
     v = d;
   }
   if (v >= 100) {
-    memcpy (p - 3, &num3[v * 3], 3);
+    memcpy (p - 3, &NUM3[v * 3], 3);
   }
   else if (v >= 10) {
-    memcpy (p - 2, &num3[v * 3] + 1, 2);
+    memcpy (p - 2, &NUM3[v * 3] + 1, 2);
   }
   else {
-    memcpy (p - 1, &num3[v * 3] + 2, 1);
+    memcpy (p - 1, &NUM3[v * 3] + 2, 1);
   }
 #else
   if (v >= 1000000000) {
@@ -4603,6 +6941,180 @@ fast_uint64 (uint64_t v, char *str)
   return len;
 }
 
+#if defined (__GNUC__) && defined (__BYTE_ORDER__)
+/** \brief base_hex8
+ * 
+ * \b Description
+ *
+ * Convert 32 bit value to 8 hex digits at once (SWAR)
+ *
+ * \param v value
+ * \param letter distance between '9' + 1 and 'a' or 'A'
+ * \returns 8 digits in memory order
+ */
+
+static ALWAYS_INLINE uint64_t
+base_hex8 (uint32_t v, uint64_t letter)
+{
+  uint64_t x = v;
+
+  /* spread nibbles over bytes, least significant nibble in byte 0 */
+  x = ((x & UINT64_C (0x00000000FFFF0000)) << 16) |
+    (x & UINT64_C (0x000000000000FFFF));
+  x = ((x & UINT64_C (0x0000FF000000FF00)) << 8) |
+    (x & UINT64_C (0x000000FF000000FF));
+  x = ((x & UINT64_C (0x00F000F000F000F0)) << 4) |
+    (x & UINT64_C (0x000F000F000F000F));
+  /* bytes > 9 get bit 4 set after adding 6 */
+  x += UINT64_C (0x3030303030303030) +
+    (((x + UINT64_C (0x0606060606060606)) >> 4) &
+     UINT64_C (0x0101010101010101)) * letter;
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  x = __builtin_bswap64 (x);
+#endif
+  return x;
+}
+#endif
+
+/** \brief base_pow2
+ * 
+ * \b Description
+ *
+ * Convert unsigned long integer to string with base 2, 4, 8, 16 or 32.
+ * The length follows from the leading zero's so the digits can be
+ * written in place with shift and mask.
+ *
+ * \param u Long integer
+ * \param str Buffer to print to
+ * \param base Base to use
+ * \param upper Use uppecase
+ * \returns lenght string
+ */
+
+static unsigned int
+base_pow2 (uint64_t u, char *str, int base, int upper)
+{
+  const char *d = upper ? "0123456789ABCDEFGHIJKLMNOPQRSTUV"
+    : "0123456789abcdefghijklmnopqrstuv";
+  unsigned int shift = base == 2 ? 1 : base == 4 ? 2 : base == 8 ? 3 :
+    base == 16 ? 4 : 5;
+  unsigned int mask = base - 1;
+  unsigned int bits;
+  unsigned int len;
+  char *p;
+
+#ifdef WIN
+  bits = 64 - __builtin_clzll (u | 1);
+#else
+#ifdef __GNUC__
+#if __WORDSIZE == 64
+  bits = 64 - __builtin_clzl (u | 1);
+#else
+  bits = 64 - __builtin_clzll (u | 1);
+#endif
+#else
+  bits = 64 - calc_clz64 (u | 1);
+#endif
+#endif
+#if defined (__GNUC__) && defined (__BYTE_ORDER__)
+  if (shift == 4) {
+    char tmp[16];
+    uint64_t letter = upper ? 'A' - '9' - 1 : 'a' - '9' - 1;
+    uint64_t hi = base_hex8 ((uint32_t) (u >> 32), letter);
+    uint64_t lo = base_hex8 ((uint32_t) u, letter);
+
+    len = (bits + 3) >> 2;
+    memcpy (tmp, &hi, 8);
+    memcpy (tmp + 8, &lo, 8);
+    /* overlapping fixed size copies */
+    p = tmp + 16 - len;
+    if (len >= 8) {
+      memcpy (str, p, 8);
+      memcpy (str + len - 8, tmp + 8, 8);
+    }
+    else if (len >= 4) {
+      memcpy (str, p, 4);
+      memcpy (str + len - 4, tmp + 12, 4);
+    }
+    else {
+      str[0] = p[0];
+      str[len >> 1] = p[len >> 1];
+      str[len - 1] = tmp[15];
+    }
+    str[len] = '\0';
+    return len;
+  }
+#endif
+  len = (bits + shift - 1) / shift;
+  p = str + len;
+  *p = '\0';
+  do {
+    *--p = d[u & mask];
+    u >>= shift;
+  } while (p != str);
+  return len;
+}
+
+/** \brief base_chunked
+ * 
+ * \b Description
+ *
+ * Convert unsigned long integer to string with any other base.
+ * The value is split in chunks of the largest power of base that fits
+ * in 32 bits. The digits of each chunk are extracted with a multiply by
+ * the reciprocal of base. No divisions are done.
+ *
+ * \param u Long integer
+ * \param str Buffer to print to
+ * \param base Base to use
+ * \param upper Use uppecase
+ * \returns lenght string
+ */
+
+static unsigned int
+base_chunked (uint64_t u, char *str, int base, int upper)
+{
+  const char *d = upper ? "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+    : "0123456789abcdefghijklmnopqrstuvwxyz";
+  const uint32_t pow = base_chunk[base].pow;
+  const uint64_t recip = base_chunk[base].recip;
+  char tmp[72];
+  char *p = &tmp[sizeof (tmp)];
+  uint32_t c;
+  unsigned int len;
+
+  while (u >= pow) {
+    uint64_t q = mul_64 (u, base_chunk[base].pow_recip);
+    uint64_t r = u - q * pow;
+    unsigned int k = base_chunk[base].digits;
+
+    /* the reciprocal is rounded down, so q can be one too small */
+    if (r >= pow) {
+      q++;
+      r -= pow;
+    }
+    c = (uint32_t) r;
+    do {
+      uint32_t t = (uint32_t) mul_64 (c, recip);
+
+      *--p = d[c - t * base];
+      c = t;
+    } while (--k);
+    u = q;
+  }
+  c = (uint32_t) u;
+  do {
+    uint32_t t = (uint32_t) mul_64 (c, recip);
+
+    *--p = d[c - t * base];
+    c = t;
+  } while (c);
+  len = &tmp[sizeof (tmp)] - p;
+  memcpy (str, p, len);
+  str[len] = '\0';
+  return len;
+}
+
 /** \brief fast_base_sint32
  * 
  * \b Description
@@ -4619,60 +7131,25 @@ fast_uint64 (uint64_t v, char *str)
 unsigned int
 fast_base_sint32 (int32_t s, char *str, int base, int upper)
 {
-  const char *d = upper ? "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-    : "0123456789abcdefghijklmnopqrstuvwxyz";
-  char tmp[100];
-  char *p = &tmp[sizeof (tmp) - 1];
   unsigned int is_signed = s < 0;
   uint32_t u = (uint32_t) s;
 
-  *p = '\0';
+  if (base == 10) {
+    return fast_sint32 (s, str);
+  }
   if (is_signed) {
     u = ~u + 1;
+    *str++ = '-';
   }
-  switch (base) {
-    DO_BASE (2);
-    DO_BASE (3);
-    DO_BASE (4);
-    DO_BASE (5);
-    DO_BASE (6);
-    DO_BASE (7);
-    DO_BASE (8);
-    DO_BASE (9);
-  case 10:
-    return fast_sint32 (s, str);
-    DO_BASE (11);
-    DO_BASE (12);
-    DO_BASE (13);
-    DO_BASE (14);
-    DO_BASE (15);
-    DO_BASE (16);
-    DO_BASE (17);
-    DO_BASE (18);
-    DO_BASE (19);
-    DO_BASE (20);
-    DO_BASE (21);
-    DO_BASE (22);
-    DO_BASE (23);
-    DO_BASE (24);
-    DO_BASE (25);
-    DO_BASE (26);
-    DO_BASE (27);
-    DO_BASE (28);
-    DO_BASE (29);
-    DO_BASE (30);
-    DO_BASE (31);
-    DO_BASE (32);
-    DO_BASE (33);
-    DO_BASE (34);
-    DO_BASE (35);
-    DO_BASE (36);
+  if (base < 2 || base > 36) {
+    /* only the sign for an invalid base */
+    *str = '\0';
+    return is_signed;
   }
-  if (is_signed) {
-    *--p = '-';
+  if ((base & (base - 1)) == 0) {
+    return base_pow2 (u, str, base, upper) + is_signed;
   }
-  memcpy (str, p, &tmp[sizeof (tmp)] - p);
-  return &tmp[sizeof (tmp) - 1] - p;
+  return base_chunked (u, str, base, upper) + is_signed;
 }
 
 /** \brief fast_base_sint64
@@ -4690,60 +7167,25 @@ fast_base_sint32 (int32_t s, char *str, int base, int upper)
 unsigned int
 fast_base_sint64 (int64_t s, char *str, int base, int upper)
 {
-  const char *d = upper ? "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-    : "0123456789abcdefghijklmnopqrstuvwxyz";
-  char tmp[100];
-  char *p = &tmp[sizeof (tmp) - 1];
   unsigned int is_signed = s < 0;
   uint64_t u = (uint64_t) s;
 
-  *p = '\0';
+  if (base == 10) {
+    return fast_sint64 (s, str);
+  }
   if (is_signed) {
     u = ~u + 1;
+    *str++ = '-';
   }
-  switch (base) {
-    DO_BASE (2);
-    DO_BASE (3);
-    DO_BASE (4);
-    DO_BASE (5);
-    DO_BASE (6);
-    DO_BASE (7);
-    DO_BASE (8);
-    DO_BASE (9);
-  case 10:
-    return fast_sint64 (s, str);
-    DO_BASE (11);
-    DO_BASE (12);
-    DO_BASE (13);
-    DO_BASE (14);
-    DO_BASE (15);
-    DO_BASE (16);
-    DO_BASE (17);
-    DO_BASE (18);
-    DO_BASE (19);
-    DO_BASE (20);
-    DO_BASE (21);
-    DO_BASE (22);
-    DO_BASE (23);
-    DO_BASE (24);
-    DO_BASE (25);
-    DO_BASE (26);
-    DO_BASE (27);
-    DO_BASE (28);
-    DO_BASE (29);
-    DO_BASE (30);
-    DO_BASE (31);
-    DO_BASE (32);
-    DO_BASE (33);
-    DO_BASE (34);
-    DO_BASE (35);
-    DO_BASE (36);
+  if (base < 2 || base > 36) {
+    /* only the sign for an invalid base */
+    *str = '\0';
+    return is_signed;
   }
-  if (is_signed) {
-    *--p = '-';
+  if ((base & (base - 1)) == 0) {
+    return base_pow2 (u, str, base, upper) + is_signed;
   }
-  memcpy (str, p, &tmp[sizeof (tmp)] - p);
-  return &tmp[sizeof (tmp) - 1] - p;
+  return base_chunked (u, str, base, upper) + is_signed;
 }
 
 /** \brief fast_uint32
@@ -4762,52 +7204,17 @@ fast_base_sint64 (int64_t s, char *str, int base, int upper)
 unsigned int
 fast_base_uint32 (uint32_t u, char *str, int base, int upper)
 {
-  const char *d = upper ? "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-    : "0123456789abcdefghijklmnopqrstuvwxyz";
-  char tmp[100];
-  char *p = &tmp[sizeof (tmp) - 1];
-
-  *p = '\0';
-  switch (base) {
-    DO_BASE (2);
-    DO_BASE (3);
-    DO_BASE (4);
-    DO_BASE (5);
-    DO_BASE (6);
-    DO_BASE (7);
-    DO_BASE (8);
-    DO_BASE (9);
-  case 10:
+  if (base == 10) {
     return fast_uint32 (u, str);
-    DO_BASE (11);
-    DO_BASE (12);
-    DO_BASE (13);
-    DO_BASE (14);
-    DO_BASE (15);
-    DO_BASE (16);
-    DO_BASE (17);
-    DO_BASE (18);
-    DO_BASE (19);
-    DO_BASE (20);
-    DO_BASE (21);
-    DO_BASE (22);
-    DO_BASE (23);
-    DO_BASE (24);
-    DO_BASE (25);
-    DO_BASE (26);
-    DO_BASE (27);
-    DO_BASE (28);
-    DO_BASE (29);
-    DO_BASE (30);
-    DO_BASE (31);
-    DO_BASE (32);
-    DO_BASE (33);
-    DO_BASE (34);
-    DO_BASE (35);
-    DO_BASE (36);
-  }
-  memcpy (str, p, &tmp[sizeof (tmp)] - p);
-  return &tmp[sizeof (tmp) - 1] - p;
+  }
+  if (base < 2 || base > 36) {
+    *str = '\0';
+    return 0;
+  }
+  if ((base & (base - 1)) == 0) {
+    return base_pow2 (u, str, base, upper);
+  }
+  return base_chunked (u, str, base, upper);
 }
 
 /** \brief fast_base_uint64
@@ -4826,136 +7233,413 @@ fast_base_uint32 (uint32_t u, char *str, int base, int upper)
 unsigned int
 fast_base_uint64 (uint64_t u, char *str, int base, int upper)
 {
-  const char *d = upper ? "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-    : "0123456789abcdefghijklmnopqrstuvwxyz";
-  char tmp[100];
-  char *p = &tmp[sizeof (tmp) - 1];
-
-  *p = '\0';
-  switch (base) {
-    DO_BASE (2);
-    DO_BASE (3);
-    DO_BASE (4);
-    DO_BASE (5);
-    DO_BASE (6);
-    DO_BASE (7);
-    DO_BASE (8);
-    DO_BASE (9);
-  case 10:
+  if (base == 10) {
     return fast_uint64 (u, str);
-    DO_BASE (11);
-    DO_BASE (12);
-    DO_BASE (13);
-    DO_BASE (14);
-    DO_BASE (15);
-    DO_BASE (16);
-    DO_BASE (17);
-    DO_BASE (18);
-    DO_BASE (19);
-    DO_BASE (20);
-    DO_BASE (21);
-    DO_BASE (22);
-    DO_BASE (23);
-    DO_BASE (24);
-    DO_BASE (25);
-    DO_BASE (26);
-    DO_BASE (27);
-    DO_BASE (28);
-    DO_BASE (29);
-    DO_BASE (30);
-    DO_BASE (31);
-    DO_BASE (32);
-    DO_BASE (33);
-    DO_BASE (34);
-    DO_BASE (35);
-    DO_BASE (36);
-  }
-  memcpy (str, p, &tmp[sizeof (tmp)] - p);
-  return &tmp[sizeof (tmp) - 1] - p;
+  }
+  if (base < 2 || base > 36) {
+    *str = '\0';
+    return 0;
+  }
+  if ((base & (base - 1)) == 0) {
+    return base_pow2 (u, str, base, upper);
+  }
+  return base_chunked (u, str, base, upper);
 }
 
-/** \brief fast_strtos32
+#ifdef __SIZEOF_INT128__
+/** \brief pad_uint64_19
  * 
  * \b Description
  *
- * Convert string to signed integer
+ * Convert value below 10^19 to 19 digits with leading zero's
  *
- * \param str String to convert from
- * \param endptr optional endptr
- * \returns converted string
+ * \param v Long integer
+ * \param p Buffer to print to
  */
 
-int32_t
-fast_strtos32 (const char *str, char **endptr, int base)
+static void
+pad_uint64_19 (uint64_t v, char *p)
 {
-  uint32_t n;
-  unsigned int sign = 0;
-  unsigned char *cp = (unsigned char *) str;
-#define	M(x)	(2147483647u / (x))
-  static const uint32_t maxp[37] = {
-    0, 0, M (2), M (3), M (4), M (5), M (6), M (7), M (8), M (9), M (10),
-    M (11), M (12), M (13), M (14), M (15), M (16), M (17), M (18),
-    M (19), M (20), M (21), M (22), M (23), M (24), M (25), M (26),
-    M (27), M (28), M (29), M (30), M (31), M (32), M (33), M (34),
-    M (35), M (36)
-  };
-#undef M
-#define	M(x)	(2147483648u / (x))
-  static const uint32_t maxn[37] = {
-    0, 0, M (2), M (3), M (4), M (5), M (6), M (7), M (8), M (9), M (10),
-    M (11), M (12), M (13), M (14), M (15), M (16), M (17), M (18),
-    M (19), M (20), M (21), M (22), M (23), M (24), M (25), M (26),
-    M (27), M (28), M (29), M (30), M (31), M (32), M (33), M (34),
-    M (35), M (36)
-  };
-#undef M
-#define	R(x)	(2147483647u % (x))
-  static const uint32_t remp[37] = {
-    0, 0, R (2), R (3), R (4), R (5), R (6), R (7), R (8), R (9), R (10),
-    R (11), R (12), R (13), R (14), R (15), R (16), R (17), R (18),
-    R (19), R (20), R (21), R (22), R (23), R (24), R (25), R (26),
-    R (27), R (28), R (29), R (30), R (31), R (32), R (33), R (34),
-    R (35), R (36)
-  };
-#undef R
-#define	R(x)	(2147483648u % (x))
-  static const uint32_t remn[37] = {
-    0, 0, R (2), R (3), R (4), R (5), R (6), R (7), R (8), R (9), R (10),
-    R (11), R (12), R (13), R (14), R (15), R (16), R (17), R (18),
-    R (19), R (20), R (21), R (22), R (23), R (24), R (25), R (26),
-    R (27), R (28), R (29), R (30), R (31), R (32), R (33), R (34),
-    R (35), R (36)
-  };
-#undef R
+  unsigned int i;
 
-  while (isspace (*cp)) {
-    cp++;
-  }
-  if (*cp == '+') {
-    cp++;
-  }
-  else if (*cp == '-') {
-    sign = 1;
-    cp++;
-  }
-  n = 0;
-  if (UNLIKELY (base) &&
-      (base != 10 || *cp < '1') &&
-      (base != 8 || *cp != '0' || cp[1] < '0' || cp[1] > '7') &&
-      (base != 16 || *cp != '0' || (cp[1] != 'x' && cp[1] != 'X'))) {
-    if (base >= 2 && base <= 36) {
-      uint32_t max = sign ? maxn[base] : maxp[base];
-      uint32_t rem = sign ? remn[base] : remp[base];
+  p += 19;
+  for (i = 0; i < 6; i++) {
+    uint64_t d = v / 1000;
 
-      if (base <= 10) {
-	unsigned char u = *cp;
-	unsigned char end = '0' + base;
+    p = (char *) memcpy (p - 3, &NUM3[(v - d * 1000) * 3], 3);
+    v = d;
+  }
+  p[-1] = '0' + (char) v;
+}
 
-	if (u >= '0' && u < end) {
-	  do {
-	    uint32_t v = convert_num[u];
+/** \brief fast_sint128
+ * 
+ * \b Description
+ *
+ * Convert signed 128 bit integer to string
+ *
+ * \param v 128 bit integer
+ * \param str Buffer to print to
+ * \returns lenght string
+ */
+
+unsigned int
+fast_sint128 (__int128 v, char *str)
+{
+  unsigned __int128 j = (unsigned __int128) v;
+
+  if (v < 0) {
+    *str = '-';
+    return fast_uint128 (~j + 1, str + 1) + 1;
+  }
+  return fast_uint128 (j, str);
+}
+
+/** \brief fast_uint128
+ * 
+ * \b Description
+ *
+ * Convert unsigned 128 bit integer to string
+ * The value is split in 10^19 chunks that are printed with fast_uint64.
+ *
+ * \param v 128 bit integer
+ * \param str Buffer to print to
+ * \returns lenght string
+ */
+
+unsigned int
+fast_uint128 (unsigned __int128 v, char *str)
+{
+  const uint64_t p19 = ipowers64[19];
+  uint64_t lo;
+  unsigned int len;
+
+  if ((v >> 64) == 0) {
+    return fast_uint64 ((uint64_t) v, str);
+  }
+  lo = (uint64_t) (v % p19);
+  v /= p19;
+  if ((v >> 64) == 0) {
+    len = fast_uint64 ((uint64_t) v, str);
+  }
+  else {
+    uint64_t mid = (uint64_t) (v % p19);
+
+    len = fast_uint64 ((uint64_t) (v / p19), str);
+    pad_uint64_19 (mid, str + len);
+    len += 19;
+  }
+  pad_uint64_19 (lo, str + len);
+  len += 19;
+  str[len] = '\0';
+  return len;
+}
+
+/** \brief fast_base_sint128
+ * 
+ * \b Description
+ *
+ * Convert signed 128 bit integer to string with base and upper case
+ *
+ * \param v 128 bit integer
+ * \param str Buffer to print to
+ * \param base Base to use
+ * \param upper Use uppecase
+ * \returns lenght string
+ */
+
+unsigned int
+fast_base_sint128 (__int128 s, char *str, int base, int upper)
+{
+  unsigned __int128 u = (unsigned __int128) s;
+
+  if (s < 0 && base >= 2 && base <= 36) {
+    *str = '-';
+    return fast_base_uint128 (~u + 1, str + 1, base, upper) + 1;
+  }
+  return fast_base_uint128 (u, str, base, upper);
+}
+
+/** \brief fast_base_uint128
+ * 
+ * \b Description
+ *
+ * Convert unsigned 128 bit integer to string with base and upper case
+ * The value is split in chunks of the largest power of base that fits
+ * in 64 bits. Each chunk is printed with fast_base_uint64.
+ *
+ * \param v 128 bit integer
+ * \param str Buffer to print to
+ * \param base Base to use
+ * \param upper Use uppecase
+ * \returns lenght string
+ */
+
+unsigned int
+fast_base_uint128 (unsigned __int128 u, char *str, int base, int upper)
+{
+  uint64_t chunk[3];
+  unsigned int n = 0;
+  unsigned int k;
+  unsigned int len;
+
+  if ((u >> 64) == 0 || base < 2 || base > 36) {
+    return fast_base_uint64 ((uint64_t) u, str, base, upper);
+  }
+  if (base == 10) {
+    return fast_uint128 (u, str);
+  }
+  if (base == 2 || base == 4 || base == 16) {
+    k = base == 2 ? 64 : base == 4 ? 32 : 16;
+    chunk[n++] = (uint64_t) u;
+    u >>= 64;
+  }
+  else {
+    uint64_t p = base;
+
+    for (k = 1; p <= UINT64_C (18446744073709551615) / base; k++) {
+      p *= base;
+    }
+    do {
+      chunk[n++] = (uint64_t) (u % p);
+      u /= p;
+    } while (u >> 64);
+  }
+  len = fast_base_uint64 ((uint64_t) u, str, base, upper);
+  while (n) {
+    char tmp[65];
+    unsigned int l = fast_base_uint64 (chunk[--n], tmp, base, upper);
+
+    memset (str + len, '0', k - l);
+    memcpy (str + len + k - l, tmp, l + 1);
+    len += k;
+  }
+  return len;
+}
+#endif
+
+#if defined (__GNUC__) && defined (__BYTE_ORDER__)
+/** \brief hex_pack8
+ * 
+ * \b Description
+ *
+ * Convert 8 hex digits at once (SWAR). All 8 characters must be valid.
+ *
+ * \param p pointer to digits
+ * \returns 32 bit value
+ */
+
+static ALWAYS_INLINE uint64_t
+hex_pack8 (const unsigned char *p)
+{
+  uint64_t x;
+
+  memcpy (&x, p, 8);
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  x = __builtin_bswap64 (x);
+#endif
+  /* '0'-'9' -> 0-9, letters have bit 6 set: 'a'-'f'/'A'-'F' -> 10-15 */
+  x = (x & UINT64_C (0x0F0F0F0F0F0F0F0F)) +
+    ((x >> 6) & UINT64_C (0x0101010101010101)) * 9;
+  /* first character is most significant and in the lowest byte */
+  x = ((x << 4) | (x >> 8)) & UINT64_C (0x00FF00FF00FF00FF);
+  x = ((x << 8) | (x >> 16)) & UINT64_C (0x0000FFFF0000FFFF);
+  return ((x << 16) | (x >> 32)) & UINT64_C (0x00000000FFFFFFFF);
+}
+
+/** \brief hex_class8
+ * 
+ * \b Description
+ *
+ * Check 8 characters for hex digits at once (SWAR).
+ *
+ * \param p pointer to characters, 8 bytes are read
+ * \returns bit 7 set in each byte that is not a hex digit, first
+ * character in the lowest byte
+ */
+
+static ALWAYS_INLINE uint64_t
+hex_class8 (const unsigned char *p)
+{
+  const uint64_t h = UINT64_C (0x8080808080808080);
+  const uint64_t ones = UINT64_C (0x0101010101010101);
+  uint64_t x;
+  uint64_t l;
+  uint64_t digit;
+  uint64_t letter;
+
+  memcpy (&x, p, 8);
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  x = __builtin_bswap64 (x);
+#endif
+  /* bit 7 of x7 + (0x80 - c) is set when the byte is >= c, the low 7
+   * bits never carry into the next byte */
+  l = (x & ~h) | (ones * 0x20);
+  digit = ((x & ~h) + ones * (0x80 - '0')) &
+    ~((x & ~h) + ones * (0x80 - '9' - 1));
+  letter = (l + ones * (0x80 - 'a')) & ~(l + ones * (0x80 - 'f' - 1));
+  return ~((digit | letter) & ~x) & h;
+}
+#endif
+
+/** \brief parse_hex
+ * 
+ * \b Description
+ *
+ * Convert hex digits. Leading zero's are skipped and the number of
+ * digits is counted first, so overflow follows from the count and
+ * digits can be converted 8 at a time.
+ *
+ * \param cpp pointer to string, updated to first character not used
+ * \param max_digits 8 (32 bits) or 16 (64 bits)
+ * \param overflow set when more digits follow than fit
+ * \returns converted value
+ */
+
+static ALWAYS_INLINE uint64_t
+parse_hex (unsigned char **cpp, unsigned int max_digits, int *overflow)
+{
+  unsigned char *cp = *cpp;
+  unsigned int n = 0;
+  uint64_t v = 0;
+
+  while (*cp == '0') {
+    cp++;
+  }
+  /* stop after max_digits + 1, the rest is skipped by the caller */
+  while (n <= max_digits) {
+#if defined (__GNUC__) && defined (__BYTE_ORDER__) && \
+    !defined (__SANITIZE_ADDRESS__)
+    /* 8 at a time when the load stays in the page, this can read past
+     * the end of the string, so not with -fsanitize=address */
+    if (((uintptr_t) (cp + n) & 4095) <= 4088) {
+      uint64_t bad = hex_class8 (cp + n);
+
+      if (bad) {
+	n += __builtin_ctzll (bad) >> 3;
+	break;
+      }
+      n += 8;
+      continue;
+    }
+#endif
+    if (!isxdigit (cp[n])) {
+      break;
+    }
+    n++;
+  }
+  if (UNLIKELY (n > max_digits)) {
+    STAT_INC (int_overflow);
+    *overflow = 1;
+    n = max_digits;
+  }
+#if defined (__GNUC__) && defined (__BYTE_ORDER__)
+  if (n >= 8) {
+    /* leading n - 8 digits of the first block and an overlapping block
+     * with the last 8 digits */
+    v = ((hex_pack8 (cp) >> (4 * (16 - n))) << 32) | hex_pack8 (cp + n - 8);
+  }
+  else
+#endif
+  {
+    unsigned int i;
+
+    for (i = 0; i < n; i++) {
+      v = v * 16 + convert_num[cp[i]];
+    }
+  }
+  *cpp = cp + n;
+  return v;
+}
+
+/** \brief strtos32_impl
+ * 
+ * \b Description
+ *
+ * Convert string to signed integer
+ *
+ * \param str String to convert from
+ * \param endptr optional endptr
+ * \param base base of converting.
+ * \param status optional status
+ * \returns converted string
+ */
+
+static ALWAYS_INLINE int32_t
+strtos32_impl (const char *str, char **endptr, int base,
+	       enum fast_convert_status *status)
+{
+  uint32_t n;
+  unsigned int sign = 0;
+  int overflow = 0;
+  unsigned char *cp = (unsigned char *) str;
+#define	M(x)	(2147483647u / (x))
+  static const uint32_t maxp[37] = {
+    0, 0, M (2), M (3), M (4), M (5), M (6), M (7), M (8), M (9), M (10),
+    M (11), M (12), M (13), M (14), M (15), M (16), M (17), M (18),
+    M (19), M (20), M (21), M (22), M (23), M (24), M (25), M (26),
+    M (27), M (28), M (29), M (30), M (31), M (32), M (33), M (34),
+    M (35), M (36)
+  };
+#undef M
+#define	M(x)	(2147483648u / (x))
+  static const uint32_t maxn[37] = {
+    0, 0, M (2), M (3), M (4), M (5), M (6), M (7), M (8), M (9), M (10),
+    M (11), M (12), M (13), M (14), M (15), M (16), M (17), M (18),
+    M (19), M (20), M (21), M (22), M (23), M (24), M (25), M (26),
+    M (27), M (28), M (29), M (30), M (31), M (32), M (33), M (34),
+    M (35), M (36)
+  };
+#undef M
+#define	R(x)	(2147483647u % (x))
+  static const uint32_t remp[37] = {
+    0, 0, R (2), R (3), R (4), R (5), R (6), R (7), R (8), R (9), R (10),
+    R (11), R (12), R (13), R (14), R (15), R (16), R (17), R (18),
+    R (19), R (20), R (21), R (22), R (23), R (24), R (25), R (26),
+    R (27), R (28), R (29), R (30), R (31), R (32), R (33), R (34),
+    R (35), R (36)
+  };
+#undef R
+#define	R(x)	(2147483648u % (x))
+  static const uint32_t remn[37] = {
+    0, 0, R (2), R (3), R (4), R (5), R (6), R (7), R (8), R (9), R (10),
+    R (11), R (12), R (13), R (14), R (15), R (16), R (17), R (18),
+    R (19), R (20), R (21), R (22), R (23), R (24), R (25), R (26),
+    R (27), R (28), R (29), R (30), R (31), R (32), R (33), R (34),
+    R (35), R (36)
+  };
+#undef R
+
+  while (isspace (*cp)) {
+    cp++;
+  }
+  if (*cp == '+') {
+    cp++;
+  }
+  else if (*cp == '-') {
+    sign = 1;
+    cp++;
+  }
+  n = 0;
+  if (UNLIKELY (base) &&
+      (base != 10 || *cp < '1') &&
+      (base != 8 || *cp != '0' || cp[1] < '0' || cp[1] > '7') &&
+      (base != 16 || *cp != '0' || (cp[1] != 'x' && cp[1] != 'X'))) {
+    if (base >= 2 && base <= 36) {
+      uint32_t max = sign ? maxn[base] : maxp[base];
+      uint32_t rem = sign ? remn[base] : remp[base];
+
+      if (base <= 10) {
+	unsigned char u = *cp;
+	unsigned char end = '0' + base;
+
+	if (u >= '0' && u < end) {
+	  do {
+	    uint32_t v = convert_num[u];
 
 	    if (UNLIKELY (n >= max) && (n > max || (n == max && v > rem))) {
+	      STAT_INC (int_overflow);
+	      overflow = 1;
 	      break;
 	    }
 	    n = n * base + v;
@@ -4975,6 +7659,8 @@ fast_strtos32 (const char *str, char **endptr, int base)
 	    uint32_t v = convert_num[u];
 
 	    if (UNLIKELY (n >= max) && (n > max || (n == max && v > rem))) {
+	      STAT_INC (int_overflow);
+	      overflow = 1;
 	      break;
 	    }
 	    n = n * base + v;
@@ -5001,6 +7687,8 @@ fast_strtos32 (const char *str, char **endptr, int base)
 	uint32_t v = convert_num[u];
 
 	if (UNLIKELY (n >= max) && (n > max || (n == max && v > rem))) {
+	  STAT_INC (int_overflow);
+	  overflow = 1;
 	  break;
 	}
 	n = n * 16 + v;
@@ -5016,6 +7704,8 @@ fast_strtos32 (const char *str, char **endptr, int base)
 	uint32_t v = convert_num[u];
 
 	if (UNLIKELY (n >= max) && (n > max || (n == max && v > rem))) {
+	  STAT_INC (int_overflow);
+	  overflow = 1;
 	  break;
 	}
 	n = n * 8 + v;
@@ -5032,6 +7722,8 @@ fast_strtos32 (const char *str, char **endptr, int base)
       uint32_t v = convert_num[u];
 
       if (UNLIKELY (n >= max) && (n > max || (n == max && v > rem))) {
+	STAT_INC (int_overflow);
+	overflow = 1;
 	break;
       }
       n = n * 10 + v;
@@ -5041,13 +7733,57 @@ fast_strtos32 (const char *str, char **endptr, int base)
   else {
     cp = (unsigned char *) str;
   }
+  if (status) {
+    *status = overflow ? FAST_CONVERT_OVERFLOW :
+      cp == (unsigned char *) str ? FAST_CONVERT_NO_DIGITS :
+      *cp ? FAST_CONVERT_TRAILING : FAST_CONVERT_OK;
+  }
   if (endptr) {
     *endptr = (char *) cp;
   }
   return sign ? -(int32_t) n : (int32_t) n;
 }
 
-/** \brief fast_strtos64
+/** \brief fast_strtos32
+ * 
+ * \b Description
+ *
+ * Convert string to signed integer
+ *
+ * \param str String to convert from
+ * \param endptr optional endptr
+ * \param base base of converting.
+ * \returns converted string
+ */
+
+int32_t
+fast_strtos32 (const char *str, char **endptr, int base)
+{
+  return strtos32_impl (str, endptr, base, NULL);
+}
+
+/** \brief fast_strtos32_status
+ * 
+ * \b Description
+ *
+ * Convert string to signed integer
+ * The status tells why parsing stopped. errno is never changed.
+ *
+ * \param str String to convert from
+ * \param endptr optional endptr
+ * \param base base of converting.
+ * \param status returns FAST_CONVERT_OK, OVERFLOW, NO_DIGITS or TRAILING
+ * \returns converted string
+ */
+
+int32_t
+fast_strtos32_status (const char *str, char **endptr, int base,
+		      enum fast_convert_status *status)
+{
+  return strtos32_impl (str, endptr, base, status);
+}
+
+/** \brief strtos64_impl
  * 
  * \b Description
  *
@@ -5055,14 +7791,18 @@ fast_strtos32 (const char *str, char **endptr, int base)
  *
  * \param str String to convert from
  * \param endptr optional endptr
+ * \param base base of converting.
+ * \param status optional status
  * \returns converted string
  */
 
-int64_t
-fast_strtos64 (const char *str, char **endptr, int base)
+static ALWAYS_INLINE int64_t
+strtos64_impl (const char *str, char **endptr, int base,
+	       enum fast_convert_status *status)
 {
   uint64_t n;
   unsigned int sign = 0;
+  int overflow = 0;
   unsigned char *cp = (unsigned char *) str;
 #define	M(x)	(UINT64_C(9223372036854775807) / (x))
   static const uint64_t maxp[37] = {
@@ -5129,6 +7869,8 @@ fast_strtos64 (const char *str, char **endptr, int base)
 	    uint32_t v = convert_num[u];
 
 	    if (UNLIKELY (n >= max) && (n > max || (n == max && v > rem))) {
+	      STAT_INC (int_overflow);
+	      overflow = 1;
 	      break;
 	    }
 	    n = n * base + v;
@@ -5148,6 +7890,8 @@ fast_strtos64 (const char *str, char **endptr, int base)
 	    uint32_t v = convert_num[u];
 
 	    if (UNLIKELY (n >= max) && (n > max || (n == max && v > rem))) {
+	      STAT_INC (int_overflow);
+	      overflow = 1;
 	      break;
 	    }
 	    n = n * base + v;
@@ -5174,6 +7918,8 @@ fast_strtos64 (const char *str, char **endptr, int base)
 	uint32_t v = convert_num[u];
 
 	if (UNLIKELY (n >= max) && (n > max || (n == max && v > rem))) {
+	  STAT_INC (int_overflow);
+	  overflow = 1;
 	  break;
 	}
 	n = n * 16 + v;
@@ -5189,6 +7935,8 @@ fast_strtos64 (const char *str, char **endptr, int base)
 	uint32_t v = convert_num[u];
 
 	if (UNLIKELY (n >= max) && (n > max || (n == max && v > rem))) {
+	  STAT_INC (int_overflow);
+	  overflow = 1;
 	  break;
 	}
 	n = n * 8 + v;
@@ -5205,6 +7953,8 @@ fast_strtos64 (const char *str, char **endptr, int base)
       uint32_t v = convert_num[u];
 
       if (UNLIKELY (n >= max) && (n > max || (n == max && v > rem))) {
+	STAT_INC (int_overflow);
+	overflow = 1;
 	break;
       }
       n = n * 10 + v;
@@ -5214,44 +7964,92 @@ fast_strtos64 (const char *str, char **endptr, int base)
   else {
     cp = (unsigned char *) str;
   }
+  if (status) {
+    *status = overflow ? FAST_CONVERT_OVERFLOW :
+      cp == (unsigned char *) str ? FAST_CONVERT_NO_DIGITS :
+      *cp ? FAST_CONVERT_TRAILING : FAST_CONVERT_OK;
+  }
   if (endptr) {
     *endptr = (char *) cp;
   }
   return sign ? -(int64_t) n : (int64_t) n;
 }
 
-/** \brief fast_strtou32
+/** \brief fast_strtos64
  * 
  * \b Description
  *
- * Convert string to unsigned int
+ * Convert string to signed long
  *
  * \param str String to convert from
  * \param endptr optional endptr
+ * \param base base of converting.
  * \returns converted string
  */
 
-uint32_t
-fast_strtou32 (const char *str, char **endptr, int base)
+int64_t
+fast_strtos64 (const char *str, char **endptr, int base)
 {
-  uint32_t n;
-  unsigned char *cp = (unsigned char *) str;
-#define	M(x)	(4294967295u / (x))
-  static const uint32_t maxp[37] = {
-    0, 0, M (2), M (3), M (4), M (5), M (6), M (7), M (8), M (9), M (10),
-    M (11), M (12), M (13), M (14), M (15), M (16), M (17), M (18),
-    M (19), M (20), M (21), M (22), M (23), M (24), M (25), M (26),
-    M (27), M (28), M (29), M (30), M (31), M (32), M (33), M (34),
-    M (35), M (36)
-  };
-#undef M
-#define	R(x)	(4294967295u % (x))
-  static const uint32_t remp[37] = {
-    0, 0, R (2), R (3), R (4), R (5), R (6), R (7), R (8), R (9), R (10),
-    R (11), R (12), R (13), R (14), R (15), R (16), R (17), R (18),
-    R (19), R (20), R (21), R (22), R (23), R (24), R (25), R (26),
-    R (27), R (28), R (29), R (30), R (31), R (32), R (33), R (34),
-    R (35), R (36)
+  return strtos64_impl (str, endptr, base, NULL);
+}
+
+/** \brief fast_strtos64_status
+ * 
+ * \b Description
+ *
+ * Convert string to signed long
+ * The status tells why parsing stopped. errno is never changed.
+ *
+ * \param str String to convert from
+ * \param endptr optional endptr
+ * \param base base of converting.
+ * \param status returns FAST_CONVERT_OK, OVERFLOW, NO_DIGITS or TRAILING
+ * \returns converted string
+ */
+
+int64_t
+fast_strtos64_status (const char *str, char **endptr, int base,
+		      enum fast_convert_status *status)
+{
+  return strtos64_impl (str, endptr, base, status);
+}
+
+/** \brief strtou32_impl
+ * 
+ * \b Description
+ *
+ * Convert string to unsigned int
+ *
+ * \param str String to convert from
+ * \param endptr optional endptr
+ * \param base base of converting.
+ * \param status optional status
+ * \returns converted string
+ */
+
+static ALWAYS_INLINE uint32_t
+strtou32_impl (const char *str, char **endptr, int base,
+	       enum fast_convert_status *status)
+{
+  uint32_t n;
+  int overflow = 0;
+  unsigned char *cp = (unsigned char *) str;
+#define	M(x)	(4294967295u / (x))
+  static const uint32_t maxp[37] = {
+    0, 0, M (2), M (3), M (4), M (5), M (6), M (7), M (8), M (9), M (10),
+    M (11), M (12), M (13), M (14), M (15), M (16), M (17), M (18),
+    M (19), M (20), M (21), M (22), M (23), M (24), M (25), M (26),
+    M (27), M (28), M (29), M (30), M (31), M (32), M (33), M (34),
+    M (35), M (36)
+  };
+#undef M
+#define	R(x)	(4294967295u % (x))
+  static const uint32_t remp[37] = {
+    0, 0, R (2), R (3), R (4), R (5), R (6), R (7), R (8), R (9), R (10),
+    R (11), R (12), R (13), R (14), R (15), R (16), R (17), R (18),
+    R (19), R (20), R (21), R (22), R (23), R (24), R (25), R (26),
+    R (27), R (28), R (29), R (30), R (31), R (32), R (33), R (34),
+    R (35), R (36)
   };
 #undef R
 
@@ -5267,7 +8065,15 @@ fast_strtou32 (const char *str, char **endptr, int base)
       uint32_t max = maxp[base];
       uint32_t rem = remp[base];
 
-      if (base <= 10) {
+      if (base == 16) {
+	if (isxdigit (*cp)) {
+	  n = parse_hex (&cp, 8, &overflow);
+	}
+	else {
+	  cp = (unsigned char *) str;
+	}
+      }
+      else if (base <= 10) {
 	unsigned char u = *cp;
 	unsigned char end = '0' + base;
 
@@ -5276,6 +8082,8 @@ fast_strtou32 (const char *str, char **endptr, int base)
 	    uint32_t v = convert_num[u];
 
 	    if (UNLIKELY (n >= max) && (n > max || (n == max && v > rem))) {
+	      STAT_INC (int_overflow);
+	      overflow = 1;
 	      break;
 	    }
 	    n = n * base + v;
@@ -5295,6 +8103,8 @@ fast_strtou32 (const char *str, char **endptr, int base)
 	    uint32_t v = convert_num[u];
 
 	    if (UNLIKELY (n >= max) && (n > max || (n == max && v > rem))) {
+	      STAT_INC (int_overflow);
+	      overflow = 1;
 	      break;
 	    }
 	    n = n * base + v;
@@ -5313,19 +8123,8 @@ fast_strtou32 (const char *str, char **endptr, int base)
   else if (*cp == '0') {
     cp++;
     if ((*cp == 'x' || *cp == 'X') && isxdigit (cp[1])) {
-      uint32_t max = maxp[16];
-      uint32_t rem = remp[16];
-      unsigned char u = *++cp;
-
-      do {
-	uint32_t v = convert_num[u];
-
-	if (UNLIKELY (n >= max) && (n > max || (n == max && v > rem))) {
-	  break;
-	}
-	n = n * 16 + v;
-	u = *++cp;
-      } while (isxdigit (u));
+      cp++;
+      n = parse_hex (&cp, 8, &overflow);
     }
     else {
       uint32_t max = maxp[8];
@@ -5336,6 +8135,8 @@ fast_strtou32 (const char *str, char **endptr, int base)
 	uint32_t v = convert_num[u];
 
 	if (UNLIKELY (n >= max) && (n > max || (n == max && v > rem))) {
+	  STAT_INC (int_overflow);
+	  overflow = 1;
 	  break;
 	}
 	n = n * 8 + v;
@@ -5352,6 +8153,8 @@ fast_strtou32 (const char *str, char **endptr, int base)
       uint32_t v = convert_num[u];
 
       if (UNLIKELY (n >= max) && (n > max || (n == max && v > rem))) {
+	STAT_INC (int_overflow);
+	overflow = 1;
 	break;
       }
       n = n * 10 + v;
@@ -5361,13 +8164,57 @@ fast_strtou32 (const char *str, char **endptr, int base)
   else {
     cp = (unsigned char *) str;
   }
+  if (status) {
+    *status = overflow ? FAST_CONVERT_OVERFLOW :
+      cp == (unsigned char *) str ? FAST_CONVERT_NO_DIGITS :
+      *cp ? FAST_CONVERT_TRAILING : FAST_CONVERT_OK;
+  }
   if (endptr) {
     *endptr = (char *) cp;
   }
   return n;
 }
 
-/** \brief fast_strtou64
+/** \brief fast_strtou32
+ * 
+ * \b Description
+ *
+ * Convert string to unsigned int
+ *
+ * \param str String to convert from
+ * \param endptr optional endptr
+ * \param base base of converting.
+ * \returns converted string
+ */
+
+uint32_t
+fast_strtou32 (const char *str, char **endptr, int base)
+{
+  return strtou32_impl (str, endptr, base, NULL);
+}
+
+/** \brief fast_strtou32_status
+ * 
+ * \b Description
+ *
+ * Convert string to unsigned int
+ * The status tells why parsing stopped. errno is never changed.
+ *
+ * \param str String to convert from
+ * \param endptr optional endptr
+ * \param base base of converting.
+ * \param status returns FAST_CONVERT_OK, OVERFLOW, NO_DIGITS or TRAILING
+ * \returns converted string
+ */
+
+uint32_t
+fast_strtou32_status (const char *str, char **endptr, int base,
+		      enum fast_convert_status *status)
+{
+  return strtou32_impl (str, endptr, base, status);
+}
+
+/** \brief strtou64_impl
  * 
  * \b Description
  *
@@ -5375,13 +8222,17 @@ fast_strtou32 (const char *str, char **endptr, int base)
  *
  * \param str String to convert from
  * \param endptr optional endptr
+ * \param base base of converting.
+ * \param status optional status
  * \returns converted string
  */
 
-uint64_t
-fast_strtou64 (const char *str, char **endptr, int base)
+static ALWAYS_INLINE uint64_t
+strtou64_impl (const char *str, char **endptr, int base,
+	       enum fast_convert_status *status)
 {
   uint64_t n;
+  int overflow = 0;
   unsigned char *cp = (unsigned char *) str;
 #define	M(x)	(UINT64_C(18446744073709551615) / (x))
   static const uint64_t maxp[37] = {
@@ -5414,7 +8265,15 @@ fast_strtou64 (const char *str, char **endptr, int base)
       uint64_t max = maxp[base];
       uint64_t rem = remp[base];
 
-      if (base <= 10) {
+      if (base == 16) {
+	if (isxdigit (*cp)) {
+	  n = parse_hex (&cp, 16, &overflow);
+	}
+	else {
+	  cp = (unsigned char *) str;
+	}
+      }
+      else if (base <= 10) {
 	unsigned char u = *cp;
 	unsigned char end = '0' + base;
 
@@ -5423,6 +8282,8 @@ fast_strtou64 (const char *str, char **endptr, int base)
 	    uint32_t v = convert_num[u];
 
 	    if (UNLIKELY (n >= max) && (n > max || (n == max && v > rem))) {
+	      STAT_INC (int_overflow);
+	      overflow = 1;
 	      break;
 	    }
 	    n = n * base + v;
@@ -5442,6 +8303,8 @@ fast_strtou64 (const char *str, char **endptr, int base)
 	    uint32_t v = convert_num[u];
 
 	    if (UNLIKELY (n >= max) && (n > max || (n == max && v > rem))) {
+	      STAT_INC (int_overflow);
+	      overflow = 1;
 	      break;
 	    }
 	    n = n * base + v;
@@ -5460,19 +8323,8 @@ fast_strtou64 (const char *str, char **endptr, int base)
   else if (*cp == '0') {
     cp++;
     if ((*cp == 'x' || *cp == 'X') && isxdigit (cp[1])) {
-      uint64_t max = maxp[16];
-      uint64_t rem = remp[16];
-      unsigned char u = *++cp;
-
-      do {
-	uint32_t v = convert_num[u];
-
-	if (UNLIKELY (n >= max) && (n > max || (n == max && v > rem))) {
-	  break;
-	}
-	n = n * 16 + v;
-	u = *++cp;
-      } while (isxdigit (u));
+      cp++;
+      n = parse_hex (&cp, 16, &overflow);
     }
     else {
       uint64_t max = maxp[8];
@@ -5483,6 +8335,8 @@ fast_strtou64 (const char *str, char **endptr, int base)
 	uint32_t v = convert_num[u];
 
 	if (UNLIKELY (n >= max) && (n > max || (n == max && v > rem))) {
+	  STAT_INC (int_overflow);
+	  overflow = 1;
 	  break;
 	}
 	n = n * 8 + v;
@@ -5499,6 +8353,8 @@ fast_strtou64 (const char *str, char **endptr, int base)
       uint32_t v = convert_num[u];
 
       if (UNLIKELY (n >= max) && (n > max || (n == max && v > rem))) {
+	STAT_INC (int_overflow);
+	overflow = 1;
 	break;
       }
       n = n * 10 + v;
@@ -5508,364 +8364,832 @@ fast_strtou64 (const char *str, char **endptr, int base)
   else {
     cp = (unsigned char *) str;
   }
+  if (status) {
+    *status = overflow ? FAST_CONVERT_OVERFLOW :
+      cp == (unsigned char *) str ? FAST_CONVERT_NO_DIGITS :
+      *cp ? FAST_CONVERT_TRAILING : FAST_CONVERT_OK;
+  }
   if (endptr) {
     *endptr = (char *) cp;
   }
   return n;
 }
 
-/** \brief fast_ftoa
+/** \brief fast_strtou64
  * 
  * \b Description
  *
- * Convert float to ascii
+ * Convert string to unsigned long
  *
- * \param v float value
- * \param size precision
- * \param line pointer to result
- * \returns lenght string
+ * \param str String to convert from
+ * \param endptr optional endptr
+ * \param base base of converting.
+ * \returns converted string
  */
 
-unsigned int
-fast_ftoa (float v, int size, char *line)
+uint64_t
+fast_strtou64 (const char *str, char **endptr, int base)
 {
-  uint32_t q;
-  int exp;
-  int r;
-  unsigned int l;
-  char *s = line;
-  union
-  {
-    float f;
-    uint32_t u;
-  } f;
-  uint32_t lo;
-  uint64_t qq;
+  return strtou64_impl (str, endptr, base, NULL);
+}
 
-  if (UNLIKELY (size <= 0 || size > PREC_FLT_NR)) {
-    size = PREC_FLT_NR;
-  }
-  size--;
+/** \brief fast_strtou64_status
+ * 
+ * \b Description
+ *
+ * Convert string to unsigned long
+ * The status tells why parsing stopped. errno is never changed.
+ *
+ * \param str String to convert from
+ * \param endptr optional endptr
+ * \param base base of converting.
+ * \param status returns FAST_CONVERT_OK, OVERFLOW, NO_DIGITS or TRAILING
+ * \returns converted string
+ */
 
-  f.f = v;
-  if (f.u & 0x80000000) {
-    *s++ = '-';
+uint64_t
+fast_strtou64_status (const char *str, char **endptr, int base,
+		      enum fast_convert_status *status)
+{
+  return strtou64_impl (str, endptr, base, status);
+}
+
+#ifdef __SIZEOF_INT128__
+/** \brief strto128_impl
+ * 
+ * \b Description
+ *
+ * Convert string to 128 bit integer.
+ * Digits are collected in 64 bits as long as they fit and then
+ * in 128 bits with overflow check.
+ *
+ * \param str String to convert from
+ * \param endptr optional endptr
+ * \param base base of converting.
+ * \param is_signed allow sign and use signed limits
+ * \param status optional status
+ * \returns converted string (negated when sign found)
+ */
+
+static ALWAYS_INLINE unsigned __int128
+strto128_impl (const char *str, char **endptr, int base, int is_signed,
+	       enum fast_convert_status *status)
+{
+  unsigned __int128 n;
+  unsigned int sign = 0;
+  int overflow = 0;
+  unsigned char *cp = (unsigned char *) str;
+  unsigned char u;
+  unsigned char end;
+
+  while (isspace (*cp)) {
+    cp++;
   }
-  exp = (int) ((f.u >> 23) & 0xFF);
-  if (UNLIKELY (exp == 0xFF)) {
-    if ((f.u & 0x007FFFFF) == 0) {
-      strcpy (s, "inf");
+  if (is_signed) {
+    if (*cp == '+') {
+      cp++;
     }
-    else {
-      strcpy (s, "nan");
+    else if (*cp == '-') {
+      sign = 1;
+      cp++;
     }
-    return (s + 3) - line;
   }
-  else if (LIKELY (exp)) {
-    exp += 25;
+  if (base == 0) {
+    base = *cp != '0' ? 10 :
+      (cp[1] == 'x' || cp[1] == 'X') && isxdigit (cp[2]) ? 16 : 8;
   }
-  else {
-    if (UNLIKELY ((f.u & 0x007FFFFF) == 0)) {
-      strcpy (s, "0");
-      return (s + 1) - line;
-    }
-    f.f *= 33554432.0;		/* 2^25 */
-    exp = (int) ((f.u >> 23) & 0xFF);
+  if (base == 16 && *cp == '0' && (cp[1] == 'x' || cp[1] == 'X') &&
+      isxdigit (cp[2])) {
+    cp += 2;
   }
-  q = (f.u & 0x007FFFFF) + 0x00800000;
-  qq = mul_56 (q << 8, fpowers2[exp].mul, &lo);
-  exp = fpowers2[exp].exp;
-  if (size != PREC_FLT_NR - 1) {
-    int n = size - (qq >= ipowers64[PREC_FLT_NR])
-      - (qq >= ipowers64[PREC_FLT_NR + 1])
-      - (qq >= ipowers64[PREC_FLT_NR + 2]);
-    uint64_t d = qq / ipowers64[PREC_FLT_NR - 1 - n];
-    uint64_t m = qq - d * ipowers64[PREC_FLT_NR - 1 - n];
-    uint64_t h = ipowers64[PREC_FLT_NR - 2 - n] * 5;
+  n = 0;
+  end = base <= 10 ? '0' + base : 'A' + base - 10;
+  u = uppercase[*cp];
+  if (base >= 2 && base <= 36 && valid_num[u] && u < end) {
+    uint64_t max64 = (UINT64_C (18446744073709551615) - 35) / base;
+    uint64_t n64 = 0;
 
-    if (UNLIKELY (m == h)) {
-      q = d + (lo != 0 || (d & 1));
-    }
-    else {
-      q = d + (m > h);
-    }
-    exp += PREC_FLT_NR - n - 1;
-    if (UNLIKELY (q >= ipowers32[size + 1])) {
-      q = (q + 5) / 10;
-      exp++;
-    }
-  }
-  else if (qq >= ipowers64[PREC_FLT_NR + 2]) {
-#if __WORDSIZE == 64
-    uint64_t d = qq / 1000;
-#else
-    uint64_t d = div_1000 (qq);
-#endif
-    uint64_t m = qq - d * 1000;
+    do {
+      n64 = n64 * base + convert_num[u];
+      u = uppercase[*++cp];
+    } while (valid_num[u] && u < end && n64 <= max64);
+    n = n64;
+    if (valid_num[u] && u < end) {
+      unsigned __int128 limit = is_signed ?
+	((unsigned __int128) 1 << 127) - !sign : ~(unsigned __int128) 0;
+      unsigned __int128 max = limit / base;
+      uint32_t rem = (uint32_t) (limit % base);
 
-    if (UNLIKELY (m == 500)) {
-      q = d + (lo != 0 || (d & 1));
-    }
-    else {
-      q = d + (m > 500);
-    }
-    exp += 3;
-  }
-  else if (qq >= ipowers64[PREC_FLT_NR + 1]) {
-#if __WORDSIZE == 64
-    uint64_t d = qq / 100;
-#else
-    uint64_t d = div_100 (qq);
-#endif
-    uint64_t m = qq - d * 100;
+      do {
+	uint32_t v = convert_num[u];
 
-    if (UNLIKELY (m == 50)) {
-      q = d + (lo != 0 || (d & 1));
-    }
-    else {
-      q = d + (m > 50);
-    }
-    if (UNLIKELY (q >= ipowers32[PREC_FLT_NR])) {
-      /* fp = 423718298 (9.99999999e-24) */
-      q = (q + 5) / 10;
-      exp++;
+	if (UNLIKELY (n >= max) && (n > max || (n == max && v > rem))) {
+	  STAT_INC (int_overflow);
+	  overflow = 1;
+	  break;
+	}
+	n = n * base + v;
+	u = uppercase[*++cp];
+      } while (valid_num[u] && u < end);
     }
-    exp += 2;
   }
-  else if (qq >= ipowers64[PREC_FLT_NR]) {
-    /* Never reached */
+  else {
+    cp = (unsigned char *) str;
+  }
+  if (status) {
+    *status = overflow ? FAST_CONVERT_OVERFLOW :
+      cp == (unsigned char *) str ? FAST_CONVERT_NO_DIGITS :
+      *cp ? FAST_CONVERT_TRAILING : FAST_CONVERT_OK;
+  }
+  if (endptr) {
+    *endptr = (char *) cp;
+  }
+  return sign ? ~n + 1 : n;
+}
+
+/** \brief fast_strtos128
+ * 
+ * \b Description
+ *
+ * Convert string to signed 128 bit integer
+ *
+ * \param str String to convert from
+ * \param endptr optional endptr
+ * \param base base of converting.
+ * \returns converted string
+ */
+
+__int128
+fast_strtos128 (const char *str, char **endptr, int base)
+{
+  return (__int128) strto128_impl (str, endptr, base, 1, NULL);
+}
+
+/** \brief fast_strtos128_status
+ * 
+ * \b Description
+ *
+ * Convert string to signed 128 bit integer
+ * The status tells why parsing stopped. errno is never changed.
+ *
+ * \param str String to convert from
+ * \param endptr optional endptr
+ * \param base base of converting.
+ * \param status returns FAST_CONVERT_OK, OVERFLOW, NO_DIGITS or TRAILING
+ * \returns converted string
+ */
+
+__int128
+fast_strtos128_status (const char *str, char **endptr, int base,
+		       enum fast_convert_status *status)
+{
+  return (__int128) strto128_impl (str, endptr, base, 1, status);
+}
+
+/** \brief fast_strtou128
+ * 
+ * \b Description
+ *
+ * Convert string to unsigned 128 bit integer
+ *
+ * \param str String to convert from
+ * \param endptr optional endptr
+ * \param base base of converting.
+ * \returns converted string
+ */
+
+unsigned __int128
+fast_strtou128 (const char *str, char **endptr, int base)
+{
+  return strto128_impl (str, endptr, base, 0, NULL);
+}
+
+/** \brief fast_strtou128_status
+ * 
+ * \b Description
+ *
+ * Convert string to unsigned 128 bit integer
+ * The status tells why parsing stopped. errno is never changed.
+ *
+ * \param str String to convert from
+ * \param endptr optional endptr
+ * \param base base of converting.
+ * \param status returns FAST_CONVERT_OK, OVERFLOW, NO_DIGITS or TRAILING
+ * \returns converted string
+ */
+
+unsigned __int128
+fast_strtou128_status (const char *str, char **endptr, int base,
+		       enum fast_convert_status *status)
+{
+  return strto128_impl (str, endptr, base, 0, status);
+}
+#endif
+
+/* Exact conversion for precisions above PREC_DBL_NR. The value m * 2^e
+ * is scaled to an integer N * 10^x so all decimal digits can be
+ * generated and rounded like printf does. A double has at most
+ * 767 significant digits. */
+#define	EXACT_DBL_DIGITS	800
+#define	EXACT_DBL_LIMBS		((EXACT_DBL_DIGITS + 8) / 9)
+
+/** \brief exact_mul
+ * 
+ * \b Description
+ *
+ * Multiply base 10^9 bignum with small value and add value
+ *
+ * \param big bignum (least significant limb first)
+ * \param n number of limbs
+ * \param mul multiplier (<= 2^32)
+ * \param add value to add
+ * \returns new number of limbs
+ */
+
+static unsigned int
+exact_mul (uint32_t * big, unsigned int n, uint64_t mul, uint32_t add)
+{
+  uint64_t carry = add;
+  unsigned int i;
+
+  for (i = 0; i < n; i++) {
+    uint64_t t = big[i] * mul + carry;
+
 #if __WORDSIZE == 64
-    uint64_t d = qq / 10;
+    carry = t / 1000000000;
 #else
-    uint64_t d = div_10 (qq);
+    carry = div_1000000000 (t);
 #endif
-    uint64_t m = qq - d * 10;
+    big[i] = (uint32_t) (t - carry * 1000000000);
+  }
+  while (carry) {
+    big[n++] = (uint32_t) (carry % 1000000000);
+    carry /= 1000000000;
+  }
+  return n;
+}
 
-    if (UNLIKELY (m == 5)) {
-      q = d + (lo != 0 || (d & 1));
-    }
-    else {
-      q = d + (m > 5);
-    }
-    exp++;
+/** \brief exact_pad
+ * 
+ * \b Description
+ *
+ * Convert value to len digits with leading zero's
+ *
+ * \param v value
+ * \param p pointer to result
+ * \param len number of digits
+ */
+
+static void
+exact_pad (uint32_t v, char *p, unsigned int len)
+{
+  while (len >= 3) {
+    uint32_t d = v / 1000;
+
+    len -= 3;
+    memcpy (p + len, &NUM3[(v - d * 1000) * 3], 3);
+    v = d;
   }
-  else {
-    /* Never reached */
-    q = qq;
+  while (len) {
+    p[--len] = '0' + (v % 10);
+    v /= 10;
   }
+}
 
-  r = 0;
-  while ((q % 10) == 0) {
-    r++;
-    exp++;
-    q /= 10;
+/** \brief exact_format
+ * 
+ * \b Description
+ *
+ * Round digits to size and format them like printf %g
+ *
+ * \param d all digits of value
+ * \param n number of digits
+ * \param x decimal exponent of first digit
+ * \param size precision
+ * \param s pointer to result
+ * \returns lenght string
+ */
+
+static unsigned int
+exact_format (char *d, unsigned int n, int x, int size, char *s)
+{
+  char *start = s;
+  unsigned int i;
+
+  if (n > (unsigned int) size) {
+    int up = d[size] > '5';
+
+    if (d[size] == '5') {
+      STAT_INC (round_half);
+      up = d[size - 1] & 1;
+      for (i = size + 1; i < n; i++) {
+	if (d[i] != '0') {
+	  up = 1;
+	  break;
+	}
+      }
+    }
+    n = size;
+    if (up) {
+      i = n;
+      while (i > 0 && d[i - 1] == '9') {
+	d[--i] = '0';
+      }
+      if (i == 0) {
+	d[0] = '1';
+	x++;
+      }
+      else {
+	d[i - 1]++;
+      }
+    }
   }
-  if (exp >= 0 && exp <= r) {
-    q *= ipowers32[exp];
-    s += fast_uint32 (q, s);
+  while (n > 1 && d[n - 1] == '0') {
+    n--;
   }
-  else if (exp < 0 && exp > -(size - r + 5)) {
-    exp += size - r;
-    if (exp < 0) {
-      *s++ = '0';
-      *s++ = DECIMAL_POINT;
-      while (++exp < 0) {
+  if (x >= 0 && x < size) {
+    if (n <= (unsigned int) x + 1) {
+      memcpy (s, d, n);
+      s += n;
+      for (i = n; i <= (unsigned int) x; i++) {
 	*s++ = '0';
       }
-      s += fast_uint32 (q, s);
     }
     else {
-      l = fast_uint32 (q, s + 1);
-      while (l-- != 0) {
-	s[0] = s[1];
-	s++;
-	if (exp-- == 0) {
-	  *s++ = DECIMAL_POINT;
-	  s += l;
-	  break;
-	}
-      }
+      memcpy (s, d, x + 1);
+      s += x + 1;
+      *s++ = DECIMAL_POINT;
+      memcpy (s, d + x + 1, n - x - 1);
+      s += n - x - 1;
+    }
+  }
+  else if (x < 0 && x >= -4) {
+    *s++ = '0';
+    *s++ = DECIMAL_POINT;
+    while (++x < 0) {
+      *s++ = '0';
     }
+    memcpy (s, d, n);
+    s += n;
   }
   else {
-    l = fast_uint32 (q, s + 1);
-    s[0] = s[1];
-    s++;
-    if (l > 1) {
-      *s = DECIMAL_POINT;
-      s += l;
+    *s++ = d[0];
+    if (n > 1) {
+      *s++ = DECIMAL_POINT;
+      memcpy (s, d + 1, n - 1);
+      s += n - 1;
     }
-    exp += size - r;
-
-    if (exp) {
-      *s++ = 'e';
-      if (exp < 0) {
-	*s++ = '-';
-	exp = -exp;
-      }
-      else {
-	*s++ = '+';
-      }
-      *s++ = '0' + (exp / 10);
-      *s++ = '0' + (exp % 10);
+    *s++ = 'e';
+    if (x < 0) {
+      *s++ = '-';
+      x = -x;
+    }
+    else {
+      *s++ = '+';
     }
+    if (x < 10) {
+      *s++ = '0';
+    }
+    s += fast_uint32 (x, s);
   }
   *s = '\0';
-  return s - line;
+  return s - start;
 }
 
-/** \brief fast_dtoa
+/** \brief exact_digits
  * 
  * \b Description
  *
- * Convert double to ascii
+ * Calculate all decimal digits of (mh * 2^64 + ml) * 2^e
  *
- * \param v float value
- * \param size precision
- * \param line pointer to result
- * \returns lenght string
+ * \param mh 64 bit msb of mantissa
+ * \param ml 64 bit lsb of mantissa
+ * \param e binary exponent
+ * \param big bignum buffer large enough for all digits
+ * \param digits digit buffer large enough for all digits
+ * \param x returns decimal exponent of first digit
+ * \returns number of digits
  */
 
-unsigned int
-fast_dtoa (double v, int size, char *line)
+static unsigned int
+exact_digits (uint64_t mh, uint64_t ml, int e,
+	      uint32_t * big, char *digits, int *x)
 {
-  uint64_t q;
-  int exp;
-  int r;
-  unsigned int l;
-  char *s = line;
-  union
-  {
-    double d;
-    uint64_t u;
-  } d;
-  uint32_t lo;
-
-  if (UNLIKELY (size <= 0 || size > PREC_DBL_NR)) {
-    size = PREC_DBL_NR;
-  }
-  size--;
+  unsigned int i;
+  unsigned int n;
+  unsigned int len;
+  int k;
 
-  d.d = v;
-  if (d.u & UINT64_C (0x8000000000000000)) {
-    *s++ = '-';
-  }
-  exp = (int) ((d.u >> 52) & 0x7FF);
-  if (UNLIKELY (exp == 0x7FF)) {
-    if ((d.u & UINT64_C (0x000FFFFFFFFFFFFF)) == 0) {
-      strcpy (s, "inf");
-    }
-    else {
-      strcpy (s, "nan");
-    }
-    return (s + 3) - line;
-  }
-  else if (LIKELY (exp)) {
-    exp += 54;
-  }
-  else {
-    if (UNLIKELY ((d.u & UINT64_C (0x000FFFFFFFFFFFFF)) == 0)) {
-      strcpy (s, "0");
-      return (s + 1) - line;
-    }
-    d.d *= 18014398509481984.0;	/* 2^54 */
-    exp = (int) ((d.u >> 52) & 0x7FF);
+  while (e < 0 && (ml & 1) == 0 && (mh | ml) != 0) {
+    ml = (ml >> 1) | (mh << 63);
+    mh >>= 1;
+    e++;
   }
-  q = (d.u & UINT64_C (0x000FFFFFFFFFFFFF)) + UINT64_C (0x0010000000000000);
-  q = mul_96 (q << 11, dpowers2[exp].mul1, dpowers2[exp].mul2, &lo);
-  exp = dpowers2[exp].exp;
-  if (size != PREC_DBL_NR - 1) {
-    int n = size - (q >= ipowers64[PREC_DBL_NR])
-      - (q >= ipowers64[PREC_DBL_NR + 1])
-      - (q >= ipowers64[PREC_DBL_NR + 2]);
-    uint64_t d = q / ipowers64[PREC_DBL_NR - 1 - n];
-    uint64_t m = q - d * ipowers64[PREC_DBL_NR - 1 - n];
-    uint64_t h = ipowers64[PREC_DBL_NR - 2 - n] * 5;
+#ifdef __SIZEOF_INT128__
+  if (mh == 0 && (e < 0 ? e >= -19 : e <= __builtin_clzll (ml) + 64)) {
+    unsigned __int128 v;
 
-    if (UNLIKELY (m == h)) {
-      q = d + (lo != 0 || (d & 1));
+    /* Fast path: N = m * 5^-e or m * 2^e fits in 128 bits */
+    if (e < 0) {
+      v = (unsigned __int128) ml *(ipowers64[-e] >> -e);
     }
     else {
-      q = d + (m > h);
-    }
-    exp += PREC_DBL_NR - n - 1;
-    if (UNLIKELY (q >= ipowers64[size + 1])) {
-#if __WORDSIZE == 64
-      q = (q + 5) / 10;
-#else
-      q = div_10 (q + 5);
-#endif
-      exp++;
+      v = (unsigned __int128) ml << e;
     }
+    len = fast_uint128 (v, digits);
+    *x = (int) len - 1 + (e < 0 ? e : 0);
+    return len;
   }
-  else if (q >= ipowers64[PREC_DBL_NR + 2]) {
-#if __WORDSIZE == 64
-    uint64_t d = q / 1000;
-#else
-    uint64_t d = div_1000 (q);
 #endif
-    uint64_t m = q - d * 1000;
 
-    if (UNLIKELY (m == 500)) {
-      q = d + (lo != 0 || (d & 1));
+  n = exact_mul (big, 0, 0, (uint32_t) (mh >> 32));
+  n = exact_mul (big, n, UINT64_C (4294967296), (uint32_t) mh);
+  n = exact_mul (big, n, UINT64_C (4294967296), (uint32_t) (ml >> 32));
+  n = exact_mul (big, n, UINT64_C (4294967296), (uint32_t) ml);
+  if (e >= 0) {
+    for (k = e; k >= 32; k -= 32) {
+      n = exact_mul (big, n, UINT64_C (4294967296), 0);
     }
-    else {
-      q = d + (m > 500);
+    if (k) {
+      n = exact_mul (big, n, UINT64_C (1) << k, 0);
     }
-    exp += 3;
+    e = 0;
   }
-  else if (q >= ipowers64[PREC_DBL_NR + 1]) {
-#if __WORDSIZE == 64
-    uint64_t d = q / 100;
-#else
-    uint64_t d = div_100 (q);
-#endif
-    uint64_t m = q - d * 100;
-
-    if (UNLIKELY (m == 50)) {
-      q = d + (lo != 0 || (d & 1));
+  else {
+    for (k = -e; k >= 13; k -= 13) {
+      n = exact_mul (big, n, 1220703125, 0);	/* 5^13 */
     }
-    else {
-      q = d + (m > 50);
+    if (k) {
+      n = exact_mul (big, n, ipowers64[k] >> k, 0);
     }
-    exp += 2;
   }
-  else if (q >= ipowers64[PREC_DBL_NR]) {
+  len = fast_uint32 (big[n - 1], digits);
+  for (i = n - 1; i > 0; i--) {
+    exact_pad (big[i - 1], digits + len, 9);
+    len += 9;
+  }
+  *x = (int) len - 1 + e;
+  return len;
+}
+
+/** \brief exact_convert
+ * 
+ * \b Description
+ *
+ * Convert (mh * 2^64 + ml) * 2^e exactly to ascii
+ *
+ * \param mh 64 bit msb of mantissa
+ * \param ml 64 bit lsb of mantissa
+ * \param e binary exponent
+ * \param size precision
+ * \param big bignum buffer large enough for all digits
+ * \param digits digit buffer large enough for all digits
+ * \param s pointer to result
+ * \returns lenght string
+ */
+
+static unsigned int
+exact_convert (uint64_t mh, uint64_t ml, int e, int size,
+	       uint32_t * big, char *digits, char *s)
+{
+  int x;
+  unsigned int len = exact_digits (mh, ml, e, big, digits, &x);
+
+  return exact_format (digits, len, x, size, s);
+}
+
+/** \brief exact_dtoa
+ * 
+ * \b Description
+ *
+ * Convert non zero finite double bits exactly to ascii
+ *
+ * \param u double bits without sign
+ * \param size precision
+ * \param s pointer to result
+ * \returns lenght string
+ */
+
+static unsigned int
+exact_dtoa (uint64_t u, int size, char *s)
+{
+  uint32_t big[EXACT_DBL_LIMBS];
+  char digits[EXACT_DBL_DIGITS];
+  uint64_t m = u & UINT64_C (0x000FFFFFFFFFFFFF);
+  int e = (int) ((u >> 52) & 0x7FF);
+
+  if (e) {
+    m += UINT64_C (0x0010000000000000);
+    e -= 1075;
+  }
+  else {
+    e = -1074;
+  }
+  return exact_convert (0, m, e, size, big, digits, s);
+}
+
+/** \brief strip_step64
+ * 
+ * \b Description
+ *
+ * Divide q by 10^k when it is a multiple of 10^k, without a branch.
+ * q * 5^-k (mod 2^64) rotated right by k is q / 10^k for a multiple of
+ * 10^k and larger than UINT64_MAX / 10^k for all other values.
+ *
+ * \param q pointer to value
+ * \param k power of 10
+ * \param inv 5^-k mod 2^64
+ * \param max UINT64_MAX / 10^k
+ * \returns k when q was divided else 0
+ */
+
+static ALWAYS_INLINE unsigned int
+strip_step64 (uint64_t * q, unsigned int k, uint64_t inv, uint64_t max)
+{
+  uint64_t t = *q * inv;
+  unsigned int c;
+
+  t = (t >> k) | (t << (64 - k));
+  c = t <= max;
+  *q = c ? t : *q;
+  return c ? k : 0;
+}
+
+/** \brief strip_zeros64
+ * 
+ * \b Description
+ *
+ * Remove trailing decimal zeros from q (q != 0) in a fixed
+ * number of steps: 10^16, 10^8, 10^4, 10^2 and 10.
+ *
+ * \param q pointer to value
+ * \returns number of removed zeros
+ */
+
+static ALWAYS_INLINE unsigned int
+strip_zeros64 (uint64_t * q)
+{
+  unsigned int r;
+
+  r = strip_step64 (q, 16, UINT64_C (0xE4A4D1417CD9A041), UINT64_C (1844));
+  r += strip_step64 (q, 8, UINT64_C (0xC767074B22E90E21),
+		     UINT64_C (184467440737));
+  r += strip_step64 (q, 4, UINT64_C (0xD288CE703AFB7E91),
+		     UINT64_C (1844674407370955));
+  r += strip_step64 (q, 2, UINT64_C (0x8F5C28F5C28F5C29),
+		     UINT64_C (184467440737095516));
+  r += strip_step64 (q, 1, UINT64_C (0xCCCCCCCCCCCCCCCD),
+		     UINT64_C (1844674407370955161));
+  return r;
+}
+
+/** \brief strip_step32
+ * 
+ * \b Description
+ *
+ * 32 bit version of strip_step64.
+ *
+ * \param q pointer to value
+ * \param k power of 10
+ * \param inv 5^-k mod 2^32
+ * \param max UINT32_MAX / 10^k
+ * \returns k when q was divided else 0
+ */
+
+static ALWAYS_INLINE unsigned int
+strip_step32 (uint32_t * q, unsigned int k, uint32_t inv, uint32_t max)
+{
+  uint32_t t = *q * inv;
+  unsigned int c;
+
+  t = (t >> k) | (t << (32 - k));
+  c = t <= max;
+  *q = c ? t : *q;
+  return c ? k : 0;
+}
+
+/** \brief strip_zeros32
+ * 
+ * \b Description
+ *
+ * Remove trailing decimal zeros from q (q != 0) in a fixed
+ * number of steps: 10^8, 10^4, 10^2 and 10.
+ *
+ * \param q pointer to value
+ * \returns number of removed zeros
+ */
+
+static ALWAYS_INLINE unsigned int
+strip_zeros32 (uint32_t * q)
+{
+  unsigned int r;
+
+  r = strip_step32 (q, 8, 0x22E90E21u, 42u);
+  r += strip_step32 (q, 4, 0x3AFB7E91u, 429496u);
+  r += strip_step32 (q, 2, 0xC28F5C29u, 42949672u);
+  r += strip_step32 (q, 1, 0xCCCCCCCDu, 429496729u);
+  return r;
+}
+
+/** \brief round_pow10
+ * 
+ * \b Description
+ *
+ * Divide q by 10^p and round half even. Ties are only broken up when
+ * lo (the bits below q) is zero. With a constant p the compiler uses a
+ * multiply instead of a division.
+ *
+ * \param q value to round
+ * \param lo bits below q
+ * \param p power of 10 (1 <= p <= 19)
+ * \returns rounded q / 10^p
+ */
+
+static ALWAYS_INLINE uint64_t
+round_pow10 (uint64_t q, uint32_t lo, int p)
+{
+  uint64_t d = q / ipowers64[p];
+  uint64_t m = q - d * ipowers64[p];
+  uint64_t h = ipowers64[p - 1] * 5;
+
+  if (UNLIKELY (m == h)) {
+    STAT_INC (round_half);
+    return d + (lo != 0 || (d & 1));
+  }
+  return d + (m > h);
+}
+
+/** \brief ftoa_impl
+ * 
+ * \b Description
+ *
+ * Convert float to ascii. When fixed is set size is a compile time
+ * constant and every division gets a constant divisor.
+ *
+ * \param v float value
+ * \param size precision
+ * \param line pointer to result
+ * \param fixed size is constant
+ * \returns lenght string
+ */
+
+static ALWAYS_INLINE unsigned int
+ftoa_impl (float v, int size, char *line, int fixed)
+{
+  uint32_t q;
+  int exp;
+  int r;
+  unsigned int l;
+  char *s = line;
+  union
+  {
+    float f;
+    uint32_t u;
+  } f;
+  uint32_t lo;
+  uint64_t qq;
+  struct fpower fp;
+
+  if (UNLIKELY (size <= 0 || size > PREC_FLT_NR)) {
+    if (size > PREC_FLT_NR) {
+      return fast_dtoa (v, size, line);
+    }
+    size = PREC_FLT_NR;
+  }
+  size--;
+
+  f.f = v;
+  if (f.u & 0x80000000) {
+    *s++ = '-';
+  }
+  exp = (int) ((f.u >> 23) & 0xFF);
+  if (UNLIKELY (exp == 0xFF)) {
+    STAT_INC (inf_nan);
+    if ((f.u & 0x007FFFFF) == 0) {
+      strcpy (s, "inf");
+    }
+    else {
+      strcpy (s, "nan");
+    }
+    return (s + 3) - line;
+  }
+  else if (LIKELY (exp)) {
+    exp += 25;
+  }
+  else {
+    if (UNLIKELY ((f.u & 0x007FFFFF) == 0)) {
+      strcpy (s, "0");
+      return (s + 1) - line;
+    }
+    STAT_INC (subnormal);
+    f.f *= 33554432.0;		/* 2^25 */
+    exp = (int) ((f.u >> 23) & 0xFF);
+  }
+  q = (f.u & 0x007FFFFF) + 0x00800000;
+  fp = FPOWERS2 (exp);
+  qq = mul_56 (q << 8, fp.mul, &lo);
+  exp = fp.exp;
+  if (fixed && size < PREC_FLT_NR - 1) {
+    /* qq has PREC_FLT_NR + 1 (never reached) upto PREC_FLT_NR + 3
+       digits */
+    if (qq >= ipowers64[PREC_FLT_NR + 2]) {
+      q = round_pow10 (qq, lo, PREC_FLT_NR + 2 - size);
+      exp += PREC_FLT_NR + 2 - size;
+    }
+    else if (qq >= ipowers64[PREC_FLT_NR + 1]) {
+      q = round_pow10 (qq, lo, PREC_FLT_NR + 1 - size);
+      exp += PREC_FLT_NR + 1 - size;
+    }
+    else {
+      q = round_pow10 (qq, lo, PREC_FLT_NR - size);
+      exp += PREC_FLT_NR - size;
+    }
+    if (UNLIKELY (q >= ipowers32[size + 1])) {
+      q = (q + 5) / 10;
+      exp++;
+    }
+  }
+  else if (size != PREC_FLT_NR - 1) {
+    int n = size - (qq >= ipowers64[PREC_FLT_NR])
+      - (qq >= ipowers64[PREC_FLT_NR + 1])
+      - (qq >= ipowers64[PREC_FLT_NR + 2]);
+
+    q = round_pow10 (qq, lo, PREC_FLT_NR - 1 - n);
+    exp += PREC_FLT_NR - n - 1;
+    if (UNLIKELY (q >= ipowers32[size + 1])) {
+      q = (q + 5) / 10;
+      exp++;
+    }
+  }
+  else if (qq >= ipowers64[PREC_FLT_NR + 2]) {
 #if __WORDSIZE == 64
-    uint64_t d = q / 10;
+    uint64_t d = qq / 1000;
 #else
-    uint64_t d = div_10 (q);
+    uint64_t d = div_1000 (qq);
 #endif
-    uint64_t m = q - d * 10;
+    uint64_t m = qq - d * 1000;
 
-    if (UNLIKELY (m == 5)) {
+    if (UNLIKELY (m == 500)) {
+      STAT_INC (round_half);
       q = d + (lo != 0 || (d & 1));
     }
     else {
-      q = d + (m > 5);
+      q = d + (m > 500);
     }
-    exp++;
+    exp += 3;
   }
-
-  r = 0;
+  else if (qq >= ipowers64[PREC_FLT_NR + 1]) {
 #if __WORDSIZE == 64
-  while ((q % 10) == 0) {
-    r++;
-    exp++;
-    q /= 10;
+    uint64_t d = qq / 100;
+#else
+    uint64_t d = div_100 (qq);
+#endif
+    uint64_t m = qq - d * 100;
+
+    if (UNLIKELY (m == 50)) {
+      STAT_INC (round_half);
+      q = d + (lo != 0 || (d & 1));
+    }
+    else {
+      q = d + (m > 50);
+    }
+    if (UNLIKELY (q >= ipowers32[PREC_FLT_NR])) {
+      /* fp = 423718298 (9.99999999e-24) */
+      q = (q + 5) / 10;
+      exp++;
+    }
+    exp += 2;
   }
+  else if (qq >= ipowers64[PREC_FLT_NR]) {
+    /* Never reached */
+#if __WORDSIZE == 64
+    uint64_t d = qq / 10;
 #else
-  while ((q - div_10 (q) * 10) == 0) {
-    r++;
+    uint64_t d = div_10 (qq);
+#endif
+    uint64_t m = qq - d * 10;
+
+    if (UNLIKELY (m == 5)) {
+      STAT_INC (round_half);
+      q = d + (lo != 0 || (d & 1));
+    }
+    else {
+      q = d + (m > 5);
+    }
     exp++;
-    q = div_10 (q);
   }
-#endif
+  else {
+    /* Never reached */
+    q = qq;
+  }
+
+  r = strip_zeros32 (&q);
+  exp += r;
   if (exp >= 0 && exp <= r) {
-    q *= ipowers64[exp];
-    s += fast_uint64 (q, s);
+    q *= ipowers32[exp];
+    s += fast_uint32 (q, s);
   }
-  else if (exp < 0 && exp > -(size - r + 5 + (exp >= 100))) {
+  else if (exp < 0 && exp > -(size - r + 5)) {
     exp += size - r;
     if (exp < 0) {
       *s++ = '0';
@@ -5873,10 +9197,10 @@ fast_dtoa (double v, int size, char *line)
       while (++exp < 0) {
 	*s++ = '0';
       }
-      s += fast_uint64 (q, s);
+      s += fast_uint32 (q, s);
     }
     else {
-      l = fast_uint64 (q, s + 1);
+      l = fast_uint32 (q, s + 1);
       while (l-- != 0) {
 	s[0] = s[1];
 	s++;
@@ -5889,7 +9213,7 @@ fast_dtoa (double v, int size, char *line)
     }
   }
   else {
-    l = fast_uint64 (q, s + 1);
+    l = fast_uint32 (q, s + 1);
     s[0] = s[1];
     s++;
     if (l > 1) {
@@ -5907,10 +9231,6 @@ fast_dtoa (double v, int size, char *line)
       else {
 	*s++ = '+';
       }
-      if (exp >= 100) {
-	*s++ = '0' + (exp / 100);
-	exp %= 100;
-      }
       *s++ = '0' + (exp / 10);
       *s++ = '0' + (exp % 10);
     }
@@ -5919,19 +9239,2692 @@ fast_dtoa (double v, int size, char *line)
   return s - line;
 }
 
-/** \brief fast_strtof
+/** \brief fast_ftoa
+ * 
+ * \b Description
+ *
+ * Convert float to ascii
+ *
+ * \param v float value
+ * \param size precision
+ * \param line pointer to result
+ * \returns lenght string
+ */
+
+unsigned int
+fast_ftoa (float v, int size, char *line)
+{
+  return ftoa_impl (v, size, line, 0);
+}
+
+/** \brief fast_ftoa_p6
+ * 
+ * \b Description
+ *
+ * Convert float to ascii with precision 6
+ *
+ * \param v float value
+ * \param line pointer to result
+ * \returns lenght string
+ */
+
+unsigned int
+fast_ftoa_p6 (float v, char *line)
+{
+  return ftoa_impl (v, 6, line, 1);
+}
+
+/** \brief dtoa_impl
+ * 
+ * \b Description
+ *
+ * Convert double to ascii. When fixed is set size is a compile time
+ * constant and every division gets a constant divisor.
+ *
+ * \param v float value
+ * \param size precision
+ * \param line pointer to result
+ * \param fixed size is constant
+ * \returns lenght string
+ */
+
+static ALWAYS_INLINE unsigned int
+dtoa_impl (double v, int size, char *line, int fixed)
+{
+  uint64_t q;
+  int exp;
+  int r;
+  unsigned int l;
+  char *s = line;
+  union
+  {
+    double d;
+    uint64_t u;
+  } d;
+  uint32_t lo;
+  struct dpower dp;
+
+  if (UNLIKELY (size <= 0)) {
+    size = PREC_DBL_NR;
+  }
+  size--;
+
+  d.d = v;
+  if (d.u & UINT64_C (0x8000000000000000)) {
+    *s++ = '-';
+  }
+  exp = (int) ((d.u >> 52) & 0x7FF);
+  if (UNLIKELY (exp == 0x7FF)) {
+    STAT_INC (inf_nan);
+    if ((d.u & UINT64_C (0x000FFFFFFFFFFFFF)) == 0) {
+      strcpy (s, "inf");
+    }
+    else {
+      strcpy (s, "nan");
+    }
+    return (s + 3) - line;
+  }
+  if ((unsigned int) (exp - 1023) < 53) {
+    /* integer below 2^53 with at most size + 1 digits is printed by %g
+       without rounding, exponent or decimal point */
+    unsigned int sh = 1075 - exp;
+
+    q = (d.u & UINT64_C (0x000FFFFFFFFFFFFF)) + UINT64_C (0x0010000000000000);
+    if ((q & ((UINT64_C (1) << sh) - 1)) == 0) {
+      q >>= sh;
+      if (size >= PREC_DBL_NR - 1 || q < ipowers64[size + 1]) {
+	STAT_INC (integer);
+	s += fast_uint64 (q, s);
+	return s - line;
+      }
+    }
+  }
+  if (UNLIKELY (size >= PREC_DBL_NR)
+      && (d.u & UINT64_C (0x7FFFFFFFFFFFFFFF)) != 0) {
+    s += exact_dtoa (d.u, size + 1, s);
+    return s - line;
+  }
+  else if (LIKELY (exp)) {
+    exp += 54;
+  }
+  else {
+    if (UNLIKELY ((d.u & UINT64_C (0x000FFFFFFFFFFFFF)) == 0)) {
+      strcpy (s, "0");
+      return (s + 1) - line;
+    }
+    STAT_INC (subnormal);
+    d.d *= 18014398509481984.0;	/* 2^54 */
+    exp = (int) ((d.u >> 52) & 0x7FF);
+  }
+  q = (d.u & UINT64_C (0x000FFFFFFFFFFFFF)) + UINT64_C (0x0010000000000000);
+  dp = DPOWERS2 (exp);
+  q = mul_96 (q << 11, dp.mul1, dp.mul2, &lo);
+  exp = dp.exp;
+  if (fixed && size < PREC_DBL_NR - 1) {
+    /* q has PREC_DBL_NR upto PREC_DBL_NR + 3 digits */
+    if (q >= ipowers64[PREC_DBL_NR + 1]) {
+      if (q >= ipowers64[PREC_DBL_NR + 2]) {
+	q = round_pow10 (q, lo, PREC_DBL_NR + 2 - size);
+	exp += PREC_DBL_NR + 2 - size;
+      }
+      else {
+	q = round_pow10 (q, lo, PREC_DBL_NR + 1 - size);
+	exp += PREC_DBL_NR + 1 - size;
+      }
+    }
+    else if (q >= ipowers64[PREC_DBL_NR]) {
+      q = round_pow10 (q, lo, PREC_DBL_NR - size);
+      exp += PREC_DBL_NR - size;
+    }
+    else {
+      q = round_pow10 (q, lo, PREC_DBL_NR - 1 - size);
+      exp += PREC_DBL_NR - 1 - size;
+    }
+    if (UNLIKELY (q >= ipowers64[size + 1])) {
+#if __WORDSIZE == 64
+      q = (q + 5) / 10;
+#else
+      q = div_10 (q + 5);
+#endif
+      exp++;
+    }
+  }
+  else if (size != PREC_DBL_NR - 1) {
+    int n = size - (q >= ipowers64[PREC_DBL_NR])
+      - (q >= ipowers64[PREC_DBL_NR + 1])
+      - (q >= ipowers64[PREC_DBL_NR + 2]);
+
+    q = round_pow10 (q, lo, PREC_DBL_NR - 1 - n);
+    exp += PREC_DBL_NR - n - 1;
+    if (UNLIKELY (q >= ipowers64[size + 1])) {
+#if __WORDSIZE == 64
+      q = (q + 5) / 10;
+#else
+      q = div_10 (q + 5);
+#endif
+      exp++;
+    }
+  }
+  else if (q >= ipowers64[PREC_DBL_NR + 2]) {
+#if __WORDSIZE == 64
+    uint64_t d = q / 1000;
+#else
+    uint64_t d = div_1000 (q);
+#endif
+    uint64_t m = q - d * 1000;
+
+    if (UNLIKELY (m == 500)) {
+      STAT_INC (round_half);
+      q = d + (lo != 0 || (d & 1));
+    }
+    else {
+      q = d + (m > 500);
+    }
+    exp += 3;
+  }
+  else if (q >= ipowers64[PREC_DBL_NR + 1]) {
+#if __WORDSIZE == 64
+    uint64_t d = q / 100;
+#else
+    uint64_t d = div_100 (q);
+#endif
+    uint64_t m = q - d * 100;
+
+    if (UNLIKELY (m == 50)) {
+      STAT_INC (round_half);
+      q = d + (lo != 0 || (d & 1));
+    }
+    else {
+      q = d + (m > 50);
+    }
+    exp += 2;
+  }
+  else if (q >= ipowers64[PREC_DBL_NR]) {
+#if __WORDSIZE == 64
+    uint64_t d = q / 10;
+#else
+    uint64_t d = div_10 (q);
+#endif
+    uint64_t m = q - d * 10;
+
+    if (UNLIKELY (m == 5)) {
+      STAT_INC (round_half);
+      q = d + (lo != 0 || (d & 1));
+    }
+    else {
+      q = d + (m > 5);
+    }
+    exp++;
+  }
+
+  r = strip_zeros64 (&q);
+  exp += r;
+  if (exp >= 0 && exp <= r) {
+    q *= ipowers64[exp];
+    s += fast_uint64 (q, s);
+  }
+  else if (exp < 0 && exp > -(size - r + 5 + (exp >= 100))) {
+    exp += size - r;
+    if (exp < 0) {
+      *s++ = '0';
+      *s++ = DECIMAL_POINT;
+      while (++exp < 0) {
+	*s++ = '0';
+      }
+      s += fast_uint64 (q, s);
+    }
+    else {
+      l = fast_uint64 (q, s + 1);
+      while (l-- != 0) {
+	s[0] = s[1];
+	s++;
+	if (exp-- == 0) {
+	  *s++ = DECIMAL_POINT;
+	  s += l;
+	  break;
+	}
+      }
+    }
+  }
+  else {
+    l = fast_uint64 (q, s + 1);
+    s[0] = s[1];
+    s++;
+    if (l > 1) {
+      *s = DECIMAL_POINT;
+      s += l;
+    }
+    exp += size - r;
+
+    if (exp) {
+      *s++ = 'e';
+      if (exp < 0) {
+	*s++ = '-';
+	exp = -exp;
+      }
+      else {
+	*s++ = '+';
+      }
+      if (exp >= 100) {
+	*s++ = '0' + (exp / 100);
+	exp %= 100;
+      }
+      *s++ = '0' + (exp / 10);
+      *s++ = '0' + (exp % 10);
+    }
+  }
+  *s = '\0';
+  return s - line;
+}
+
+/** \brief fast_dtoa
+ * 
+ * \b Description
+ *
+ * Convert double to ascii
+ *
+ * \param v float value
+ * \param size precision
+ * \param line pointer to result
+ * \returns lenght string
+ */
+
+unsigned int
+fast_dtoa (double v, int size, char *line)
+{
+  return dtoa_impl (v, size, line, 0);
+}
+
+/** \brief fast_dtoa_p6
+ * 
+ * \b Description
+ *
+ * Convert double to ascii with precision 6
+ *
+ * \param v double value
+ * \param line pointer to result
+ * \returns lenght string
+ */
+
+unsigned int
+fast_dtoa_p6 (double v, char *line)
+{
+  return dtoa_impl (v, 6, line, 1);
+}
+
+/** \brief fast_dtoa_p15
+ * 
+ * \b Description
+ *
+ * Convert double to ascii with precision 15
+ *
+ * \param v double value
+ * \param line pointer to result
+ * \returns lenght string
+ */
+
+unsigned int
+fast_dtoa_p15 (double v, char *line)
+{
+  return dtoa_impl (v, 15, line, 1);
+}
+
+/** \brief fast_strtof
+ * 
+ * \b Description
+ *
+ * Convert string to float
+ *
+ * \param str string to convert
+ * \param endptr optional endptr
+ * \returns converted float value
+ */
+
+float
+fast_strtof (const char *str, char **endptr)
+{
+  char *cp = (char *) str;
+  int sign = 0;
+  int esign = 0;
+  int exp;
+  int tmp;
+  int c;
+  uint64_t n;
+  union
+  {
+    uint32_t u;
+    float f;
+  } tf;
+
+  while (isspace (*cp)) {
+    cp++;
+  }
+  if (*cp == '+') {
+    cp++;
+  }
+  else if (*cp == '-') {
+    sign = 1;
+    cp++;
+  }
+  if (*cp == 'n' || *cp == 'N') {
+    if (strncasecmp (cp, "nan", 3) == 0) {
+      STAT_INC (inf_nan);
+      cp += strlen ("nan");
+      if (endptr) {
+	*endptr = cp;
+      }
+      if (*cp == '(') {
+	cp++;
+	while (isalpha (*cp) || isdigit (*cp) || *cp == '_') {
+	  cp++;
+	}
+	if (*cp == ')') {
+	  if (endptr) {
+	    *endptr = cp + 1;
+	  }
+	}
+      }
+      tf.u = sign ? 0xFFC00000 : 0x7FC00000;
+      return tf.f;
+    }
+    if (endptr) {
+      *endptr = (char *) str;
+    }
+    return 0.0;
+  }
+  if (*cp == 'i' || *cp == 'I') {
+    if (strncasecmp (cp, "inf", 3) == 0) {
+      STAT_INC (inf_nan);
+      cp += strlen ("inf");
+      if (strncasecmp (cp, "inity", strlen ("inity")) == 0) {
+	cp += strlen ("inity");
+      }
+      if (endptr) {
+	*endptr = cp;
+      }
+      tf.u = sign ? 0xFF800000 : 0x7F800000;
+      return tf.f;
+    }
+    if (endptr) {
+      *endptr = (char *) str;
+    }
+    return 0.0;
+  }
+  if (*cp == '0' && (cp[1] == 'x' || cp[1] == 'X')) {
+    if (!isxdigit (cp[2]) && (cp[2] != DECIMAL_POINT || !isxdigit (cp[3]))) {
+      if (endptr) {
+	*endptr = &cp[1];
+      }
+      return 0.0 * (sign ? -1.0 : 1.0);
+    }
+    STAT_INC (hex_float);
+    cp += 2;
+    n = 0;
+    exp = 0;
+    c = 0;
+    while (isxdigit (*cp)) {
+      if (c < 16) {
+	n = n * 16 + convert_num[*cp & 0xFFu];
+      }
+      else {
+	exp += 4;
+      }
+      cp++;
+      if (n) {
+	c++;
+      }
+    }
+    if (*cp == DECIMAL_POINT) {
+      cp++;
+      while (isxdigit (*cp)) {
+	if (c < 16) {
+	  n = n * 16 + convert_num[*cp & 0xFFu];
+	  exp -= 4;
+	}
+	cp++;
+	if (n) {
+	  c++;
+	}
+      }
+    }
+    if (*cp == 'p' || *cp == 'P') {
+      cp++;
+      if (*cp == '+') {
+	cp++;
+      }
+      else if (*cp == '-') {
+	esign = 1;
+	cp++;
+      }
+      tmp = 0;
+      c = 0;
+      while (isdigit (*cp)) {
+	if (c < 5) {
+	  tmp = tmp * 10 + (*cp - '0');
+	}
+	cp++;
+	if (tmp) {
+	  c++;
+	}
+      }
+      if (esign) {
+	exp -= tmp;
+      }
+      else {
+	exp += tmp;
+      }
+    }
+    if (endptr) {
+      *endptr = cp;
+    }
+    /* sets ERANGE and returns HUGE_VAL on error */
+    return ldexpf (n, exp) * (sign ? -1.0 : 1.0);
+  }
+  if (!isdigit (*cp) && (*cp != DECIMAL_POINT || !isdigit (cp[1]))) {
+    if (endptr) {
+      *endptr = (char *) str;
+    }
+    return 0.0;
+  }
+  n = 0;
+  exp = 0;
+  c = 0;
+  while (isdigit (*cp)) {
+    if (c < 19) {
+      n = n * 10 + (*cp - '0');
+    }
+    else {
+      exp++;
+    }
+    cp++;
+    if (n) {
+      c++;
+    }
+  }
+  if (*cp == DECIMAL_POINT) {
+    cp++;
+    while (isdigit (*cp)) {
+      if (c < 19) {
+	n = n * 10 + (*cp - '0');
+	exp--;
+      }
+      cp++;
+      if (n) {
+	c++;
+      }
+    }
+  }
+  if (UNLIKELY (c > 19)) {
+    STAT_INC (truncated);
+  }
+  if (*cp == 'e' || *cp == 'E') {
+    cp++;
+    if (*cp == '+') {
+      cp++;
+    }
+    else if (*cp == '-') {
+      esign = 1;
+      cp++;
+    }
+    tmp = 0;
+    c = 0;
+    while (isdigit (*cp)) {
+      if (c < 5) {
+	tmp = tmp * 10 + (*cp - '0');
+      }
+      cp++;
+      if (tmp) {
+	c++;
+      }
+    }
+    if (esign) {
+      exp -= tmp;
+    }
+    else {
+      exp += tmp;
+    }
+  }
+  if (endptr) {
+    *endptr = cp;
+  }
+  if (n && (exp >= -64 && exp <= 39)) {
+#ifdef WIN
+    unsigned int s = __builtin_clzll (n);
+#else
+#ifdef __GNUC__
+#if __WORDSIZE == 64
+    unsigned int s = __builtin_clzl (n);
+#else
+    unsigned int s = __builtin_clzll (n);
+#endif
+#else
+    unsigned int s = calc_clz64 (n);
+#endif
+#endif
+    struct fpower fp = FPOWERS10 (exp + 64);
+
+    /* sets ERANGE and returns HUGE_VAL on error */
+    return ldexpf (mul_64 (n << s, fp.mul) + 5,
+		   fp.exp + 32 - s) * (sign ? -1.0 : 1.0);
+  }
+  return 0.0 * (sign ? -1.0 : 1.0);
+}
+
+/** \brief strtod_value
+ * 
+ * \b Description
+ *
+ * Convert parsed decimal digits to double
+ *
+ * \param n1 64 bit msb of digits
+ * \param n2 64 bit lsb of digits
+ * \param exp decimal exponent
+ * \param sign 1 if negative
+ * \returns converted double value
+ */
+
+static ALWAYS_INLINE double
+strtod_value (uint64_t n1, uint64_t n2, int exp, int sign)
+{
+  int c;
+
+  c = 64;
+  if (n1 == 0) {
+    n1 = n2;
+    n2 = 0;
+    c = 0;
+  }
+  if (n1 && (exp >= -362 && exp <= 309)) {
+#ifdef WIN
+    unsigned int s = __builtin_clzll (n1);
+#else
+#ifdef __GNUC__
+#if __WORDSIZE == 64
+    unsigned int s = __builtin_clzl (n1);
+#else
+    unsigned int s = __builtin_clzll (n1);
+#endif
+#else
+    unsigned int s = calc_clz64 (n1);
+#endif
+#endif
+
+    n1 = (n1 << s) | (n2 >> (64 - s));
+    n2 <<= s;
+
+    uint32_t lo;
+    struct dpower dp = DPOWERS10 (exp + 362);
+    uint64_t r = mul_96 (n1, dp.mul1, dp.mul2 + 1, &lo);
+
+    if (n2) {
+      uint32_t lo2;
+      uint64_t l = mul_96 (n2, dp.mul1, dp.mul2 + 1, &lo2) >> 32;
+      lo += l;
+      if (lo < l) {
+	r++;
+	if (r == 0) {
+	  r--;
+	}
+      }
+    }
+
+    return ldexp (r, dp.exp + 64 - s + c) *
+      (sign ? -1.0 : 1.0);
+  }
+  return 0.0 * (sign ? -1.0 : 1.0);
+}
+
+/** \brief fast_strtod
+ * 
+ * \b Description
+ *
+ * Convert string to double
+ *
+ * \param str string to convert
+ * \param endptr optional endptr
+ * \returns converted double value
+ */
+
+double
+fast_strtod (const char *str, char **endptr)
+{
+  char *cp = (char *) str;
+  int sign = 0;
+  int esign = 0;
+  int exp;
+  int tmp;
+  int c;
+  uint64_t n1;
+  uint64_t n2;
+  union
+  {
+    uint64_t u;
+    double d;
+  } td;
+
+  while (isspace (*cp)) {
+    cp++;
+  }
+  if (*cp == '+') {
+    cp++;
+  }
+  else if (*cp == '-') {
+    sign = 1;
+    cp++;
+  }
+  if (*cp == 'n' || *cp == 'N') {
+    if (strncasecmp (cp, "nan", 3) == 0) {
+      STAT_INC (inf_nan);
+      cp += strlen ("nan");
+      if (endptr) {
+	*endptr = cp;
+      }
+      if (*cp == '(') {
+	cp++;
+	while (isalpha (*cp) || isdigit (*cp) || *cp == '_') {
+	  cp++;
+	}
+	if (*cp == ')') {
+	  if (endptr) {
+	    *endptr = cp + 1;
+	  }
+	}
+      }
+      td.u =
+	sign ? UINT64_C (0xFFF8000000000000) : UINT64_C (0x7FF8000000000000);
+      return td.d;
+    }
+    if (endptr) {
+      *endptr = (char *) str;
+    }
+    return 0.0;
+  }
+  if (*cp == 'i' || *cp == 'I') {
+    if (strncasecmp (cp, "inf", 3) == 0) {
+      STAT_INC (inf_nan);
+      cp += strlen ("inf");
+      if (strncasecmp (cp, "inity", strlen ("inity")) == 0) {
+	cp += strlen ("inity");
+      }
+      if (endptr) {
+	*endptr = cp;
+      }
+      td.u =
+	sign ? UINT64_C (0xFFF0000000000000) : UINT64_C (0x7FF0000000000000);
+      return td.d;
+    }
+    if (endptr) {
+      *endptr = (char *) str;
+    }
+    return 0.0;
+  }
+  if (*cp == '0' && (cp[1] == 'x' || cp[1] == 'X')) {
+    if (!isxdigit (cp[2]) && (cp[2] != DECIMAL_POINT || !isxdigit (cp[3]))) {
+      if (endptr) {
+	*endptr = &cp[1];
+      }
+      return 0.0 * (sign ? -1.0 : 1.0);
+    }
+    STAT_INC (hex_float);
+    cp += 2;
+    n1 = 0;
+    exp = 0;
+    c = 0;
+    while (isxdigit (*cp)) {
+      if (c < 16) {
+	n1 = n1 * 16 + convert_num[*cp & 0xFFu];
+      }
+      else {
+	exp += 4;
+      }
+      cp++;
+      if (n1) {
+	c++;
+      }
+    }
+    if (*cp == DECIMAL_POINT) {
+      cp++;
+      while (isxdigit (*cp)) {
+	if (c < 16) {
+	  n1 = n1 * 16 + convert_num[*cp & 0xFFu];
+	  exp -= 4;
+	}
+	cp++;
+	if (n1) {
+	  c++;
+	}
+      }
+    }
+    if (*cp == 'p' || *cp == 'P') {
+      cp++;
+      if (*cp == '+') {
+	cp++;
+      }
+      else if (*cp == '-') {
+	esign = 1;
+	cp++;
+      }
+      tmp = 0;
+      c = 0;
+      while (isdigit (*cp)) {
+	if (c < 5) {
+	  tmp = tmp * 10 + (*cp - '0');
+	}
+	cp++;
+	if (tmp) {
+	  c++;
+	}
+      }
+      if (esign) {
+	exp -= tmp;
+      }
+      else {
+	exp += tmp;
+      }
+    }
+    if (endptr) {
+      *endptr = cp;
+    }
+    /* sets ERANGE and returns HUGE_VAL on error */
+    return ldexp (n1, exp) * (sign ? -1.0 : 1.0);
+  }
+  if (!isdigit (*cp) && (*cp != DECIMAL_POINT || !isdigit (cp[1]))) {
+    if (endptr) {
+      *endptr = (char *) str;
+    }
+    return 0.0;
+  }
+  n1 = 0;
+  n2 = 0;
+  exp = 0;
+  c = 0;
+  while (c < 19 && isdigit (*cp)) {
+    n2 = n2 * 10 + (*cp - '0');
+    cp++;
+    if (n2) {
+      c++;
+    }
+  }
+  while (isdigit (*cp)) {
+    if (c < 38) {
+      mul_10_add (&n1, &n2, *cp - '0');
+    }
+    else {
+      exp++;
+    }
+    cp++;
+    if (n1 || n2) {
+      c++;
+    }
+  }
+  if (*cp == DECIMAL_POINT) {
+    cp++;
+    while (c < 19 && isdigit (*cp)) {
+      n2 = n2 * 10 + (*cp - '0');
+      exp--;
+      cp++;
+      if (n2) {
+	c++;
+      }
+    }
+    while (isdigit (*cp)) {
+      if (c < 38) {
+	mul_10_add (&n1, &n2, *cp - '0');
+	exp--;
+      }
+      cp++;
+      if (n1 || n2) {
+	c++;
+      }
+    }
+  }
+  if (UNLIKELY (c > 38)) {
+    STAT_INC (truncated);
+  }
+  if (*cp == 'e' || *cp == 'E') {
+    cp++;
+    if (*cp == '+') {
+      cp++;
+    }
+    else if (*cp == '-') {
+      esign = 1;
+      cp++;
+    }
+    tmp = 0;
+    c = 0;
+    while (isdigit (*cp)) {
+      if (c < 5) {
+	tmp = tmp * 10 + (*cp - '0');
+      }
+      cp++;
+      if (tmp) {
+	c++;
+      }
+    }
+    if (esign) {
+      exp -= tmp;
+    }
+    else {
+      exp += tmp;
+    }
+  }
+  if (endptr) {
+    *endptr = cp;
+  }
+  return strtod_value (n1, n2, exp, sign);
+}
+
+#define	NP_START	0
+#define	NP_SIGN		1
+#define	NP_DOT		2
+#define	NP_INT		3
+#define	NP_FRAC		4
+#define	NP_EXP		5
+#define	NP_EXP_SIGN	6
+#define	NP_EXP_DIGITS	7
+#define	NP_INF		8
+#define	NP_NAN		9
+#define	NP_PAYLOAD	10
+
+#define	NP_DIGIT(c)	((unsigned int) ((c) - '0') < 10)
+
+/** \brief num_parser_digit
+ * 
+ * \b Description
+ *
+ * Add digit to parsed number the same way as fast_strtod
+ *
+ * \param p parser state
+ * \param d digit value
+ * \param frac 1 if digit is after decimal point
+ */
+
+static ALWAYS_INLINE void
+num_parser_digit (struct fast_num_parser *p, uint32_t d, int frac)
+{
+  if (p->digits < 19) {
+    p->n2 = p->n2 * 10 + d;
+    p->exp -= frac;
+  }
+  else if (p->digits < 38) {
+    mul_10_add (&p->n1, &p->n2, d);
+    p->exp -= frac;
+  }
+  else {
+    p->exp += !frac;
+  }
+  if (p->n1 || p->n2) {
+    p->digits++;
+  }
+}
+
+/** \brief num_parser_digits
+ * 
+ * \b Description
+ *
+ * Add first 19 digits of a digit run with the state in registers
+ *
+ * \param p parser state
+ * \param cpp pointer to input pointer, updated
+ * \param end end of input
+ * \param frac 1 if digits are after decimal point
+ * \returns next character
+ */
+
+static ALWAYS_INLINE int
+num_parser_digits (struct fast_num_parser *p, const char **cpp,
+		   const char *end, int frac)
+{
+  const char *cp = *cpp;
+  uint64_t n2 = p->n2;
+  int digits = p->digits;
+  int exp = p->exp;
+  int c = 0;
+
+  while (digits < 19 && cp < end && NP_DIGIT (c = *cp & 0xFF)) {
+    n2 = n2 * 10 + (c - '0');
+    exp -= frac;
+    digits += n2 != 0;
+    cp++;
+  }
+  p->n2 = n2;
+  p->digits = digits;
+  p->exp = exp;
+  *cpp = cp;
+  return cp < end ? *cp & 0xFF : 0;
+}
+
+/** \brief num_parser_emit
+ * 
+ * \b Description
+ *
+ * Convert parsed number, pass it to emit and reset parser
+ *
+ * \param p parser state
+ */
+
+static void
+num_parser_emit (struct fast_num_parser *p)
+{
+  union
+  {
+    uint64_t u;
+    double d;
+  } td;
+
+  if (p->state >= NP_INF) {
+    STAT_INC (inf_nan);
+    td.u = p->state == NP_INF ? UINT64_C (0x7FF0000000000000) :
+      UINT64_C (0x7FF8000000000000);
+    td.u |= (uint64_t) p->sign << 63;
+  }
+  else {
+    if (UNLIKELY (p->digits > 38)) {
+      STAT_INC (truncated);
+    }
+    td.d = strtod_value (p->n1, p->n2,
+			 p->esign ? p->exp - p->eval : p->exp + p->eval,
+			 p->sign);
+  }
+  p->emit (p->arg, td.d);
+  p->n1 = 0;
+  p->n2 = 0;
+  p->exp = 0;
+  p->digits = 0;
+  p->eval = 0;
+  p->edigits = 0;
+  p->state = NP_START;
+  p->sign = 0;
+  p->esign = 0;
+}
+
+/** \brief num_parser_rescan
+ * 
+ * \b Description
+ *
+ * Reset parser and parse letters again that were matched as inf or nan
+ * payload but do not belong to it
+ *
+ * \param p parser state
+ * \param str letters
+ * \param len number of letters
+ * \returns number of emitted numbers
+ */
+
+static size_t
+num_parser_rescan (struct fast_num_parser *p, const char *str, size_t len)
+{
+  char buf[sizeof (p->payload)];
+
+  memcpy (buf, str, len);
+  p->eval = 0;
+  p->sign = 0;
+  p->state = NP_START;
+  return fast_num_parser_feed (p, buf, len);
+}
+
+/** \brief num_parser_unclosed
+ * 
+ * \b Description
+ *
+ * Emit nan for a payload without ')' and parse the payload again
+ *
+ * \param p parser state
+ * \returns number of emitted numbers
+ */
+
+static size_t
+num_parser_unclosed (struct fast_num_parser *p)
+{
+  size_t len = p->eval;
+
+  num_parser_emit (p);
+  return 1 + num_parser_rescan (p, p->payload, len);
+}
+
+/** \brief fast_num_parser_init
+ * 
+ * \b Description
+ *
+ * Init incremental number parser
+ *
+ * \param p parser state
+ * \param emit function called with each converted number
+ * \param arg first argument of emit
+ */
+
+void
+fast_num_parser_init (struct fast_num_parser *p,
+		      void (*emit) (void *arg, double v), void *arg)
+{
+  memset (p, 0, sizeof (*p));
+  p->state = NP_START;
+  p->emit = emit;
+  p->arg = arg;
+}
+
+/** \brief fast_num_parser_feed
+ * 
+ * \b Description
+ *
+ * Parse next part of input. The state of a number at the end of str
+ * is kept in p, so no input is copied or scanned twice.
+ *
+ * \param p parser state
+ * \param str input
+ * \param len length of input
+ * \returns number of emitted numbers
+ */
+
+size_t
+fast_num_parser_feed (struct fast_num_parser *p, const char *str, size_t len)
+{
+  const char *cp = str;
+  const char *end = str + len;
+  size_t n = 0;
+  int c;
+
+  while (cp < end) {
+    c = *cp & 0xFF;
+    switch (p->state) {
+    case NP_START:
+      if (c == '+' || c == '-') {
+	p->sign = c == '-';
+	p->state = NP_SIGN;
+	cp++;
+	break;
+      }
+      /* fall through */
+    case NP_SIGN:
+      if (NP_DIGIT (c)) {
+	num_parser_digit (p, c - '0', 0);
+	p->state = NP_INT;
+      }
+      else if (c == DECIMAL_POINT) {
+	p->state = NP_DOT;
+      }
+      else if (c == 'i' || c == 'I') {
+	p->eval = 1;
+	p->state = NP_INF;
+      }
+      else if (c == 'n' || c == 'N') {
+	p->eval = 1;
+	p->state = NP_NAN;
+      }
+      else if (p->state == NP_SIGN) {
+	/* sign without number, look at c again */
+	p->sign = 0;
+	p->state = NP_START;
+	break;
+      }
+      cp++;
+      break;
+    case NP_DOT:
+      if (NP_DIGIT (c)) {
+	num_parser_digit (p, c - '0', 1);
+	p->state = NP_FRAC;
+	cp++;
+      }
+      else {
+	p->sign = 0;
+	p->state = NP_START;
+      }
+      break;
+    case NP_INT:
+      c = num_parser_digits (p, &cp, end, 0);
+      if (cp == end) {
+	return n;
+      }
+      while (NP_DIGIT (c)) {
+	num_parser_digit (p, c - '0', 0);
+	if (++cp == end) {
+	  return n;
+	}
+	c = *cp & 0xFF;
+      }
+      if (c == DECIMAL_POINT) {
+	p->state = NP_FRAC;
+	cp++;
+      }
+      else if (c == 'e' || c == 'E') {
+	p->state = NP_EXP;
+	cp++;
+      }
+      else {
+	num_parser_emit (p);
+	n++;
+      }
+      break;
+    case NP_FRAC:
+      c = num_parser_digits (p, &cp, end, 1);
+      if (cp == end) {
+	return n;
+      }
+      while (NP_DIGIT (c)) {
+	num_parser_digit (p, c - '0', 1);
+	if (++cp == end) {
+	  return n;
+	}
+	c = *cp & 0xFF;
+      }
+      if (c == 'e' || c == 'E') {
+	p->state = NP_EXP;
+	cp++;
+      }
+      else {
+	num_parser_emit (p);
+	n++;
+      }
+      break;
+    case NP_EXP:
+      if (c == '+' || c == '-') {
+	p->esign = c == '-';
+	p->state = NP_EXP_SIGN;
+	cp++;
+	break;
+      }
+      /* fall through */
+    case NP_EXP_SIGN:
+    case NP_EXP_DIGITS:
+      while (NP_DIGIT (c)) {
+	if (p->edigits < 5) {
+	  p->eval = p->eval * 10 + (c - '0');
+	}
+	if (p->eval) {
+	  p->edigits++;
+	}
+	p->state = NP_EXP_DIGITS;
+	if (++cp == end) {
+	  return n;
+	}
+	c = *cp & 0xFF;
+      }
+      num_parser_emit (p);
+      n++;
+      break;
+    case NP_INF:
+      if ((c | 0x20) == "infinity"[p->eval]) {
+	cp++;
+	if (++p->eval == 8) {
+	  num_parser_emit (p);
+	  n++;
+	}
+      }
+      else {
+	/* letters after "inf" or the 'n' of "in" may start a number */
+	int skip = p->eval >= 3 ? 3 : 1;
+	int len = p->eval - skip;
+
+	if (p->eval >= 3) {
+	  num_parser_emit (p);
+	  n++;
+	}
+	n += num_parser_rescan (p, &"infinity"[skip], len);
+      }
+      break;
+    case NP_NAN:
+      if (p->eval < 3 && (c | 0x20) == "nan"[p->eval]) {
+	p->eval++;
+	cp++;
+      }
+      else if (p->eval == 3 && c == '(') {
+	p->eval = 0;
+	p->state = NP_PAYLOAD;
+	cp++;
+      }
+      else if (p->eval == 3) {
+	num_parser_emit (p);
+	n++;
+      }
+      else {
+	p->eval = 0;
+	p->sign = 0;
+	p->state = NP_START;
+      }
+      break;
+    case NP_PAYLOAD:
+      if ((isalpha (c) || isdigit (c) || c == '_') &&
+	  p->eval < (int) sizeof (p->payload)) {
+	p->payload[p->eval++] = c;
+	cp++;
+      }
+      else if (c == ')') {
+	cp++;
+	num_parser_emit (p);
+	n++;
+      }
+      else {
+	/* like fast_strtod the number ends before '(', look at c again */
+	n += num_parser_unclosed (p);
+      }
+      break;
+    }
+  }
+  return n;
+}
+
+/** \brief fast_num_parser_finish
+ * 
+ * \b Description
+ *
+ * End of input. Emit a pending number and reset the parser
+ *
+ * \param p parser state
+ * \returns number of emitted numbers
+ */
+
+size_t
+fast_num_parser_finish (struct fast_num_parser *p)
+{
+  size_t n;
+
+  switch (p->state) {
+  case NP_INT:
+  case NP_FRAC:
+  case NP_EXP:
+  case NP_EXP_SIGN:
+  case NP_EXP_DIGITS:
+    num_parser_emit (p);
+    return 1;
+  case NP_PAYLOAD:
+    n = num_parser_unclosed (p);
+    return n + fast_num_parser_finish (p);
+  case NP_INF:
+  case NP_NAN:
+    if (p->eval >= 3) {
+      num_parser_emit (p);
+      return 1;
+    }
+    break;
+  }
+  fast_num_parser_init (p, p->emit, p->arg);
+  return 0;
+}
+
+#define	CLASSIFY_CHAR(p)	((p) < end ? *(p) : '\0')
+
+/** \brief fast_classify_number
+ * 
+ * \b Description
+ *
+ * Classify number at ptr with the grammar of fast_strtod
+ *
+ * \param ptr start of input
+ * \param end end of input
+ * \param kind returns kind of number
+ * \param len returns number of characters fast_strtod would use
+ */
+
+void
+fast_classify_number (const char *ptr, const char *end,
+		      enum fast_number_kind *kind, size_t *len)
+{
+  const char *cp = ptr;
+  int frac = 0;
+
+  while (cp < end && isspace (*cp)) {
+    cp++;
+  }
+  if (cp < end && (*cp == '+' || *cp == '-')) {
+    cp++;
+  }
+  if (cp < end && (*cp == 'n' || *cp == 'N')) {
+    if (end - cp >= 3 && strncasecmp (cp, "nan", 3) == 0) {
+      const char *payload = cp + 3;
+
+      cp += strlen ("nan");
+      if (CLASSIFY_CHAR (payload) == '(') {
+	payload++;
+	while (payload < end && (isalpha (*payload) || isdigit (*payload) ||
+				 *payload == '_')) {
+	  payload++;
+	}
+	if (CLASSIFY_CHAR (payload) == ')') {
+	  cp = payload + 1;
+	}
+      }
+      *kind = FAST_NUMBER_NAN;
+      *len = cp - ptr;
+      return;
+    }
+    *kind = FAST_NUMBER_INVALID;
+    *len = 0;
+    return;
+  }
+  if (cp < end && (*cp == 'i' || *cp == 'I')) {
+    if (end - cp >= 3 && strncasecmp (cp, "inf", 3) == 0) {
+      cp += strlen ("inf");
+      if (end - cp >= 5 && strncasecmp (cp, "inity", strlen ("inity")) == 0) {
+	cp += strlen ("inity");
+      }
+      *kind = FAST_NUMBER_INF;
+      *len = cp - ptr;
+      return;
+    }
+    *kind = FAST_NUMBER_INVALID;
+    *len = 0;
+    return;
+  }
+  if (CLASSIFY_CHAR (cp) == '0' &&
+      (CLASSIFY_CHAR (cp + 1) == 'x' || CLASSIFY_CHAR (cp + 1) == 'X')) {
+    if (!isxdigit (CLASSIFY_CHAR (cp + 2)) &&
+	(CLASSIFY_CHAR (cp + 2) != DECIMAL_POINT ||
+	 !isxdigit (CLASSIFY_CHAR (cp + 3)))) {
+      /* only the 0 is used */
+      *kind = FAST_NUMBER_INT;
+      *len = cp + 1 - ptr;
+      return;
+    }
+    cp += 2;
+    while (cp < end && isxdigit (*cp)) {
+      cp++;
+    }
+    if (CLASSIFY_CHAR (cp) == DECIMAL_POINT) {
+      cp++;
+      while (cp < end && isxdigit (*cp)) {
+	cp++;
+      }
+    }
+    if (CLASSIFY_CHAR (cp) == 'p' || CLASSIFY_CHAR (cp) == 'P') {
+      cp++;
+      if (CLASSIFY_CHAR (cp) == '+' || CLASSIFY_CHAR (cp) == '-') {
+	cp++;
+      }
+      while (cp < end && NP_DIGIT (*cp)) {
+	cp++;
+      }
+    }
+    *kind = FAST_NUMBER_HEX;
+    *len = cp - ptr;
+    return;
+  }
+  if (!NP_DIGIT (CLASSIFY_CHAR (cp)) &&
+      (CLASSIFY_CHAR (cp) != DECIMAL_POINT ||
+       !NP_DIGIT (CLASSIFY_CHAR (cp + 1)))) {
+    *kind = FAST_NUMBER_INVALID;
+    *len = 0;
+    return;
+  }
+  while (cp < end && NP_DIGIT (*cp)) {
+    cp++;
+  }
+  if (CLASSIFY_CHAR (cp) == DECIMAL_POINT) {
+    frac = 1;
+    cp++;
+    while (cp < end && NP_DIGIT (*cp)) {
+      cp++;
+    }
+  }
+  if (CLASSIFY_CHAR (cp) == 'e' || CLASSIFY_CHAR (cp) == 'E') {
+    frac = 1;
+    cp++;
+    if (CLASSIFY_CHAR (cp) == '+' || CLASSIFY_CHAR (cp) == '-') {
+      cp++;
+    }
+    while (cp < end && NP_DIGIT (*cp)) {
+      cp++;
+    }
+  }
+  *kind = frac ? FAST_NUMBER_FLOAT : FAST_NUMBER_INT;
+  *len = cp - ptr;
+}
+
+/* Character classes of a field, bit i is character i */
+struct column_chars
+{
+  uint32_t digit;
+  uint32_t sign;
+  uint32_t dot;
+  uint32_t exp;
+  uint32_t other;
+};
+
+static void
+column_chars (const char *str, unsigned int len, struct column_chars *m)
+{
+  unsigned int i;
+  uint32_t bit;
+
+  memset (m, 0, sizeof (*m));
+  for (i = 0; i < len; i++) {
+    bit = UINT32_C (1) << i;
+    if (NP_DIGIT (str[i])) {
+      m->digit |= bit;
+    }
+    else if (str[i] == '+' || str[i] == '-') {
+      m->sign |= bit;
+    }
+    else if (str[i] == DECIMAL_POINT) {
+      m->dot |= bit;
+    }
+    else if (str[i] == 'e' || str[i] == 'E') {
+      m->exp |= bit;
+    }
+    else {
+      m->other |= bit;
+    }
+  }
+}
+
+#ifdef X86_AVX2
+/* Same as column_chars. Reads 32 characters. */
+static __attribute__ ((target ("avx2"))) void
+column_chars_avx2 (const char *str, unsigned int len, struct column_chars *m)
+{
+  __m256i v = _mm256_loadu_si256 ((const __m256i *) str);
+  __m256i d = _mm256_sub_epi8 (v, _mm256_set1_epi8 ('0'));
+  __m256i lower = _mm256_or_si256 (v, _mm256_set1_epi8 (0x20));
+  uint32_t valid = len == 32 ? UINT32_C (0xFFFFFFFF) :
+    (UINT32_C (1) << len) - 1;
+
+  m->digit = valid &
+    _mm256_movemask_epi8 (_mm256_cmpeq_epi8
+			  (_mm256_min_epu8 (d, _mm256_set1_epi8 (9)), d));
+  m->sign = valid &
+    _mm256_movemask_epi8 (_mm256_or_si256
+			  (_mm256_cmpeq_epi8 (v, _mm256_set1_epi8 ('+')),
+			   _mm256_cmpeq_epi8 (v, _mm256_set1_epi8 ('-'))));
+  m->dot = valid &
+    _mm256_movemask_epi8 (_mm256_cmpeq_epi8
+			  (v, _mm256_set1_epi8 (DECIMAL_POINT)));
+  m->exp = valid &
+    _mm256_movemask_epi8 (_mm256_cmpeq_epi8
+			  (lower, _mm256_set1_epi8 ('e')));
+  m->other = valid & ~(m->digit | m->sign | m->dot | m->exp);
+}
+#endif
+
+static ALWAYS_INLINE unsigned int
+column_popcount (uint32_t v)
+{
+#ifdef __GNUC__
+  return __builtin_popcount (v);
+#else
+  unsigned int n = 0;
+
+  while (v) {
+    v &= v - 1;
+    n++;
+  }
+  return n;
+#endif
+}
+
+/* Value of str survives float storage: the float printed with the
+   significant digits of str gives the same double. More than
+   PREC_FLT_NR significant digits never fit. */
+static int
+column_float_ok (const char *str)
+{
+  float f = fast_strtof (str, NULL);
+  double d = fast_strtod (str, NULL);
+  const char *cp;
+  int sig = 0;
+  int zeros = 0;
+  char out[64];
+
+  if (d - d != 0) {
+    /* inf or nan */
+    return 1;
+  }
+  if (strpbrk (str, "xX")) {
+    return (double) f == d;
+  }
+  for (cp = str; *cp && *cp != 'e' && *cp != 'E'; cp++) {
+    if (*cp == '0' && sig == 0) {
+      continue;
+    }
+    if (*cp == '0') {
+      zeros++;
+    }
+    else if (NP_DIGIT (*cp)) {
+      sig += zeros + 1;
+      zeros = 0;
+    }
+  }
+  if (sig > PREC_FLT_NR) {
+    return 0;
+  }
+  fast_ftoa (f, sig, out);
+  return fast_strtod (out, NULL) == d;
+}
+
+/** \brief fast_infer_column_type
+ * 
+ * \b Description
+ *
+ * Narrowest type that holds all strings of a column
+ *
+ * \param buf string data
+ * \param offsets string i is buf[offsets[i]] .. buf[offsets[i + 1] - 1]
+ * \param n number of strings
+ * \returns FAST_COLUMN_INT32, INT64, FLOAT, DOUBLE or STRING
+ */
+
+enum fast_column_type
+fast_infer_column_type (const char *buf, const size_t * offsets, size_t n)
+{
+  const char *limit = buf + offsets[n];
+  const char *str;
+  char tmp[64];
+  char *copy;
+  size_t len;
+  size_t i;
+  unsigned int ndigits;
+  unsigned int int_fit;
+  int all_int = 1;
+  int int64 = 0;
+  int all_float = 1;
+  int is_decimal;
+  int is_int;
+  int short_float;
+  int need_int;
+  int need_float;
+  enum fast_number_kind kind;
+  enum fast_convert_status status;
+  struct column_chars m;
+#ifdef X86_AVX2
+  int avx2 = __builtin_cpu_supports ("avx2");
+#endif
+
+  for (i = 0; i < n; i++) {
+    str = buf + offsets[i];
+    len = offsets[i + 1] - offsets[i];
+    if (len == 0) {
+      continue;
+    }
+    is_decimal = 0;
+    ndigits = 0;
+    if (len <= 32) {
+#ifdef X86_AVX2
+      if (avx2 && str + 32 <= limit) {
+	column_chars_avx2 (str, len, &m);
+      }
+      else
+#endif
+	column_chars (str, len, &m);
+      ndigits = column_popcount (m.digit);
+      /* [sign] digits [point digits] */
+      is_decimal = m.other == 0 && m.exp == 0 &&
+	(m.sign & ~UINT32_C (1)) == 0 && (m.dot & (m.dot - 1)) == 0 &&
+	m.digit != 0;
+    }
+    is_int = is_decimal && m.dot == 0;
+    /* at most 6 digits without exponent */
+    short_float = is_decimal && ndigits <= 6;
+    /* int size known from the number of digits */
+    int_fit = 0;
+    if (is_int && ndigits <= 9) {
+      int_fit = 32;
+    }
+    else if (is_int && ndigits > 10 && ndigits <= 18 &&
+	     str[m.sign & 1] != '0') {
+      int_fit = 64;
+    }
+    if (!is_decimal) {
+      /* checks the grammar, also of fields with other characters */
+      fast_classify_number (str, str + len, &kind, &len);
+      if (kind == FAST_NUMBER_INVALID || len != offsets[i + 1] - offsets[i]) {
+	return FAST_COLUMN_STRING;
+      }
+      if (kind != FAST_NUMBER_INT) {
+	all_int = 0;
+      }
+    }
+    else if (!is_int) {
+      all_int = 0;
+    }
+    if (all_int && int_fit == 64) {
+      int64 = 1;
+    }
+    need_int = all_int && int_fit == 0;
+    /* ints of 7 digits are exact floats */
+    need_float = all_float && !short_float && !(is_int && ndigits <= 7);
+    if (!need_int && !need_float) {
+      continue;
+    }
+    copy = len < sizeof (tmp) ? tmp : malloc (len + 1);
+    if (copy == NULL) {
+      return FAST_COLUMN_STRING;
+    }
+    memcpy (copy, str, len);
+    copy[len] = '\0';
+    if (need_int) {
+      fast_strtos32_status (copy, NULL, 10, &status);
+      if (status != FAST_CONVERT_OK) {
+	fast_strtos64_status (copy, NULL, 10, &status);
+	int64 = 1;
+	all_int = status == FAST_CONVERT_OK;
+      }
+    }
+    if (need_float) {
+      all_float = column_float_ok (copy);
+    }
+    if (copy != tmp) {
+      free (copy);
+    }
+  }
+  if (all_int) {
+    return int64 ? FAST_COLUMN_INT64 : FAST_COLUMN_INT32;
+  }
+  return all_float ? FAST_COLUMN_FLOAT : FAST_COLUMN_DOUBLE;
+}
+
+/* First digit in [cp, end) or NULL */
+static const char *
+scan_digit (const char *cp, const char *end)
+{
+  while (cp < end && !NP_DIGIT (*cp)) {
+    cp++;
+  }
+  return cp < end ? cp : NULL;
+}
+
+#ifdef X86_AVX2
+/* Same as scan_digit, 32 characters per compare */
+static __attribute__ ((target ("avx2"))) const char *
+scan_digit_avx2 (const char *cp, const char *end)
+{
+  __m256i v;
+  __m256i d;
+  uint32_t mask;
+
+  while (end - cp >= 32) {
+    v = _mm256_loadu_si256 ((const __m256i *) cp);
+    d = _mm256_sub_epi8 (v, _mm256_set1_epi8 ('0'));
+    mask = _mm256_movemask_epi8 (_mm256_cmpeq_epi8
+				 (_mm256_min_epu8 (d, _mm256_set1_epi8 (9)),
+				  d));
+    if (mask) {
+      return cp + __builtin_ctz (mask);
+    }
+    cp += 32;
+  }
+  return scan_digit (cp, end);
+}
+#endif
+
+/** \brief fast_scan_numbers
+ * 
+ * \b Description
+ *
+ * Find and convert all numbers in text
+ *
+ * \param buf text
+ * \param len length of text
+ * \param found called for each number
+ * \param arg first argument of found
+ * \returns number of numbers found
+ */
+
+size_t
+fast_scan_numbers (const char *buf, size_t len,
+		   void (*found) (void *arg,
+				  const struct fast_scan_number * num),
+		   void *arg)
+{
+  const char *end = buf + len;
+  const char *last = buf;
+  const char *cp = buf;
+  const char *start;
+  const char *str;
+  char tmp[64];
+  char *copy;
+  size_t nlen;
+  size_t count = 0;
+  enum fast_number_kind kind;
+  enum fast_convert_status status;
+  struct fast_scan_number num;
+#ifdef X86_AVX2
+  int avx2 = __builtin_cpu_supports ("avx2");
+#endif
+
+  for (;;) {
+#ifdef X86_AVX2
+    cp = avx2 ? scan_digit_avx2 (cp, end) : scan_digit (cp, end);
+#else
+    cp = scan_digit (cp, end);
+#endif
+    if (cp == NULL) {
+      break;
+    }
+    /* .5 and a sign that does not follow a word or number */
+    start = cp;
+    if (start - 1 >= last && start[-1] == DECIMAL_POINT &&
+	(start - 1 == buf || !NP_DIGIT (start[-2]))) {
+      start--;
+    }
+    if (start - 1 >= last && (start[-1] == '-' || start[-1] == '+') &&
+	(start - 1 == buf || (!isalnum (start[-2]) &&
+			      start[-2] != DECIMAL_POINT))) {
+      start--;
+    }
+    fast_classify_number (start, end, &kind, &nlen);
+    /* no exponent without digits or point at the end of a sentence */
+    if (kind == FAST_NUMBER_FLOAT) {
+      if (start[nlen - 1] == '+' || start[nlen - 1] == '-') {
+	nlen--;
+      }
+      if (start[nlen - 1] == 'e' || start[nlen - 1] == 'E') {
+	nlen--;
+      }
+      if (start[nlen - 1] == DECIMAL_POINT && NP_DIGIT (start[nlen - 2])) {
+	nlen--;
+      }
+      if (memchr (start, DECIMAL_POINT, nlen) == NULL &&
+	  memchr (start, 'e', nlen) == NULL &&
+	  memchr (start, 'E', nlen) == NULL) {
+	kind = FAST_NUMBER_INT;
+      }
+    }
+    /* fast_strto* look a few characters ahead, so copy at the end */
+    str = start;
+    copy = NULL;
+    if (end - start < (ptrdiff_t) nlen + 4) {
+      copy = nlen < sizeof (tmp) ? tmp : malloc (nlen + 1);
+      if (copy == NULL) {
+	break;
+      }
+      memcpy (copy, start, nlen);
+      copy[nlen] = '\0';
+      str = copy;
+    }
+    num.pos = start - buf;
+    num.len = nlen;
+    num.kind = kind;
+    num.i = 0;
+    if (kind == FAST_NUMBER_INT) {
+      num.i = fast_strtos64_status (str, NULL, 10, &status);
+      num.d = num.i;
+      if (status == FAST_CONVERT_OVERFLOW) {
+	num.kind = FAST_NUMBER_FLOAT;
+	num.i = 0;
+	num.d = fast_strtod (str, NULL);
+      }
+    }
+    else {
+      num.d = fast_strtod (str, NULL);
+    }
+    if (copy && copy != tmp) {
+      free (copy);
+    }
+    found (arg, &num);
+    count++;
+    cp = last = start + nlen;
+  }
+  return count;
+}
+
+/** \brief narrow_double
+ * 
+ * \b Description
+ *
+ * Round double to a smaller binary format (round half even)
+ *
+ * \param v double value
+ * \param man number of stored mantissa bits
+ * \param exp number of exponent bits
+ * \param dir sign of (original value - v) when v is a tie, 0 if exact
+ * \param tie returns 1 if v is exactly halfway between two results
+ * \returns bits of result
+ */
+
+static uint32_t
+narrow_double (double v, unsigned int man, unsigned int exp, int dir,
+	       int *tie)
+{
+  union
+  {
+    uint64_t u;
+    double d;
+  } td;
+  uint32_t sign;
+  uint32_t inf = ((UINT32_C (1) << exp) - 1) << man;
+  int bias = (1 << (exp - 1)) - 1;
+  int e;
+  int ulp;
+  unsigned int k;
+  uint64_t m;
+  uint64_t q;
+  uint64_t r;
+
+  td.d = v;
+  sign = (uint32_t) (td.u >> 63) << (man + exp);
+  e = (int) ((td.u >> 52) & 0x7FF);
+  m = td.u & UINT64_C (0x000FFFFFFFFFFFFF);
+  *tie = 0;
+  if (e == 0x7FF) {
+    return sign | inf | (m ? UINT32_C (1) << (man - 1) : 0);
+  }
+  if (e == 0) {
+    /* double subnormals are far below the smallest result */
+    return sign;
+  }
+  m += UINT64_C (0x0010000000000000);
+  e -= 1075;
+  /* ulp exponent of result: value is m * 2^e and 2^52 <= m < 2^53 */
+  ulp = e + 52 - (int) man;
+  if (ulp < 1 - bias - (int) man) {
+    ulp = 1 - bias - (int) man;
+  }
+  k = (unsigned int) (ulp - e);
+  if (k >= 54) {
+    return sign;
+  }
+  q = m >> k;
+  r = m & ((UINT64_C (1) << k) - 1);
+  if (r == UINT64_C (1) << (k - 1)) {
+    *tie = 1;
+    q += dir > 0 || (dir == 0 && (q & 1));
+  }
+  else {
+    q += r > UINT64_C (1) << (k - 1);
+  }
+  q += (uint64_t) (ulp + bias + (int) man - 1) << man;
+  return sign | (q >= inf ? inf : (uint32_t) q);
+}
+
+/** \brief hex_dir
+ * 
+ * \b Description
+ *
+ * Compare the digits of a hex string exactly with (mh * 2^64 + ml) * 2^e.
+ * This is only used for ties, so the bits are compared one by one.
+ *
+ * \param cp string after the 0x prefix
+ * \param mh 64 bit msb of non zero mantissa
+ * \param ml 64 bit lsb of non zero mantissa
+ * \param e binary exponent
+ * \returns -1, 0 or 1 when string is below, equal or above value
+ */
+
+static int
+hex_dir (const unsigned char *cp, uint64_t mh, uint64_t ml, int e)
+{
+  const unsigned char *first = NULL;
+  int dp = 0;
+  int seen_dp = 0;
+  int exp = 0;
+  int esign = 0;
+  int top;
+  int i;
+  int k;
+  int d;
+  int bit;
+  int vbit;
+
+  /* normalize value to a top bit at bit 127 */
+  if (mh == 0) {
+    mh = ml;
+    ml = 0;
+    e -= 64;
+  }
+  k = clz64 (mh);
+  if (k) {
+    mh = (mh << k) | (ml >> (64 - k));
+    ml <<= k;
+    e -= k;
+  }
+  while (isxdigit (*cp) || (*cp == DECIMAL_POINT && !seen_dp)) {
+    if (*cp == DECIMAL_POINT) {
+      seen_dp = 1;
+    }
+    else if (!first && *cp != '0') {
+      first = cp;
+    }
+    if (*cp != DECIMAL_POINT && (first ? !seen_dp : seen_dp)) {
+      dp += first ? 1 : -1;
+    }
+    cp++;
+  }
+  if (!first) {
+    return 0;
+  }
+  if ((*cp == 'p' || *cp == 'P') &&
+      (isdigit (cp[1]) ||
+       ((cp[1] == '+' || cp[1] == '-') && isdigit (cp[2])))) {
+    cp++;
+    if (*cp == '+' || *cp == '-') {
+      esign = *cp++ == '-';
+    }
+    while (isdigit (*cp)) {
+      if (exp < 100000) {
+	exp = exp * 10 + *cp - '0';
+      }
+      cp++;
+    }
+  }
+  d = isdigit (*first) ? *first - '0' : (*first | 0x20) - 'a' + 10;
+  top = 63 - clz64 (d);
+  /* exponents of the top bits */
+  k = 4 * (dp - 1) + top + (esign ? -exp : exp);
+  if (k != e + 127) {
+    return k > e + 127 ? 1 : -1;
+  }
+  i = 0;
+  for (cp = first; isxdigit (*cp) || *cp == DECIMAL_POINT; cp++) {
+    if (*cp == DECIMAL_POINT) {
+      continue;
+    }
+    d = isdigit (*cp) ? *cp - '0' : (*cp | 0x20) - 'a' + 10;
+    for (k = cp == first ? top : 3; k >= 0; k--) {
+      bit = (d >> k) & 1;
+      if (i < 128) {
+	vbit = (int) ((i < 64 ? mh >> (63 - i) : ml >> (127 - i)) & 1);
+	if (bit != vbit) {
+	  return bit > vbit ? 1 : -1;
+	}
+	i++;
+      }
+      else if (bit) {
+	return 1;
+      }
+    }
+  }
+  /* string ended, value is above when it has more bits */
+  if (i < 64) {
+    return (mh << i) || ml ? -1 : 0;
+  }
+  return i < 128 && (ml << (i - 64)) ? -1 : 0;
+}
+
+/** \brief decimal_dir
+ * 
+ * \b Description
+ *
+ * Compare a decimal or hex string exactly with (mh * 2^64 + ml) * 2^e.
+ *
+ * \param str string that was converted
+ * \param mh 64 bit msb of non zero mantissa
+ * \param ml 64 bit lsb of non zero mantissa
+ * \param e binary exponent
+ * \param big bignum buffer large enough for all digits
+ * \param digits digit buffer large enough for all digits
+ * \returns -1, 0 or 1 when string is below, equal or above value
+ */
+
+static int
+decimal_dir (const char *str, uint64_t mh, uint64_t ml, int e,
+	     uint32_t * big, char *digits)
+{
+  const unsigned char *cp = (const unsigned char *) str;
+  const unsigned char *first = NULL;
+  unsigned int n;
+  unsigned int i;
+  int x;
+  int dp = 0;
+  int lead = 0;
+  int seen_dp = 0;
+  int exp = 0;
+  int esign = 0;
+  int r;
+
+  while (isspace (*cp)) {
+    cp++;
+  }
+  if (*cp == '+' || *cp == '-') {
+    cp++;
+  }
+  if (*cp == '0' && (cp[1] == 'x' || cp[1] == 'X')) {
+    return hex_dir (cp + 2, mh, ml, e);
+  }
+  while (isdigit (*cp) || (*cp == DECIMAL_POINT && !seen_dp)) {
+    if (*cp == DECIMAL_POINT) {
+      seen_dp = 1;
+    }
+    else {
+      if (!first) {
+	if (*cp != '0') {
+	  first = cp;
+	}
+	else {
+	  lead++;
+	}
+      }
+      dp += !seen_dp;
+    }
+    cp++;
+  }
+  if (!first) {
+    return 0;
+  }
+  if ((*cp == 'e' || *cp == 'E') &&
+      (isdigit (cp[1]) ||
+       ((cp[1] == '+' || cp[1] == '-') && isdigit (cp[2])))) {
+    cp++;
+    if (*cp == '+' || *cp == '-') {
+      esign = *cp++ == '-';
+    }
+    while (isdigit (*cp)) {
+      if (exp < 100000) {
+	exp = exp * 10 + *cp - '0';
+      }
+      cp++;
+    }
+  }
+  exp = (esign ? -exp : exp) + dp - lead - 1;
+
+  n = exact_digits (mh, ml, e, big, digits, &x);
+  if (exp != x) {
+    return exp > x ? 1 : -1;
+  }
+  i = 0;
+  for (cp = first; isdigit (*cp) || *cp == DECIMAL_POINT; cp++) {
+    if (*cp != DECIMAL_POINT) {
+      r = *cp - (i < n ? digits[i] : '0');
+      if (r) {
+	return r > 0 ? 1 : -1;
+      }
+      i++;
+    }
+  }
+  while (i < n && digits[i] == '0') {
+    i++;
+  }
+  return i < n ? -1 : 0;
+}
+
+/** \brief strto_narrow
+ * 
+ * \b Description
+ *
+ * Convert string to a smaller binary format with correct rounding.
+ * The double result is only rounded again after checking the string
+ * when it is exactly halfway between two results.
+ *
+ * \param str string to convert
+ * \param endptr optional endptr
+ * \param man number of stored mantissa bits
+ * \param exp number of exponent bits
+ * \returns bits of result
+ */
+
+static uint32_t
+strto_narrow (const char *str, char **endptr, unsigned int man,
+	      unsigned int exp)
+{
+  double v = fast_strtod (str, endptr);
+  int tie;
+  uint32_t r = narrow_double (v, man, exp, 0, &tie);
+
+  if (UNLIKELY (tie)) {
+    uint32_t big[EXACT_DBL_LIMBS];
+    char digits[EXACT_DBL_DIGITS];
+    union
+    {
+      uint64_t u;
+      double d;
+    } td;
+
+    /* a tie is always a normal double */
+    td.d = v;
+    r = narrow_double (v, man, exp,
+		       decimal_dir (str, 0,
+				    (td.u & UINT64_C (0x000FFFFFFFFFFFFF)) |
+				    UINT64_C (0x0010000000000000),
+				    (int) ((td.u >> 52) & 0x7FF) - 1075, big,
+				    digits), &tie);
+  }
+  return r;
+}
+
+/** \brief pow5_64
+ * 
+ * \b Description
+ *
+ * Calculate 5^j
+ *
+ * \param j exponent, at most 27
+ * \returns 5^j
+ */
+
+static uint64_t
+pow5_64 (int j)
+{
+  int a = j < 19 ? j : 19;
+
+  return (ipowers64[a] >> a) * (ipowers64[j - a] >> (j - a));
+}
+
+/** \brief shl_128
+ * 
+ * \b Description
+ *
+ * Shift 128 bit value left
+ *
+ * \param h 64 bit msb
+ * \param l 64 bit lsb
+ * \param n shift, 1 to 127
+ */
+
+static void
+shl_128 (uint64_t * h, uint64_t * l, int n)
+{
+  if (n >= 64) {
+    *h = *l << (n - 64);
+    *l = 0;
+  }
+  else {
+    *h = (*h << n) | (*l >> (64 - n));
+    *l <<= n;
+  }
+}
+
+/** \brief small_cmp
+ * 
+ * \b Description
+ *
+ * Compare (ah * 2^64 + al) * 2^s with q * (bh * 2^64 + bl) exactly
+ *
+ * \param ah 64 bit msb of non zero a
+ * \param al 64 bit lsb of non zero a
+ * \param s binary exponent of a
+ * \param bh 64 bit msb of b
+ * \param bl 64 bit lsb of b
+ * \param q multiplier of b, q * b fits in 128 bits
+ * \returns -1, 0 or 1 when a * 2^s is below, equal or above q * b
+ */
+
+static int
+small_cmp (uint64_t ah, uint64_t al, int s, uint64_t bh, uint64_t bl,
+	   uint64_t q)
+{
+  uint64_t ch = bh * q + mul_64 (bl, q);
+  uint64_t cl = bl * q;
+  int la;
+  int lc;
+
+  if ((ch | cl) == 0) {
+    return 1;
+  }
+  la = (ah ? 128 - clz64 (ah) : 64 - clz64 (al)) + s;
+  lc = ch ? 128 - clz64 (ch) : 64 - clz64 (cl);
+  if (la != lc) {
+    return la > lc ? 1 : -1;
+  }
+  /* same top bit, shift the one with the lower exponent up */
+  if (s > 0) {
+    shl_128 (&ah, &al, s);
+  }
+  else if (s < 0) {
+    shl_128 (&ch, &cl, -s);
+  }
+  if (ah != ch) {
+    return ah > ch ? 1 : -1;
+  }
+  return al == cl ? 0 : al > cl ? 1 : -1;
+}
+
+/** \brief small_trunc
+ * 
+ * \b Description
+ *
+ * Calculate m * 2^e / 10^k rounded down. The values of the small
+ * formats need at most 5^54, so all calculations fit in 128 bits.
+ * The quotient is estimated with doubles and corrected exactly.
+ *
+ * \param m non zero mantissa below 2^14
+ * \param e binary exponent
+ * \param k decimal exponent
+ * \param sticky returns 1 when the quotient is not exact
+ * \returns quotient
+ */
+
+static uint64_t
+small_trunc (uint64_t m, int e, int k, int *sticky)
+{
+  int j = k < 0 ? -k : k;
+  int s = e - k;
+  uint64_t ph = 0;
+  uint64_t pl = pow5_64 (j < 27 ? j : 27);
+  uint64_t ah = 0;
+  uint64_t al = m;
+  uint64_t bh = 0;
+  uint64_t bl = 1;
+  uint64_t q;
+  int c;
+
+  if (j > 27) {
+    uint64_t p2 = pow5_64 (j - 27);
+
+    ph = mul_64 (pl, p2);
+    pl *= p2;
+  }
+  /* m * 2^e / 10^k = m * 2^(e - k) / 5^k */
+  if (k < 0) {
+    ah = mul_64 (m, pl) + m * ph;
+    al = m * pl;
+  }
+  else {
+    bh = ph;
+    bl = pl;
+  }
+  q = (uint64_t) (ldexp (ldexp ((double) ah, 64) + (double) al, s) /
+		  (ldexp ((double) bh, 64) + (double) bl));
+  for (;;) {
+    c = small_cmp (ah, al, s, bh, bl, q);
+    if (c < 0) {
+      q--;
+    }
+    else if (small_cmp (ah, al, s, bh, bl, q + 1) >= 0) {
+      q++;
+    }
+    else {
+      break;
+    }
+  }
+  *sticky = c != 0;
+  return q;
+}
+
+/** \brief small_toa
+ * 
+ * \b Description
+ *
+ * Convert a float that is exactly representable in a smaller format to
+ * the shortest string that converts back to the same bits.
+ * The value and the halfway points to its neighbours are truncated to
+ * max + 1 digits with a sticky bit. The shortest precision is the first
+ * one where the value rounded to it lies between the halfway points,
+ * so only one fast_ftoa call is done.
+ *
+ * \param v float value
+ * \param bits bits of small value
+ * \param man number of stored mantissa bits
+ * \param exp number of exponent bits
+ * \param max precision that always converts back
+ * \param line pointer to result
+ * \returns lenght string
+ */
+
+static unsigned int
+small_toa (float v, uint32_t bits, unsigned int man, unsigned int exp,
+	   int max, char *line)
+{
+  uint32_t inf = ((UINT32_C (1) << exp) - 1) << man;
+  uint32_t se = (bits & inf) >> man;
+  uint64_t m = bits & ((UINT32_C (1) << man) - 1);
+  /* exponent of subnormals */
+  int e = 2 - (1 << (exp - 1)) - (int) man;
+  int p = 1;
+
+  if ((bits & inf) != inf && (se | m)) {
+    uint64_t tx;
+    uint64_t tl;
+    uint64_t th;
+    int sx;
+    int sl;
+    int sh;
+    int even;
+    int n;
+    int k;
+
+    if (se) {
+      m |= UINT64_C (1) << man;
+      e += se - 1;
+    }
+    /* halfway points round to even */
+    even = (m & 1) == 0;
+    /* v is in [2^n, 2^(n+1)), the arithmetic shift rounds down */
+    n = 63 - clz64 (m) + e;
+    k = ((n * 1233) >> 12) - max;
+    for (;;) {
+      tx = small_trunc (4 * m, e - 2, k, &sx);
+      if (tx >= ipowers64[max + 1]) {
+	k++;
+      }
+      else if (tx < ipowers64[max]) {
+	k--;
+      }
+      else {
+	break;
+      }
+    }
+    /* lower neighbour can be in the binade below */
+    tl = small_trunc (se > 1 && m == UINT64_C (1) << man ? 4 * m - 1 :
+		      4 * m - 2, e - 2, k, &sl);
+    th = small_trunc (4 * m + 2, e - 2, k, &sh);
+    for (p = 1; p < max; p++) {
+      uint64_t div = ipowers64[max + 1 - p];
+      uint64_t q = tx / div;
+      uint64_t rem = tx - q * div;
+
+      /* round half to even like fast_ftoa */
+      q += rem > div / 2 || (rem == div / 2 && (sx || (q & 1)));
+      q *= div;
+      if ((q > tl || (q == tl && !sl && even)) &&
+	  (q < th || (q == th && (sh || even)))) {
+	break;
+      }
+    }
+  }
+  return fast_ftoa (v, p, line);
+}
+
+/** \brief fast_htoa
+ * 
+ * \b Description
+ *
+ * Convert half float bits to shortest ascii
+ *
+ * \param v half float bits
+ * \param line pointer to result
+ * \returns lenght string
+ */
+
+unsigned int
+fast_htoa (uint16_t v, char *line)
+{
+  union
+  {
+    uint32_t u;
+    float f;
+  } tf;
+  uint32_t e = (v >> 10) & 0x1F;
+  uint32_t m = v & 0x3FF;
+
+  if (e == 0x1F) {
+    tf.u = 0x7F800000 | (m << 13);
+  }
+  else if (e) {
+    tf.u = ((e + 112) << 23) | (m << 13);
+  }
+  else {
+    tf.f = (float) m *(1.0f / 16777216.0f);	/* 2^-24 */
+  }
+  tf.u |= (uint32_t) (v & 0x8000) << 16;
+  return small_toa (tf.f, v, 10, 5, PREC_HALF_NR, line);
+}
+
+/** \brief fast_bf16toa
+ * 
+ * \b Description
+ *
+ * Convert bfloat16 bits to shortest ascii
+ *
+ * \param v bfloat16 bits
+ * \param line pointer to result
+ * \returns lenght string
+ */
+
+unsigned int
+fast_bf16toa (uint16_t v, char *line)
+{
+  union
+  {
+    uint32_t u;
+    float f;
+  } tf;
+
+  tf.u = (uint32_t) v << 16;
+  return small_toa (tf.f, v, 7, 8, PREC_BF16_NR, line);
+}
+
+/** \brief fast_strtoh
+ * 
+ * \b Description
+ *
+ * Convert string to half float bits
+ *
+ * \param str string to convert
+ * \param endptr optional endptr
+ * \returns half float bits
+ */
+
+uint16_t
+fast_strtoh (const char *str, char **endptr)
+{
+  return (uint16_t) strto_narrow (str, endptr, 10, 5);
+}
+
+/** \brief fast_strtobf16
+ * 
+ * \b Description
+ *
+ * Convert string to bfloat16 bits
+ *
+ * \param str string to convert
+ * \param endptr optional endptr
+ * \returns bfloat16 bits
+ */
+
+uint16_t
+fast_strtobf16 (const char *str, char **endptr)
+{
+  return (uint16_t) strto_narrow (str, endptr, 7, 8);
+}
+
+#if defined (LDBL_X87) || defined (FLOAT128)
+/* long double and __float128 subnormals need up to 11565 digits */
+#define	EXACT_LDBL_DIGITS	11700
+#define	EXACT_LDBL_LIMBS	((EXACT_LDBL_DIGITS + 8) / 9)
+#endif
+
+#ifdef LDBL_X87
+
+union ldbl_bits
+{
+  long double ld;
+  struct
+  {
+    uint64_t m;
+    uint16_t se;
+  } p;
+};
+
+/** \brief mul_128
+ * 
+ * \b Description
+ *
+ * Multiply two 128 bit numbers and return high 128 bits.
+ * The low part is truncated.
+ *
+ * \param a first number
+ * \param b second number
+ * \returns high part of a * b
+ */
+
+static ALWAYS_INLINE unsigned __int128
+mul_128 (unsigned __int128 a, unsigned __int128 b)
+{
+  uint64_t a1 = (uint64_t) (a >> 64);
+  uint64_t a0 = (uint64_t) a;
+  uint64_t b1 = (uint64_t) (b >> 64);
+  uint64_t b0 = (uint64_t) b;
+  unsigned __int128 p01 = (unsigned __int128) a0 *b1;
+  unsigned __int128 p10 = (unsigned __int128) a1 *b0;
+  unsigned __int128 mid = (((unsigned __int128) a0 * b0) >> 64) +
+    (uint64_t) p01 + (uint64_t) p10;
+
+  return (unsigned __int128) a1 *b1 + (p01 >> 64) + (p10 >> 64) +
+    (mid >> 64);
+}
+
+/** \brief ldpow10
+ * 
+ * \b Description
+ *
+ * Get 10^k as 128 bit mantissa (msb set) and binary exponent
+ * from ldpowers10 * ldpowers10_28.
+ *
+ * \param k power of 10 (-5012 <= k <= 5011)
+ * \param exp returns binary exponent
+ * \returns mantissa
+ */
+
+static ALWAYS_INLINE unsigned __int128
+ldpow10 (int k, int *exp)
+{
+  unsigned int j = (unsigned int) (k + 179 * 28) / 28;
+  unsigned int i = (unsigned int) (k + 179 * 28) % 28;
+  unsigned __int128 t = ((unsigned __int128) ldpowers10[j].mul1 << 64) |
+    ldpowers10[j].mul2;
+
+  *exp = ldpowers10[j].exp;
+  if (i) {
+    t = mul_128 (t, ((unsigned __int128) ldpowers10_28[i].mul1 << 64) |
+		 ldpowers10_28[i].mul2);
+    *exp += ldpowers10_28[i].exp + 128;
+    if ((t >> 127) == 0) {
+      t <<= 1;
+      (*exp)--;
+    }
+  }
+  return t;
+}
+
+/** \brief exact_ldtoa
+ * 
+ * \b Description
+ *
+ * Convert m * 2^e exactly to ascii
+ *
+ * \param m non zero mantissa
+ * \param e binary exponent
+ * \param size precision
+ * \param s pointer to result
+ * \returns lenght string
+ */
+
+static unsigned int
+exact_ldtoa (uint64_t m, int e, int size, char *s)
+{
+  uint32_t big[EXACT_LDBL_LIMBS];
+  char digits[EXACT_LDBL_DIGITS];
+
+  return exact_convert (0, m, e, size, big, digits, s);
+}
+
+/** \brief fast_ldtoa
+ * 
+ * \b Description
+ *
+ * Convert long double to ascii
+ *
+ * \param v long double value
+ * \param size precision
+ * \param line pointer to result
+ * \returns lenght string
+ */
+
+unsigned int
+fast_ldtoa (long double v, int size, char *line)
+{
+  union ldbl_bits tl;
+  char *s = line;
+  char digits[24];
+  uint64_t m;
+  uint64_t f;
+  unsigned __int128 p;
+  unsigned __int128 n;
+  unsigned __int128 lo;
+  unsigned __int128 hi;
+  unsigned int sh;
+  int e;
+  int x;
+  int t;
+
+  tl.ld = v;
+  if (size <= 0) {
+    size = PREC_LDBL_NR;
+  }
+  if (tl.p.se & 0x8000) {
+    *s++ = '-';
+  }
+  e = tl.p.se & 0x7FFF;
+  m = tl.p.m;
+  if (UNLIKELY (e == 0x7FFF || (e && (m >> 63) == 0))) {
+    /* like glibc unnormals are printed as nan */
+    STAT_INC (inf_nan);
+    memcpy (s, m == UINT64_C (0x8000000000000000) ? "inf" : "nan", 4);
+    return s + 3 - line;
+  }
+  if (e == 0) {
+    /* like glibc ignore msb of pseudo denormals */
+    m &= UINT64_C (0x7FFFFFFFFFFFFFFF);
+  }
+  if (m == 0) {
+    *s++ = '0';
+    *s = '\0';
+    return s - line;
+  }
+  e = (e ? e : 1) - 16383 - 63;
+  if (UNLIKELY (size > PREC_LDBL_NR)) {
+    return s + exact_ldtoa (m, e, size, s) - line;
+  }
+  sh = __builtin_clzll (m);
+  m <<= sh;
+  e -= (int) sh;
+
+  /* n = m * 2^e * 10^(size - 1 - x) must have size digits */
+  lo = (unsigned __int128) ipowers64[size > 20 ? 19 : size - 1] *
+    ipowers64[size > 20 ? size - 20 : 0];
+  hi = (unsigned __int128) ipowers64[size > 19 ? 19 : size] *
+    ipowers64[size > 19 ? size - 19 : 0];
+  x = ((e + 63) * 78913) >> 18;	/* (e + 63) * log10 (2) */
+  for (;;) {
+    p = mul_128 (ldpow10 (size - 1 - x, &t), (unsigned __int128) m << 64);
+    sh = (unsigned int) -(e + t + 64);
+    n = sh < 128 ? p >> sh : 0;
+    if (n >= hi) {
+      x++;
+    }
+    else if (n < lo) {
+      x--;
+    }
+    else {
+      break;
+    }
+  }
+  f = (uint64_t) ((p << (128 - sh)) >> 64);
+  if (UNLIKELY (f - (UINT64_C (1) << 63) + (UINT64_C (1) << 24) <
+		(UINT64_C (1) << 25))) {
+    /* too close to halfway for the error in the power of 10 */
+    return s + exact_ldtoa (m, e, size, s) - line;
+  }
+  n += f > (UINT64_C (1) << 63);
+  if (n == hi) {
+    n = lo;
+    x++;
+  }
+  return s + exact_format (digits, fast_uint128 (n, digits), x, size, s) -
+    line;
+}
+
+/** \brief strtold_dir
+ * 
+ * \b Description
+ *
+ * Compare decimal string exactly with halfway point (2 * q + 1) * 2^e
+ *
+ * \param str string that was converted
+ * \param q lower result
+ * \param e binary exponent of halfway point
+ * \returns -1, 0 or 1 when string is below, equal or above halfway point
+ */
+
+static int
+strtold_dir (const char *str, uint64_t q, int e)
+{
+  uint32_t big[EXACT_LDBL_LIMBS];
+  char digits[EXACT_LDBL_DIGITS];
+
+  return decimal_dir (str, q >> 63, (q << 1) | 1, e, big, digits);
+}
+
+/** \brief fast_strtold
  * 
  * \b Description
  *
- * Convert string to float
+ * Convert string to long double
  *
  * \param str string to convert
  * \param endptr optional endptr
- * \returns converted float value
+ * \returns converted long double value
  */
 
-float
-fast_strtof (const char *str, char **endptr)
+long double
+fast_strtold (const char *str, char **endptr)
 {
   char *cp = (char *) str;
   int sign = 0;
@@ -5939,12 +11932,18 @@ fast_strtof (const char *str, char **endptr)
   int exp;
   int tmp;
   int c;
-  uint64_t n;
-  union
-  {
-    uint32_t u;
-    float f;
-  } tf;
+  int t;
+  int hex = 0;
+  int sticky = 0;
+  unsigned int drop;
+  uint64_t n1;
+  uint64_t n2;
+  uint64_t q;
+  unsigned __int128 n;
+  unsigned __int128 p;
+  unsigned __int128 half;
+  unsigned __int128 rem;
+  union ldbl_bits tl;
 
   while (isspace (*cp)) {
     cp++;
@@ -5958,6 +11957,7 @@ fast_strtof (const char *str, char **endptr)
   }
   if (*cp == 'n' || *cp == 'N') {
     if (strncasecmp (cp, "nan", 3) == 0) {
+      STAT_INC (inf_nan);
       cp += strlen ("nan");
       if (endptr) {
 	*endptr = cp;
@@ -5973,16 +11973,18 @@ fast_strtof (const char *str, char **endptr)
 	  }
 	}
       }
-      tf.u = sign ? 0xFFC00000 : 0x7FC00000;
-      return tf.f;
+      tl.p.m = UINT64_C (0xC000000000000000);
+      tl.p.se = (sign << 15) | 0x7FFF;
+      return tl.ld;
     }
     if (endptr) {
       *endptr = (char *) str;
     }
-    return 0.0;
+    return 0.0L;
   }
   if (*cp == 'i' || *cp == 'I') {
     if (strncasecmp (cp, "inf", 3) == 0) {
+      STAT_INC (inf_nan);
       cp += strlen ("inf");
       if (strncasecmp (cp, "inity", strlen ("inity")) == 0) {
 	cp += strlen ("inity");
@@ -5990,46 +11992,57 @@ fast_strtof (const char *str, char **endptr)
       if (endptr) {
 	*endptr = cp;
       }
-      tf.u = sign ? 0xFF800000 : 0x7F800000;
-      return tf.f;
+      tl.p.m = UINT64_C (0x8000000000000000);
+      tl.p.se = (sign << 15) | 0x7FFF;
+      return tl.ld;
     }
     if (endptr) {
       *endptr = (char *) str;
     }
-    return 0.0;
+    return 0.0L;
   }
   if (*cp == '0' && (cp[1] == 'x' || cp[1] == 'X')) {
     if (!isxdigit (cp[2]) && (cp[2] != DECIMAL_POINT || !isxdigit (cp[3]))) {
       if (endptr) {
 	*endptr = &cp[1];
       }
-      return 0.0 * (sign ? -1.0 : 1.0);
+      return 0.0L * (sign ? -1.0L : 1.0L);
     }
+    STAT_INC (hex_float);
+    hex = 1;
     cp += 2;
-    n = 0;
+    n1 = 0;
+    n2 = 0;
     exp = 0;
     c = 0;
+    /* 32 hex digits in n1:n2, sticky is set for ignored non zero digits */
     while (isxdigit (*cp)) {
-      if (c < 16) {
-	n = n * 16 + convert_num[*cp & 0xFFu];
+      if (c < 32) {
+	n1 = (n1 << 4) | (n2 >> 60);
+	n2 = (n2 << 4) | convert_num[*cp & 0xFFu];
       }
       else {
 	exp += 4;
+	sticky |= *cp != '0';
       }
       cp++;
-      if (n) {
+      if (n1 || n2) {
 	c++;
       }
     }
     if (*cp == DECIMAL_POINT) {
       cp++;
       while (isxdigit (*cp)) {
-	if (c < 16) {
-	  n = n * 16 + convert_num[*cp & 0xFFu];
+	if (c < 32) {
+	  n1 = (n1 << 4) | (n2 >> 60);
+	  n2 = (n2 << 4) | convert_num[*cp & 0xFFu];
 	  exp -= 4;
 	}
+	else {
+	  sticky |= *cp != '0';
+	}
 	cp++;
-	if (n) {
+	if (n1 || n2) {
 	  c++;
 	}
       }
@@ -6061,125 +12074,468 @@ fast_strtof (const char *str, char **endptr)
 	exp += tmp;
       }
     }
-    if (endptr) {
-      *endptr = cp;
-    }
-    /* sets ERANGE and returns HUGE_VAL on error */
-    return ldexpf (n, exp) * (sign ? -1.0 : 1.0);
-  }
-  if (!isdigit (*cp) && (*cp != DECIMAL_POINT || !isdigit (cp[1]))) {
-    if (endptr) {
-      *endptr = (char *) str;
-    }
-    return 0.0;
   }
-  n = 0;
-  exp = 0;
-  c = 0;
-  while (isdigit (*cp)) {
-    if (c < 19) {
-      n = n * 10 + (*cp - '0');
-    }
-    else {
-      exp++;
+  else {
+    if (!isdigit (*cp) && (*cp != DECIMAL_POINT || !isdigit (cp[1]))) {
+      if (endptr) {
+	*endptr = (char *) str;
+      }
+      return 0.0L;
     }
-    cp++;
-    if (n) {
-      c++;
+    n1 = 0;
+    n2 = 0;
+    exp = 0;
+    c = 0;
+    while (c < 19 && isdigit (*cp)) {
+      n2 = n2 * 10 + (*cp - '0');
+      cp++;
+      if (n2) {
+	c++;
+      }
     }
-  }
-  if (*cp == DECIMAL_POINT) {
-    cp++;
     while (isdigit (*cp)) {
-      if (c < 19) {
-	n = n * 10 + (*cp - '0');
-	exp--;
+      if (c < 38) {
+	mul_10_add (&n1, &n2, *cp - '0');
+      }
+      else {
+	exp++;
       }
       cp++;
-      if (n) {
+      if (n1 || n2) {
 	c++;
       }
     }
-  }
-  if (*cp == 'e' || *cp == 'E') {
-    cp++;
-    if (*cp == '+') {
+    if (*cp == DECIMAL_POINT) {
       cp++;
+      while (c < 19 && isdigit (*cp)) {
+	n2 = n2 * 10 + (*cp - '0');
+	exp--;
+	cp++;
+	if (n2) {
+	  c++;
+	}
+      }
+      while (isdigit (*cp)) {
+	if (c < 38) {
+	  mul_10_add (&n1, &n2, *cp - '0');
+	  exp--;
+	}
+	cp++;
+	if (n1 || n2) {
+	  c++;
+	}
+      }
     }
-    else if (*cp == '-') {
-      esign = 1;
-      cp++;
+    if (UNLIKELY (c > 38)) {
+      STAT_INC (truncated);
     }
-    tmp = 0;
-    c = 0;
-    while (isdigit (*cp)) {
-      if (c < 5) {
-	tmp = tmp * 10 + (*cp - '0');
-      }
+    if (*cp == 'e' || *cp == 'E') {
       cp++;
-      if (tmp) {
-	c++;
+      if (*cp == '+') {
+	cp++;
+      }
+      else if (*cp == '-') {
+	esign = 1;
+	cp++;
+      }
+      tmp = 0;
+      c = 0;
+      while (isdigit (*cp)) {
+	if (c < 5) {
+	  tmp = tmp * 10 + (*cp - '0');
+	}
+	cp++;
+	if (tmp) {
+	  c++;
+	}
+      }
+      if (esign) {
+	exp -= tmp;
+      }
+      else {
+	exp += tmp;
       }
     }
-    if (esign) {
-      exp -= tmp;
+  }
+  if (endptr) {
+    *endptr = cp;
+  }
+  if ((n1 | n2) == 0 || (!hex && exp < -4951 - 38)) {
+    return 0.0L * (sign ? -1.0L : 1.0L);
+  }
+  if (!hex && exp > 4932) {
+    /* sets ERANGE and returns HUGE_VALL */
+    return ldexpl (1.0L, 16384) * (sign ? -1.0L : 1.0L);
+  }
+
+  n = ((unsigned __int128) n1 << 64) | n2;
+  tmp = n1 ? __builtin_clzll (n1) : 64 + __builtin_clzll (n2);
+  if (hex) {
+    /* value is p * 2^exp exactly */
+    p = n << tmp;
+    exp -= tmp;
+  }
+  else {
+    p = mul_128 (n << tmp, ldpow10 (exp, &t));
+    /* value is p * 2^exp with msb of p set */
+    exp = t + 128 - tmp;
+    if ((p >> 127) == 0) {
+      p <<= 1;
+      exp--;
+    }
+  }
+  if (hex && exp + 127 > 16383) {
+    /* sets ERANGE and returns HUGE_VALL */
+    return ldexpl (1.0L, 16384) * (sign ? -1.0L : 1.0L);
+  }
+  drop = 64;
+  if (exp + 127 < -16382) {
+    drop += -16382 - (exp + 127);
+    if (drop > 128) {
+      return 0.0L * (sign ? -1.0L : 1.0L);
+    }
+  }
+  q = drop < 128 ? (uint64_t) (p >> drop) : 0;
+  rem = drop < 128 ? p & (((unsigned __int128) 1 << drop) - 1) : p;
+  half = (unsigned __int128) 1 << (drop - 1);
+  rem |= sticky;
+  if (UNLIKELY (!hex &&
+		rem - half + (UINT64_C (1) << 40) < (UINT64_C (1) << 41))) {
+    /* too close to halfway for the error in the power of 10 */
+    c = strtold_dir (str, q, exp + (int) drop - 1);
+    rem = half + (c > 0 || (c == 0 && (q & 1)));
+  }
+  exp += drop + 63 + 16383;
+  if (rem > half || (rem == half && (q & 1))) {
+    q++;
+    if (q == 0) {
+      q = UINT64_C (0x8000000000000000);
+      exp++;
+    }
+  }
+  if (UNLIKELY (exp >= 0x7FFF)) {
+    /* sets ERANGE and returns HUGE_VALL */
+    return ldexpl (1.0L, 16384) * (sign ? -1.0L : 1.0L);
+  }
+  tl.p.m = q;
+  tl.p.se = (sign << 15) | ((q >> 63) ? exp : 0);
+  return tl.ld;
+}
+#else
+
+/** \brief fast_ldtoa
+ * 
+ * \b Description
+ *
+ * Convert long double to ascii.
+ * Without x87 long double or 128 bit integers this uses sprintf.
+ *
+ * \param v long double value
+ * \param size precision
+ * \param line pointer to result
+ * \returns lenght string
+ */
+
+unsigned int
+fast_ldtoa (long double v, int size, char *line)
+{
+  if (size <= 0) {
+    size = PREC_LDBL_NR;
+  }
+  return (unsigned int) sprintf (line, "%.*Lg", size, v);
+}
+
+/** \brief fast_strtold
+ * 
+ * \b Description
+ *
+ * Convert string to long double.
+ * Without x87 long double or 128 bit integers this uses strtold.
+ *
+ * \param str string to convert
+ * \param endptr optional endptr
+ * \returns converted long double value
+ */
+
+long double
+fast_strtold (const char *str, char **endptr)
+{
+  return strtold (str, endptr);
+}
+#endif
+
+#ifdef FLOAT128
+/** \brief mul_192
+ * 
+ * \b Description
+ *
+ * Multiply two 192 bit numbers (least significant limb first) and
+ * return high 192 bits. The low part is truncated.
+ *
+ * \param a first number
+ * \param b second number
+ * \param r high part of a * b
+ */
+
+static ALWAYS_INLINE void
+mul_192 (const uint64_t * a, const uint64_t * b, uint64_t * r)
+{
+  uint64_t p[6];
+  unsigned int i;
+  unsigned int j;
+
+  p[0] = p[1] = p[2] = 0;
+  for (i = 0; i < 3; i++) {
+    uint64_t carry = 0;
+
+    for (j = 0; j < 3; j++) {
+      unsigned __int128 t = (unsigned __int128) a[i] * b[j] + p[i + j] +
+	carry;
+
+      p[i + j] = (uint64_t) t;
+      carry = (uint64_t) (t >> 64);
+    }
+    p[i + 3] = carry;
+  }
+  r[0] = p[3];
+  r[1] = p[4];
+  r[2] = p[5];
+}
+
+/** \brief qpow10
+ * 
+ * \b Description
+ *
+ * Get 10^k as 192 bit mantissa (msb set, least significant limb first)
+ * and binary exponent from qpowers10 * qpowers10_28.
+ *
+ * \param k power of 10 (-5012 <= k <= 5039)
+ * \param t returns mantissa
+ * \returns binary exponent
+ */
+
+static ALWAYS_INLINE int
+qpow10 (int k, uint64_t * t)
+{
+  unsigned int j = (unsigned int) (k + 179 * 28) / 28;
+  unsigned int i = (unsigned int) (k + 179 * 28) % 28;
+  int exp = qpowers10[j].exp;
+
+  t[0] = qpowers10[j].mul3;
+  t[1] = qpowers10[j].mul2;
+  t[2] = qpowers10[j].mul1;
+  if (i) {
+    uint64_t s[3];
+
+    s[0] = qpowers10_28[i].mul3;
+    s[1] = qpowers10_28[i].mul2;
+    s[2] = qpowers10_28[i].mul1;
+    mul_192 (t, s, t);
+    exp += qpowers10_28[i].exp + 192;
+    if ((t[2] >> 63) == 0) {
+      t[2] = (t[2] << 1) | (t[1] >> 63);
+      t[1] = (t[1] << 1) | (t[0] >> 63);
+      t[0] <<= 1;
+      exp--;
+    }
+  }
+  return exp;
+}
+
+/** \brief exact_qtoa
+ * 
+ * \b Description
+ *
+ * Convert m * 2^e exactly to ascii
+ *
+ * \param m non zero mantissa
+ * \param e binary exponent
+ * \param size precision
+ * \param s pointer to result
+ * \returns lenght string
+ */
+
+static unsigned int
+exact_qtoa (unsigned __int128 m, int e, int size, char *s)
+{
+  uint32_t big[EXACT_LDBL_LIMBS];
+  char digits[EXACT_LDBL_DIGITS];
+
+  return exact_convert ((uint64_t) (m >> 64), (uint64_t) m, e, size, big,
+			digits, s);
+}
+
+/** \brief fast_qtoa
+ * 
+ * \b Description
+ *
+ * Convert __float128 to ascii
+ *
+ * \param v __float128 value
+ * \param size precision
+ * \param line pointer to result
+ * \returns lenght string
+ */
+
+unsigned int
+fast_qtoa (__float128 v, int size, char *line)
+{
+  union
+  {
+    unsigned __int128 u;
+    __float128 q;
+  } tq;
+  char *s = line;
+  char digits[40];
+  unsigned __int128 m;
+  unsigned __int128 n;
+  unsigned __int128 hi;
+  unsigned __int128 lo;
+  uint64_t a[3];
+  uint64_t p[3];
+  uint64_t f;
+  unsigned int sh;
+  int e;
+  int x;
+  int t;
+
+  tq.q = v;
+  if (size <= 0) {
+    size = PREC_FLT128_NR;
+  }
+  if (tq.u >> 127) {
+    *s++ = '-';
+  }
+  e = (int) (tq.u >> 112) & 0x7FFF;
+  m = tq.u & (((unsigned __int128) 1 << 112) - 1);
+  if (UNLIKELY (e == 0x7FFF)) {
+    STAT_INC (inf_nan);
+    memcpy (s, m ? "nan" : "inf", 4);
+    return s + 3 - line;
+  }
+  if (e) {
+    m |= (unsigned __int128) 1 << 112;
+  }
+  else if (m == 0) {
+    *s++ = '0';
+    *s = '\0';
+    return s - line;
+  }
+  e = (e ? e : 1) - 16383 - 112;
+  if (UNLIKELY (size > PREC_FLT128_NR)) {
+    return s + exact_qtoa (m, e, size, s) - line;
+  }
+  sh = (uint64_t) (m >> 64) ? __builtin_clzll ((uint64_t) (m >> 64)) :
+    64 + __builtin_clzll ((uint64_t) m);
+  m <<= sh;
+  e -= (int) sh;
+  a[0] = 0;
+  a[1] = (uint64_t) m;
+  a[2] = (uint64_t) (m >> 64);
+
+  /* n = m * 2^e * 10^(size - 1 - x) must have size digits */
+  lo = (unsigned __int128) ipowers64[size > 20 ? 19 : size - 1] *
+    ipowers64[size > 20 ? size - 20 : 0];
+  hi = (unsigned __int128) ipowers64[size > 19 ? 19 : size] *
+    ipowers64[size > 19 ? size - 19 : 0];
+  x = ((e + 127) * 78913) >> 18;	/* (e + 127) * log10 (2) */
+  for (;;) {
+    t = qpow10 (size - 1 - x, p);
+    mul_192 (a, p, p);
+    /* value is p * 2^(e + t + 128) */
+    sh = (unsigned int) -(e + t + 128) - 64;
+    n = sh < 128 ? (((unsigned __int128) p[2] << 64) | p[1]) >> sh : 0;
+    if (n >= hi) {
+      x++;
+    }
+    else if (n < lo) {
+      x--;
     }
     else {
-      exp += tmp;
+      break;
     }
   }
-  if (endptr) {
-    *endptr = cp;
+  if (sh >= 64) {
+    f = (uint64_t) ((((unsigned __int128) p[2] << 64) | p[1]) >> (sh - 64));
+  }
+  else {
+    f = (p[1] << (64 - sh)) | (p[0] >> sh);
+  }
+  if (UNLIKELY (f - (UINT64_C (1) << 63) + (UINT64_C (1) << 24) <
+		(UINT64_C (1) << 25))) {
+    /* too close to halfway for the error in the power of 10 */
+    return s + exact_qtoa (m, e, size, s) - line;
   }
-  if (n && (exp >= -64 && exp <= 39)) {
-#ifdef WIN
-    unsigned int s = __builtin_clzll (n);
-#else
-#ifdef __GNUC__
-#if __WORDSIZE == 64
-    unsigned int s = __builtin_clzl (n);
-#else
-    unsigned int s = __builtin_clzll (n);
-#endif
-#else
-    unsigned int s = calc_clz64 (n);
-#endif
-#endif
-
-    /* sets ERANGE and returns HUGE_VAL on error */
-    return ldexpf (mul_64 (n << s, fpowers10[exp + 64].mul) + 5,
-		   fpowers10[exp + 64].exp + 32 - s) * (sign ? -1.0 : 1.0);
+  n += f > (UINT64_C (1) << 63);
+  if (n == hi) {
+    n = lo;
+    x++;
   }
-  return 0.0 * (sign ? -1.0 : 1.0);
+  return s + exact_format (digits, fast_uint128 (n, digits), x, size, s) -
+    line;
 }
 
-/** \brief fast_strtod
+/** \brief strtoq_dir
  * 
  * \b Description
  *
- * Convert string to double
+ * Compare decimal string exactly with halfway point (2 * q + 1) * 2^e
+ *
+ * \param str string that was converted
+ * \param q lower result
+ * \param e binary exponent of halfway point
+ * \returns -1, 0 or 1 when string is below, equal or above halfway point
+ */
+
+static int
+strtoq_dir (const char *str, unsigned __int128 q, int e)
+{
+  uint32_t big[EXACT_LDBL_LIMBS];
+  char digits[EXACT_LDBL_DIGITS];
+
+  q = (q << 1) | 1;
+  return decimal_dir (str, (uint64_t) (q >> 64), (uint64_t) q, e, big,
+		      digits);
+}
+
+/** \brief fast_strtoq
+ * 
+ * \b Description
+ *
+ * Convert string to __float128
  *
  * \param str string to convert
  * \param endptr optional endptr
- * \returns converted double value
+ * \returns converted __float128 value
  */
 
-double
-fast_strtod (const char *str, char **endptr)
+__float128
+fast_strtoq (const char *str, char **endptr)
 {
   char *cp = (char *) str;
   int sign = 0;
   int esign = 0;
+  int hex = 0;
+  int sticky = 0;
+  int up;
   int exp;
   int tmp;
   int c;
+  unsigned int drop;
+  unsigned int k;
   uint64_t n1;
   uint64_t n2;
+  uint64_t p[3];
+  uint64_t rtop;
+  uint64_t margin;
+  unsigned __int128 q;
+  unsigned __int128 rest;
+  unsigned __int128 h;
   union
   {
-    uint64_t u;
-    double d;
-  } td;
+    unsigned __int128 u;
+    __float128 q;
+  } tq;
 
   while (isspace (*cp)) {
     cp++;
@@ -6191,8 +12547,10 @@ fast_strtod (const char *str, char **endptr)
     sign = 1;
     cp++;
   }
+  tq.u = (unsigned __int128) sign << 127;
   if (*cp == 'n' || *cp == 'N') {
     if (strncasecmp (cp, "nan", 3) == 0) {
+      STAT_INC (inf_nan);
       cp += strlen ("nan");
       if (endptr) {
 	*endptr = cp;
@@ -6208,17 +12566,17 @@ fast_strtod (const char *str, char **endptr)
 	  }
 	}
       }
-      td.u =
-	sign ? UINT64_C (0xFFF8000000000000) : UINT64_C (0x7FF8000000000000);
-      return td.d;
+      tq.u |= (unsigned __int128) 0xFFFF << 111;
+      return tq.q;
     }
     if (endptr) {
       *endptr = (char *) str;
     }
-    return 0.0;
+    return 0;
   }
   if (*cp == 'i' || *cp == 'I') {
     if (strncasecmp (cp, "inf", 3) == 0) {
+      STAT_INC (inf_nan);
       cp += strlen ("inf");
       if (strncasecmp (cp, "inity", strlen ("inity")) == 0) {
 	cp += strlen ("inity");
@@ -6226,47 +12584,56 @@ fast_strtod (const char *str, char **endptr)
       if (endptr) {
 	*endptr = cp;
       }
-      td.u =
-	sign ? UINT64_C (0xFFF0000000000000) : UINT64_C (0x7FF0000000000000);
-      return td.d;
+      tq.u |= (unsigned __int128) 0x7FFF << 112;
+      return tq.q;
     }
     if (endptr) {
       *endptr = (char *) str;
     }
-    return 0.0;
+    return 0;
   }
+  n1 = 0;
+  n2 = 0;
+  exp = 0;
+  c = 0;
   if (*cp == '0' && (cp[1] == 'x' || cp[1] == 'X')) {
     if (!isxdigit (cp[2]) && (cp[2] != DECIMAL_POINT || !isxdigit (cp[3]))) {
       if (endptr) {
 	*endptr = &cp[1];
       }
-      return 0.0 * (sign ? -1.0 : 1.0);
+      return tq.q;
     }
+    STAT_INC (hex_float);
+    hex = 1;
     cp += 2;
-    n1 = 0;
-    exp = 0;
-    c = 0;
+    /* 32 hex digits in n1:n2, sticky is set for ignored non zero digits */
     while (isxdigit (*cp)) {
-      if (c < 16) {
-	n1 = n1 * 16 + convert_num[*cp & 0xFFu];
+      if (c < 32) {
+	n1 = (n1 << 4) | (n2 >> 60);
+	n2 = (n2 << 4) | convert_num[*cp & 0xFFu];
       }
       else {
 	exp += 4;
+	sticky |= *cp != '0';
       }
       cp++;
-      if (n1) {
+      if (n1 || n2) {
 	c++;
       }
     }
     if (*cp == DECIMAL_POINT) {
       cp++;
       while (isxdigit (*cp)) {
-	if (c < 16) {
-	  n1 = n1 * 16 + convert_num[*cp & 0xFFu];
+	if (c < 32) {
+	  n1 = (n1 << 4) | (n2 >> 60);
+	  n2 = (n2 << 4) | convert_num[*cp & 0xFFu];
 	  exp -= 4;
 	}
+	else {
+	  sticky |= *cp != '0';
+	}
 	cp++;
-	if (n1) {
+	if (n1 || n2) {
 	  c++;
 	}
       }
@@ -6281,14 +12648,14 @@ fast_strtod (const char *str, char **endptr)
 	cp++;
       }
       tmp = 0;
-      c = 0;
+      k = 0;
       while (isdigit (*cp)) {
-	if (c < 5) {
+	if (k < 5) {
 	  tmp = tmp * 10 + (*cp - '0');
 	}
 	cp++;
 	if (tmp) {
-	  c++;
+	  k++;
 	}
       }
       if (esign) {
@@ -6298,46 +12665,16 @@ fast_strtod (const char *str, char **endptr)
 	exp += tmp;
       }
     }
-    if (endptr) {
-      *endptr = cp;
-    }
-    /* sets ERANGE and returns HUGE_VAL on error */
-    return ldexp (n1, exp) * (sign ? -1.0 : 1.0);
-  }
-  if (!isdigit (*cp) && (*cp != DECIMAL_POINT || !isdigit (cp[1]))) {
-    if (endptr) {
-      *endptr = (char *) str;
-    }
-    return 0.0;
-  }
-  n1 = 0;
-  n2 = 0;
-  exp = 0;
-  c = 0;
-  while (c < 19 && isdigit (*cp)) {
-    n2 = n2 * 10 + (*cp - '0');
-    cp++;
-    if (n2) {
-      c++;
-    }
   }
-  while (isdigit (*cp)) {
-    if (c < 38) {
-      mul_10_add (&n1, &n2, *cp - '0');
-    }
-    else {
-      exp++;
-    }
-    cp++;
-    if (n1 || n2) {
-      c++;
+  else {
+    if (!isdigit (*cp) && (*cp != DECIMAL_POINT || !isdigit (cp[1]))) {
+      if (endptr) {
+	*endptr = (char *) str;
+      }
+      return 0;
     }
-  }
-  if (*cp == DECIMAL_POINT) {
-    cp++;
     while (c < 19 && isdigit (*cp)) {
       n2 = n2 * 10 + (*cp - '0');
-      exp--;
       cp++;
       if (n2) {
 	c++;
@@ -6346,87 +12683,280 @@ fast_strtod (const char *str, char **endptr)
     while (isdigit (*cp)) {
       if (c < 38) {
 	mul_10_add (&n1, &n2, *cp - '0');
-	exp--;
+      }
+      else {
+	exp++;
       }
       cp++;
       if (n1 || n2) {
 	c++;
       }
     }
-  }
-  if (*cp == 'e' || *cp == 'E') {
-    cp++;
-    if (*cp == '+') {
+    if (*cp == DECIMAL_POINT) {
       cp++;
+      while (c < 19 && isdigit (*cp)) {
+	n2 = n2 * 10 + (*cp - '0');
+	exp--;
+	cp++;
+	if (n2) {
+	  c++;
+	}
+      }
+      while (isdigit (*cp)) {
+	if (c < 38) {
+	  mul_10_add (&n1, &n2, *cp - '0');
+	  exp--;
+	}
+	cp++;
+	if (n1 || n2) {
+	  c++;
+	}
+      }
     }
-    else if (*cp == '-') {
-      esign = 1;
-      cp++;
+    if (UNLIKELY (c > 38)) {
+      STAT_INC (truncated);
     }
-    tmp = 0;
-    c = 0;
-    while (isdigit (*cp)) {
-      if (c < 5) {
-	tmp = tmp * 10 + (*cp - '0');
-      }
+    if (*cp == 'e' || *cp == 'E') {
       cp++;
-      if (tmp) {
-	c++;
+      if (*cp == '+') {
+	cp++;
+      }
+      else if (*cp == '-') {
+	esign = 1;
+	cp++;
+      }
+      tmp = 0;
+      k = 0;
+      while (isdigit (*cp)) {
+	if (k < 5) {
+	  tmp = tmp * 10 + (*cp - '0');
+	}
+	cp++;
+	if (tmp) {
+	  k++;
+	}
+      }
+      if (esign) {
+	exp -= tmp;
+      }
+      else {
+	exp += tmp;
       }
     }
-    if (esign) {
-      exp -= tmp;
+  }
+  if (endptr) {
+    *endptr = cp;
+  }
+  if ((n1 | n2) == 0) {
+    return tq.q;
+  }
+
+  tmp = n1 ? __builtin_clzll (n1) : 64 + __builtin_clzll (n2);
+  q = (((unsigned __int128) n1 << 64) | n2) << tmp;
+  p[0] = 0;
+  p[1] = (uint64_t) q;
+  p[2] = (uint64_t) (q >> 64);
+  if (hex) {
+    /* value is p * 2^exp exactly */
+    exp -= tmp + 64;
+    margin = 0;
+  }
+  else {
+    uint64_t t[3];
+
+    if (exp < -4966 - 38 - 1) {
+      return tq.q;
+    }
+    if (exp > 4932) {
+      exp = 20000;
     }
     else {
-      exp += tmp;
+      exp = qpow10 (exp, t) + 128 - tmp;
+      mul_192 (p, t, p);
+      if ((p[2] >> 63) == 0) {
+	p[2] = (p[2] << 1) | (p[1] >> 63);
+	p[1] = (p[1] << 1) | (p[0] >> 63);
+	p[0] <<= 1;
+	exp--;
+      }
     }
+    /* error in p is below 2^-183, ignored digits up to 2^-122 */
+    margin = c > 38 ? UINT64_C (1) << 56 : 2;
   }
-  if (endptr) {
-    *endptr = cp;
+  /* value is p * 2^exp, round to 113 bits (less for subnormals) */
+  drop = 192 - 113;
+  if (exp + 191 < -16382) {
+    if (exp + 191 < -16382 - 113) {
+      /* below half of smallest subnormal */
+      return tq.q;
+    }
+    drop += -16382 - (exp + 191);
   }
-  c = 64;
-  if (n1 == 0) {
-    n1 = n2;
-    n2 = 0;
-    c = 0;
+  if (exp + 191 > 16383) {
+    errno = ERANGE;
+    tq.u |= (unsigned __int128) 0x7FFF << 112;
+    return tq.q;
   }
-  if (n1 && (exp >= -362 && exp <= 309)) {
-#ifdef WIN
-    unsigned int s = __builtin_clzll (n1);
-#else
-#ifdef __GNUC__
-#if __WORDSIZE == 64
-    unsigned int s = __builtin_clzl (n1);
-#else
-    unsigned int s = __builtin_clzll (n1);
+  h = ((unsigned __int128) p[2] << 64) | p[1];
+  k = drop - 64;
+  q = k < 128 ? h >> k : 0;
+  if (k >= 64) {
+    rtop = (uint64_t) (h >> (k - 64));
+    rest = (h & (((unsigned __int128) 1 << (k - 64)) - 1)) | p[0] | sticky;
+  }
+  else {
+    rtop = (uint64_t) (h << (64 - k)) | (p[0] >> k);
+    rest = (p[0] & ((UINT64_C (1) << k) - 1)) | sticky;
+  }
+  up = rtop > (UINT64_C (1) << 63) ||
+    (rtop == (UINT64_C (1) << 63) && (rest || (q & 1)));
+  if (UNLIKELY (margin &&
+		rtop - (UINT64_C (1) << 63) + margin <= 2 * margin)) {
+    /* too close to halfway for the error in the power of 10 */
+    tmp = strtoq_dir (str, q, exp + (int) drop - 1);
+    up = tmp > 0 || (tmp == 0 && (q & 1));
+  }
+  /* a carry out of q (also from subnormal to normal) goes to exponent */
+  q += up;
+  q += (unsigned __int128) (exp + drop + 16383 + 112 - 1) << 112;
+  if (UNLIKELY ((q >> 112) >= 0x7FFF)) {
+    errno = ERANGE;
+    q = (unsigned __int128) 0x7FFF << 112;
+  }
+  tq.u |= q;
+  return tq.q;
+}
 #endif
+
+/** \brief fast_convert_stats_get
+ * 
+ * \b Description
+ *
+ * Get slow path counters of all threads
+ *
+ * \param stats Pointer to result
+ */
+
+void
+fast_convert_stats_get (struct fast_convert_stats *stats)
+{
+#ifdef FAST_CONVERT_STATS
+  struct stats_thread *t;
+
+  pthread_mutex_lock (&stats_lock);
+  *stats = stats_retired;
+  for (t = stats_list.next; t != &stats_list; t = t->next) {
+    stats_add (stats, &t->s);
+  }
+  pthread_mutex_unlock (&stats_lock);
 #else
-    unsigned int s = calc_clz64 (n1);
+  memset (stats, 0, sizeof (*stats));
 #endif
+}
+
+/** \brief fast_convert_stats_reset
+ * 
+ * \b Description
+ *
+ * Clear slow path counters of all threads
+ */
+
+void
+fast_convert_stats_reset (void)
+{
+#ifdef FAST_CONVERT_STATS
+  struct stats_thread *t;
+
+  pthread_mutex_lock (&stats_lock);
+  memset (&stats_retired, 0, sizeof (stats_retired));
+  for (t = stats_list.next; t != &stats_list; t = t->next) {
+    memset (&t->s, 0, sizeof (t->s));
+  }
+  pthread_mutex_unlock (&stats_lock);
 #endif
+}
 
-    n1 = (n1 << s) | (n2 >> (64 - s));
-    n2 <<= s;
+/** \brief fast_convert_tables_size
+ * 
+ * \b Description
+ *
+ * Size of a copy of the conversion tables
+ *
+ * \returns size in bytes, 0 without FAST_CONVERT_NUMA_TABLES
+ */
 
-    uint32_t lo;
-    uint64_t r = mul_96 (n1, dpowers10[exp + 362].mul1,
-			 dpowers10[exp + 362].mul2 + 1, &lo);
+size_t
+fast_convert_tables_size (void)
+{
+#ifdef FAST_CONVERT_NUMA_TABLES
+  return sizeof (dpowers2) + sizeof (dpowers10) + sizeof (fpowers2) +
+    sizeof (fpowers10) + sizeof (num3);
+#else
+  return 0;
+#endif
+}
 
-    if (n2) {
-      uint32_t lo2;
-      uint64_t l = mul_96 (n2, dpowers10[exp + 362].mul1,
-			   dpowers10[exp + 362].mul2 + 1, &lo2) >> 32;
-      lo += l;
-      if (lo < l) {
-	r++;
-	if (r == 0) {
-	  r--;
-	}
-      }
-    }
+/** \brief fast_convert_tables_copy
+ * 
+ * \b Description
+ *
+ * Copy the conversion tables to mem
+ *
+ * \param mem memory of fast_convert_tables_size bytes
+ */
 
-    return ldexp (r, dpowers10[exp + 362].exp + 64 - s + c) *
-      (sign ? -1.0 : 1.0);
+void
+fast_convert_tables_copy (void *mem)
+{
+#ifdef FAST_CONVERT_NUMA_TABLES
+  char *p = (char *) mem;
+
+  p = (char *) memcpy (p, dpowers2, sizeof (dpowers2)) + sizeof (dpowers2);
+  p = (char *) memcpy (p, dpowers10, sizeof (dpowers10)) +
+    sizeof (dpowers10);
+  p = (char *) memcpy (p, fpowers2, sizeof (fpowers2)) + sizeof (fpowers2);
+  p = (char *) memcpy (p, fpowers10, sizeof (fpowers10)) +
+    sizeof (fpowers10);
+  memcpy (p, num3, sizeof (num3));
+#else
+  (void) mem;
+#endif
+}
+
+/** \brief fast_convert_tables_use
+ * 
+ * \b Description
+ *
+ * Let the calling thread use a copy of the conversion tables
+ *
+ * \param mem copy made by fast_convert_tables_copy, NULL for the
+ * built in tables
+ */
+
+void
+fast_convert_tables_use (const void *mem)
+{
+#ifdef FAST_CONVERT_NUMA_TABLES
+  const char *p = (const char *) mem;
+
+  if (p == NULL) {
+    tls_dpowers2 = dpowers2;
+    tls_dpowers10 = dpowers10;
+    tls_fpowers2 = fpowers2;
+    tls_fpowers10 = fpowers10;
+    tls_num3 = num3;
+    return;
   }
-  return 0.0 * (sign ? -1.0 : 1.0);
+  tls_dpowers2 = (const struct dpower *) p;
+  p += sizeof (dpowers2);
+  tls_dpowers10 = (const struct dpower *) p;
+  p += sizeof (dpowers10);
+  tls_fpowers2 = (const struct fpower *) p;
+  p += sizeof (fpowers2);
+  tls_fpowers10 = (const struct fpower *) p;
+  p += sizeof (fpowers10);
+  tls_num3 = p;
+#else
+  (void) mem;
+#endif
 }
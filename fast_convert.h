@@ -11,6 +11,7 @@
 #define __FAST_STDIO_H
 
 #include <inttypes.h>
+#include <stddef.h>
 
 #if defined (__cplusplus)
 extern "C"
@@ -22,6 +23,12 @@ extern "C"
 #define PREC_DBL_NR	17
 #define PREC_FLT	"9"
 #define PREC_DBL	"17"
+#define PREC_LDBL_NR	21
+#define PREC_LDBL	"21"
+#define PREC_FLT128_NR	36
+#define PREC_FLT128	"36"
+#define PREC_HALF_NR	5
+#define PREC_BF16_NR	4
 
 /** \brief fast_sint32
  * 
@@ -131,6 +138,62 @@ extern "C"
   extern unsigned int fast_base_uint64 (uint64_t v, char *str, int base,
 					int upper);
 
+#ifdef __SIZEOF_INT128__
+/** \brief fast_sint128
+ * 
+ * \b Description
+ *
+ * Convert signed 128 bit integer to string
+ *
+ * \param v 128 bit integer
+ * \param str Buffer to print to (at least 41 bytes)
+ * \returns lenght string
+ */
+  extern unsigned int fast_sint128 (__int128 v, char *str);
+
+/** \brief fast_uint128
+ * 
+ * \b Description
+ *
+ * Convert unsigned 128 bit integer to string
+ *
+ * \param v 128 bit integer
+ * \param str Buffer to print to (at least 40 bytes)
+ * \returns lenght string
+ */
+  extern unsigned int fast_uint128 (unsigned __int128 v, char *str);
+
+/** \brief fast_base_sint128
+ * 
+ * \b Description
+ *
+ * Convert signed 128 bit integer to string with base and upper case
+ *
+ * \param v 128 bit integer
+ * \param str Buffer to print to (at least 130 bytes)
+ * \param base Base to use
+ * \param upper Use uppecase
+ * \returns lenght string
+ */
+  extern unsigned int fast_base_sint128 (__int128 v, char *str, int base,
+					 int upper);
+
+/** \brief fast_base_uint128
+ * 
+ * \b Description
+ *
+ * Convert unsigned 128 bit integer to string with base and upper case
+ *
+ * \param v 128 bit integer
+ * \param str Buffer to print to (at least 129 bytes)
+ * \param base Base to use
+ * \param upper Use uppecase
+ * \returns lenght string
+ */
+  extern unsigned int fast_base_uint128 (unsigned __int128 v, char *str,
+					 int base, int upper);
+#endif
+
 /** \brief fast_strtos32
  * 
  * \b Description
@@ -183,11 +246,152 @@ extern "C"
  */
   extern uint64_t fast_strtou64 (const char *str, char **endptr, int base);
 
+/** \brief fast_convert_status
+ * 
+ * \b Description
+ *
+ * Reason the fast_strto*_status functions stopped parsing.
+ */
+  enum fast_convert_status
+  {
+    FAST_CONVERT_OK,		/**< whole string converted */
+    FAST_CONVERT_OVERFLOW,	/**< endptr points to overflowing digit */
+    FAST_CONVERT_NO_DIGITS,	/**< no number found, endptr is str */
+    FAST_CONVERT_TRAILING	/**< number followed by other characters */
+  };
+
+/** \brief fast_strtos32_status
+ * 
+ * \b Description
+ *
+ * Convert string to signed integer
+ * The status tells why parsing stopped. errno is never changed.
+ *
+ * \param str String to convert from
+ * \param endptr optional endptr
+ * \param base base of converting.
+ * \param status returns FAST_CONVERT_OK, OVERFLOW, NO_DIGITS or TRAILING
+ * \returns converted string
+ */
+  extern int32_t fast_strtos32_status (const char *str, char **endptr,
+				       int base, enum fast_convert_status *status);
+
+/** \brief fast_strtos64_status
+ * 
+ * \b Description
+ *
+ * Convert string to signed long
+ * The status tells why parsing stopped. errno is never changed.
+ *
+ * \param str String to convert from
+ * \param endptr optional endptr
+ * \param base base of converting.
+ * \param status returns FAST_CONVERT_OK, OVERFLOW, NO_DIGITS or TRAILING
+ * \returns converted string
+ */
+  extern int64_t fast_strtos64_status (const char *str, char **endptr,
+				       int base, enum fast_convert_status *status);
+
+/** \brief fast_strtou32_status
+ * 
+ * \b Description
+ *
+ * Convert string to unsigned int
+ * The status tells why parsing stopped. errno is never changed.
+ *
+ * \param str String to convert from
+ * \param endptr optional endptr
+ * \param base base of converting.
+ * \param status returns FAST_CONVERT_OK, OVERFLOW, NO_DIGITS or TRAILING
+ * \returns converted string
+ */
+  extern uint32_t fast_strtou32_status (const char *str, char **endptr,
+					int base, enum fast_convert_status *status);
+
+/** \brief fast_strtou64_status
+ * 
+ * \b Description
+ *
+ * Convert string to unsigned long
+ * The status tells why parsing stopped. errno is never changed.
+ *
+ * \param str String to convert from
+ * \param endptr optional endptr
+ * \param base base of converting.
+ * \param status returns FAST_CONVERT_OK, OVERFLOW, NO_DIGITS or TRAILING
+ * \returns converted string
+ */
+  extern uint64_t fast_strtou64_status (const char *str, char **endptr,
+					int base, enum fast_convert_status *status);
+
+#ifdef __SIZEOF_INT128__
+/** \brief fast_strtos128
+ * 
+ * \b Description
+ *
+ * Convert string to signed 128 bit integer
+ *
+ * \param str String to convert from
+ * \param endptr optional endptr
+ * \param base base of converting.
+ * \returns converted string
+ */
+  extern __int128 fast_strtos128 (const char *str, char **endptr, int base);
+
+/** \brief fast_strtos128_status
+ * 
+ * \b Description
+ *
+ * Convert string to signed 128 bit integer
+ * The status tells why parsing stopped. errno is never changed.
+ *
+ * \param str String to convert from
+ * \param endptr optional endptr
+ * \param base base of converting.
+ * \param status returns FAST_CONVERT_OK, OVERFLOW, NO_DIGITS or TRAILING
+ * \returns converted string
+ */
+  extern __int128 fast_strtos128_status (const char *str,
+					 char **endptr, int base,
+					 enum fast_convert_status *status);
+
+/** \brief fast_strtou128
+ * 
+ * \b Description
+ *
+ * Convert string to unsigned 128 bit integer
+ *
+ * \param str String to convert from
+ * \param endptr optional endptr
+ * \param base base of converting.
+ * \returns converted string
+ */
+  extern unsigned __int128 fast_strtou128 (const char *str, char **endptr, int base);
+
+/** \brief fast_strtou128_status
+ * 
+ * \b Description
+ *
+ * Convert string to unsigned 128 bit integer
+ * The status tells why parsing stopped. errno is never changed.
+ *
+ * \param str String to convert from
+ * \param endptr optional endptr
+ * \param base base of converting.
+ * \param status returns FAST_CONVERT_OK, OVERFLOW, NO_DIGITS or TRAILING
+ * \returns converted string
+ */
+  extern unsigned __int128 fast_strtou128_status (const char *str,
+						  char **endptr, int base,
+						  enum fast_convert_status *status);
+#endif
+
 /** \brief fast_ftoa
  * 
  * \b Description
  *
  * Convert float to ascii
+ * Precisions above PREC_FLT_NR are converted exactly via fast_dtoa.
  *
  * \param v float value
  * \param size precision
@@ -196,11 +400,25 @@ extern "C"
  */
   extern unsigned int fast_ftoa (float v, int size, char *line);
 
+/** \brief fast_ftoa_p6
+ * 
+ * \b Description
+ *
+ * Convert float to ascii with precision 6. Same result as
+ * fast_ftoa (v, 6, line) but with constant divisors.
+ *
+ * \param v float value
+ * \param line pointer to result
+ * \returns lenght string
+ */
+  extern unsigned int fast_ftoa_p6 (float v, char *line);
+
 /** \brief fast_dtoa
  * 
  * \b Description
  *
  * Convert double to ascii
+ * Precisions above PREC_DBL_NR give the exact digits (like printf).
  *
  * \param v float value
  * \param size precision
@@ -209,6 +427,32 @@ extern "C"
  */
   extern unsigned int fast_dtoa (double v, int size, char *line);
 
+/** \brief fast_dtoa_p6
+ * 
+ * \b Description
+ *
+ * Convert double to ascii with precision 6. Same result as
+ * fast_dtoa (v, 6, line) but with constant divisors.
+ *
+ * \param v double value
+ * \param line pointer to result
+ * \returns lenght string
+ */
+  extern unsigned int fast_dtoa_p6 (double v, char *line);
+
+/** \brief fast_dtoa_p15
+ * 
+ * \b Description
+ *
+ * Convert double to ascii with precision 15. Same result as
+ * fast_dtoa (v, 15, line) but with constant divisors.
+ *
+ * \param v double value
+ * \param line pointer to result
+ * \returns lenght string
+ */
+  extern unsigned int fast_dtoa_p15 (double v, char *line);
+
 /** \brief fast_strtof
  * 
  * \b Description
@@ -233,6 +477,363 @@ extern "C"
  */
   extern double fast_strtod (const char *str, char **endptr);
 
+/** \brief fast_ldtoa
+ * 
+ * \b Description
+ *
+ * Convert long double to ascii. The result is the same as sprintf "%.*Lg".
+ * Only x87 80 bit long double with 128 bit integer support has a fast
+ * implementation, other targets use sprintf.
+ *
+ * \param v long double value
+ * \param size precision
+ * \param line pointer to result
+ * \returns lenght string
+ */
+  extern unsigned int fast_ldtoa (long double v, int size, char *line);
+
+/** \brief fast_strtold
+ * 
+ * \b Description
+ *
+ * Convert string to long double. The result is the same as strtold.
+ * Only x87 80 bit long double with 128 bit integer support has a fast
+ * implementation, other targets use strtold.
+ *
+ * \param str string to convert
+ * \param endptr optional endptr
+ * \returns converted long double value
+ */
+  extern long double fast_strtold (const char *str, char **endptr);
+
+#if defined (__SIZEOF_FLOAT128__) && defined (__SIZEOF_INT128__)
+/** \brief fast_qtoa
+ * 
+ * \b Description
+ *
+ * Convert __float128 to ascii. The result is the same as
+ * quadmath_snprintf "%.*Qg".
+ *
+ * \param v __float128 value
+ * \param size precision
+ * \param line pointer to result
+ * \returns lenght string
+ */
+  extern unsigned int fast_qtoa (__float128 v, int size, char *line);
+
+/** \brief fast_strtoq
+ * 
+ * \b Description
+ *
+ * Convert string to __float128. The result is the same as strtoflt128.
+ *
+ * \param str string to convert
+ * \param endptr optional endptr
+ * \returns converted __float128 value
+ */
+  extern __float128 fast_strtoq (const char *str, char **endptr);
+#endif
+
+/** \brief fast_htoa
+ * 
+ * \b Description
+ *
+ * Convert half float (IEEE binary16) bits to the shortest ascii string
+ * that converts back to the same bits. Format is like "%g".
+ *
+ * \param v half float bits
+ * \param line pointer to result
+ * \returns lenght string
+ */
+  extern unsigned int fast_htoa (uint16_t v, char *line);
+
+/** \brief fast_bf16toa
+ * 
+ * \b Description
+ *
+ * Convert bfloat16 bits to the shortest ascii string that converts back
+ * to the same bits. Format is like "%g".
+ *
+ * \param v bfloat16 bits
+ * \param line pointer to result
+ * \returns lenght string
+ */
+  extern unsigned int fast_bf16toa (uint16_t v, char *line);
+
+/** \brief fast_strtoh
+ * 
+ * \b Description
+ *
+ * Convert string to half float (IEEE binary16) bits with correct rounding
+ *
+ * \param str string to convert
+ * \param endptr optional endptr
+ * \returns half float bits
+ */
+  extern uint16_t fast_strtoh (const char *str, char **endptr);
+
+/** \brief fast_strtobf16
+ * 
+ * \b Description
+ *
+ * Convert string to bfloat16 bits with correct rounding
+ *
+ * \param str string to convert
+ * \param endptr optional endptr
+ * \returns bfloat16 bits
+ */
+  extern uint16_t fast_strtobf16 (const char *str, char **endptr);
+
+/** \brief fast_num_parser
+ * 
+ * \b Description
+ *
+ * State of the incremental number parser. A number may be split over
+ * several fast_num_parser_feed calls. The fields are private.
+ */
+  struct fast_num_parser
+  {
+    uint64_t n1;		/**< 64 bit msb of digits */
+    uint64_t n2;		/**< 64 bit lsb of digits */
+    int exp;			/**< decimal exponent of digits */
+    int digits;			/**< number of digits */
+    int eval;			/**< exponent, inf/nan letters or payload length */
+    int edigits;		/**< number of exponent digits */
+    int state;			/**< parse state */
+    int sign;			/**< number is negative */
+    int esign;			/**< exponent is negative */
+    void (*emit) (void *arg, double v);	/**< called for each number */
+    void *arg;			/**< first argument of emit */
+    char payload[32];		/**< nan payload without closing ')' yet */
+  };
+
+/** \brief fast_num_parser_init
+ * 
+ * \b Description
+ *
+ * Init incremental number parser
+ *
+ * \param p parser state
+ * \param emit function called with each converted number
+ * \param arg first argument of emit
+ */
+  extern void fast_num_parser_init (struct fast_num_parser *p,
+				    void (*emit) (void *arg, double v),
+				    void *arg);
+
+/** \brief fast_num_parser_feed
+ * 
+ * \b Description
+ *
+ * Parse next part of input. Numbers are converted like fast_strtod
+ * and passed to emit as soon as the character after them is seen.
+ * A number at the end of str is kept in p and completed by the next
+ * call. Characters that can not start a number are skipped. Hex floats
+ * are not supported. A nan payload is only skipped when its ')' is seen,
+ * payloads longer than 32 characters are parsed as unterminated.
+ *
+ * \param p parser state
+ * \param str input
+ * \param len length of input
+ * \returns number of emitted numbers
+ */
+  extern size_t fast_num_parser_feed (struct fast_num_parser *p,
+				      const char *str, size_t len);
+
+/** \brief fast_num_parser_finish
+ * 
+ * \b Description
+ *
+ * End of input. Emit a pending number and reset the parser for
+ * new input.
+ *
+ * \param p parser state
+ * \returns number of emitted numbers
+ */
+  extern size_t fast_num_parser_finish (struct fast_num_parser *p);
+
+/** \brief fast_number_kind
+ * 
+ * \b Description
+ *
+ * Kind of number found by fast_classify_number.
+ */
+  enum fast_number_kind
+  {
+    FAST_NUMBER_INVALID,	/**< no number, len is 0 */
+    FAST_NUMBER_INT,		/**< decimal digits without point or exponent */
+    FAST_NUMBER_FLOAT,		/**< decimal number with point or exponent */
+    FAST_NUMBER_HEX,		/**< hex float (0x...) */
+    FAST_NUMBER_INF,		/**< inf or infinity */
+    FAST_NUMBER_NAN		/**< nan with optional (payload) */
+  };
+
+/** \brief fast_classify_number
+ * 
+ * \b Description
+ *
+ * Check the number at ptr without converting it. The grammar is the
+ * same as fast_strtod (leading white space, sign, locale decimal
+ * point), so len is the number of characters fast_strtod would use.
+ * Input is not read at or after end, so it does not need a trailing nul.
+ * An int kind says nothing about the range of the value.
+ *
+ * \param ptr start of input
+ * \param end end of input
+ * \param kind returns kind of number
+ * \param len returns number of characters used, 0 if invalid
+ */
+  extern void fast_classify_number (const char *ptr, const char *end,
+				    enum fast_number_kind *kind, size_t *len);
+
+/** \brief fast_column_type
+ * 
+ * \b Description
+ *
+ * Column type found by fast_infer_column_type, from narrow to wide.
+ */
+  enum fast_column_type
+  {
+    FAST_COLUMN_INT32,		/**< all values fit fast_strtos32 */
+    FAST_COLUMN_INT64,		/**< all values fit fast_strtos64 */
+    FAST_COLUMN_FLOAT,		/**< all values survive float storage */
+    FAST_COLUMN_DOUBLE,		/**< all values are numbers for fast_strtod */
+    FAST_COLUMN_STRING		/**< some value is not a number */
+  };
+
+/** \brief fast_infer_column_type
+ * 
+ * \b Description
+ *
+ * Find the narrowest type that holds all strings of a column without
+ * loss. String i is buf[offsets[i]] .. buf[offsets[i + 1] - 1], so
+ * offsets has n + 1 entries and the strings need no trailing nul.
+ * Empty strings (missing values) are skipped. The characters of a
+ * string are classified with AVX2 when the cpu has it. A float value is lossless
+ * when fast_strtof of the string, printed with the significant digits
+ * of the string, gives the same fast_strtod value (21.3 is float,
+ * 16777217 is not). Ints that do not fit int64 need double.
+ *
+ * \param buf string data
+ * \param offsets start of each string and end of the last string
+ * \param n number of strings
+ * \returns FAST_COLUMN_INT32, INT64, FLOAT, DOUBLE or STRING
+ */
+  extern enum fast_column_type fast_infer_column_type (const char *buf,
+						       const size_t * offsets,
+						       size_t n);
+
+/** \brief fast_scan_number
+ * 
+ * \b Description
+ *
+ * Number found by fast_scan_numbers.
+ */
+  struct fast_scan_number
+  {
+    size_t pos;			/**< offset of number in text */
+    size_t len;			/**< number of characters */
+    enum fast_number_kind kind;	/**< FAST_NUMBER_INT, FLOAT or HEX */
+    int64_t i;			/**< value if kind is FAST_NUMBER_INT */
+    double d;			/**< value as double */
+  };
+
+/** \brief fast_scan_numbers
+ * 
+ * \b Description
+ *
+ * Find all numbers in text (log lines for example) and convert them.
+ * Digits are searched with AVX2 when the cpu has it. A number starts
+ * at a digit, or at a decimal point or sign before it. A sign is only
+ * used when it does not follow a letter, digit or decimal point, so
+ * 2019-10-19 gives three positive numbers and x=-5 gives -5. The
+ * number is read with the fast_strtod grammar, but an exponent without
+ * digits and a decimal point at the end are left out. Ints are
+ * converted with fast_strtos64 (kind FAST_NUMBER_INT, also set in d);
+ * ints that overflow int64 and other numbers with fast_strtod.
+ * Text is not read at or after buf + len.
+ *
+ * \param buf text
+ * \param len length of text
+ * \param found called for each number with its position and value
+ * \param arg first argument of found
+ * \returns number of numbers found
+ */
+  extern size_t fast_scan_numbers (const char *buf, size_t len,
+				   void (*found) (void *arg,
+						  const struct fast_scan_number
+						  * num), void *arg);
+
+/** \brief fast_convert_stats
+ * 
+ * \b Description
+ *
+ * Slow path counters. They are only updated when fast_convert.c is
+ * compiled with FAST_CONVERT_STATS.
+ */
+  struct fast_convert_stats
+  {
+    uint64_t subnormal;		/**< subnormal fast_ftoa/fast_dtoa input */
+    uint64_t round_half;	/**< round half ties in fast_ftoa/fast_dtoa */
+    uint64_t hex_float;		/**< hex fast_strtof/fast_strtod input */
+    uint64_t inf_nan;		/**< inf/nan input or output */
+    uint64_t truncated;		/**< fast_strtof/fast_strtod digits ignored */
+    uint64_t int_overflow;	/**< integer parse stopped at overflow */
+    uint64_t integer;		/**< integer valued fast_dtoa input */
+  };
+
+/** \brief fast_convert_stats_get
+ * 
+ * \b Description
+ *
+ * Get slow path counters summed over all threads. Counters of running
+ * threads are read without stopping them.
+ *
+ * \param stats Pointer to result
+ */
+  extern void fast_convert_stats_get (struct fast_convert_stats *stats);
+
+/** \brief fast_convert_stats_reset
+ * 
+ * \b Description
+ *
+ * Clear slow path counters of all threads
+ */
+  extern void fast_convert_stats_reset (void);
+
+/** \brief fast_convert_tables_size
+ * 
+ * \b Description
+ *
+ * Size of a copy of the conversion tables. Copies are only used when
+ * fast_convert.c is compiled with FAST_CONVERT_NUMA_TABLES.
+ *
+ * \returns size in bytes, 0 without FAST_CONVERT_NUMA_TABLES
+ */
+  extern size_t fast_convert_tables_size (void);
+
+/** \brief fast_convert_tables_copy
+ * 
+ * \b Description
+ *
+ * Copy the conversion tables to mem, for example memory allocated on
+ * a NUMA node.
+ *
+ * \param mem memory of fast_convert_tables_size bytes
+ */
+  extern void fast_convert_tables_copy (void *mem);
+
+/** \brief fast_convert_tables_use
+ * 
+ * \b Description
+ *
+ * Let the calling thread use a copy of the conversion tables
+ *
+ * \param mem copy made by fast_convert_tables_copy, NULL for the
+ * built in tables
+ */
+  extern void fast_convert_tables_use (const void *mem);
+
 #if defined (__cplusplus)
 }
 #endif
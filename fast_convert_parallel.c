@@ -0,0 +1,407 @@
+/* Copyright 2019 Herman ten Brugge
+ *
+ * Licensed under the Apache License, Version 2.0 <LICENSE-APACHE or
+ * http://www.apache.org/licenses/LICENSE-2.0> or the MIT license
+ * <LICENSE-MIT or http://opensource.org/licenses/MIT>, at your
+ * option. This file may not be copied, modified, or distributed
+ * except according to those terms.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "fast_convert_parallel.h"
+
+/* Arrays below this size are converted by the calling thread */
+#define	POOL_SERIAL	4096
+/* Chunk sizes. A chunk should take about POOL_CHUNK_NS. */
+#define	POOL_MIN_CHUNK	64
+#define	POOL_MAX_CHUNK	(1 << 16)
+#define	POOL_START_CHUNK	1024
+#define	POOL_CHUNK_NS	50000
+
+/* next, end and chunk are read without lock by thieves, so every access
+   is atomic. Changes of next and end are also done with the lock of the
+   worker held, so the lock gives a consistent range. */
+#define	POOL_LOAD(x)	__atomic_load_n (&(x), __ATOMIC_RELAXED)
+#define	POOL_STORE(x, v)	__atomic_store_n (&(x), (v), __ATOMIC_RELAXED)
+
+/* Every thread owns a range [next, end) of the array. The owner takes
+ * chunks from the front, an idle thread steals the back half of the
+ * largest range. Results are stored by index, so the output does not
+ * depend on which thread converted a chunk. A thread never holds two
+ * worker locks at the same time, so there is no lock order. */
+struct pool_worker
+{
+  pthread_mutex_t lock;
+  pthread_t thread;
+  size_t next;
+  size_t end;
+  size_t chunk;
+  struct fast_convert_pool *pool;
+};
+
+struct fast_convert_pool
+{
+  pthread_mutex_t call;
+  pthread_mutex_t lock;
+  pthread_cond_t start;
+  pthread_cond_t done;
+  unsigned int nthreads;
+  unsigned int running;
+  uint64_t generation;
+  int exit;
+  void (*fn) (void *arg, size_t from, size_t to);
+  void *arg;
+  struct pool_worker w[];
+};
+
+struct strtod_job
+{
+  const char *buf;
+  const size_t *offsets;
+  double *out;
+  unsigned int *len;
+};
+
+struct dtoa_job
+{
+  const double *v;
+  int size;
+  char *arena;
+  unsigned int *len;
+};
+
+static uint64_t
+pool_time (void)
+{
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+static int
+pool_steal (struct fast_convert_pool *pool, struct pool_worker *w)
+{
+  unsigned int i;
+  size_t best;
+  size_t next;
+  size_t end;
+  size_t mid;
+  struct pool_worker *v;
+
+  for (;;) {
+    v = NULL;
+    best = 0;
+    for (i = 0; i < pool->nthreads; i++) {
+      size_t left = POOL_LOAD (pool->w[i].end) - POOL_LOAD (pool->w[i].next);
+
+      if (&pool->w[i] != w && left > best) {
+	best = left;
+	v = &pool->w[i];
+      }
+    }
+    if (v == NULL) {
+      return 0;
+    }
+    pthread_mutex_lock (&v->lock);
+    next = POOL_LOAD (v->next);
+    end = POOL_LOAD (v->end);
+    if (end - next <= POOL_LOAD (v->chunk)) {
+      /* Too small to split. Let the owner finish it. */
+      pthread_mutex_unlock (&v->lock);
+      for (i = 0; i < pool->nthreads; i++) {
+	if (POOL_LOAD (pool->w[i].end) - POOL_LOAD (pool->w[i].next) >
+	    POOL_LOAD (pool->w[i].chunk)) {
+	  break;
+	}
+      }
+      if (i == pool->nthreads) {
+	return 0;
+      }
+      continue;
+    }
+    mid = next + (end - next) / 2;
+    POOL_STORE (v->end, mid);
+    pthread_mutex_unlock (&v->lock);
+    /* [mid, end) now belongs to w only */
+    pthread_mutex_lock (&w->lock);
+    POOL_STORE (w->next, mid);
+    POOL_STORE (w->end, end);
+    pthread_mutex_unlock (&w->lock);
+    return 1;
+  }
+}
+
+/* Convert own range and steal until nothing is left. The chunk size
+   follows the measured time per chunk, so slow input (hex, subnormal,
+   long mantissa) uses smaller chunks and is balanced better. */
+static void
+pool_work (struct fast_convert_pool *pool, struct pool_worker *w)
+{
+  size_t from;
+  size_t to;
+  size_t end;
+  size_t chunk;
+  uint64_t t;
+
+  do {
+    for (;;) {
+      /* only the owner changes chunk */
+      chunk = POOL_LOAD (w->chunk);
+      pthread_mutex_lock (&w->lock);
+      from = POOL_LOAD (w->next);
+      end = POOL_LOAD (w->end);
+      to = from + chunk < end ? from + chunk : end;
+      POOL_STORE (w->next, to);
+      pthread_mutex_unlock (&w->lock);
+      if (from == to) {
+	break;
+      }
+      t = pool_time ();
+      pool->fn (pool->arg, from, to);
+      t = pool_time () - t;
+      if (t < POOL_CHUNK_NS / 2 && chunk < POOL_MAX_CHUNK) {
+	POOL_STORE (w->chunk, chunk * 2);
+      }
+      else if (t > POOL_CHUNK_NS * 2 && chunk > POOL_MIN_CHUNK) {
+	POOL_STORE (w->chunk, chunk / 2);
+      }
+    }
+  } while (pool_steal (pool, w));
+}
+
+static void *
+pool_thread (void *arg)
+{
+  struct pool_worker *w = (struct pool_worker *) arg;
+  struct fast_convert_pool *pool = w->pool;
+  uint64_t generation = 0;
+
+  pthread_mutex_lock (&pool->lock);
+  for (;;) {
+    while (pool->generation == generation && !pool->exit) {
+      pthread_cond_wait (&pool->start, &pool->lock);
+    }
+    if (pool->exit) {
+      break;
+    }
+    generation = pool->generation;
+    pthread_mutex_unlock (&pool->lock);
+    pool_work (pool, w);
+    pthread_mutex_lock (&pool->lock);
+    if (--pool->running == 0) {
+      pthread_cond_signal (&pool->done);
+    }
+  }
+  pthread_mutex_unlock (&pool->lock);
+  return NULL;
+}
+
+/* Call fn for all chunks of [0, n) */
+static void
+pool_run (struct fast_convert_pool *pool, size_t n,
+	  void (*fn) (void *arg, size_t from, size_t to), void *arg)
+{
+  unsigned int i;
+
+  if (pool == NULL || pool->nthreads == 1 || n < POOL_SERIAL) {
+    fn (arg, 0, n);
+    return;
+  }
+  pthread_mutex_lock (&pool->call);
+  pthread_mutex_lock (&pool->lock);
+  pool->fn = fn;
+  pool->arg = arg;
+  for (i = 0; i < pool->nthreads; i++) {
+    POOL_STORE (pool->w[i].next, n / pool->nthreads * i);
+    POOL_STORE (pool->w[i].end, i == pool->nthreads - 1 ? n :
+		n / pool->nthreads * (i + 1));
+    POOL_STORE (pool->w[i].chunk, POOL_START_CHUNK);
+  }
+  pool->running = pool->nthreads - 1;
+  pool->generation++;
+  pthread_cond_broadcast (&pool->start);
+  pthread_mutex_unlock (&pool->lock);
+  pool_work (pool, &pool->w[0]);
+  pthread_mutex_lock (&pool->lock);
+  while (pool->running) {
+    pthread_cond_wait (&pool->done, &pool->lock);
+  }
+  pthread_mutex_unlock (&pool->lock);
+  pthread_mutex_unlock (&pool->call);
+}
+
+/** \brief fast_convert_pool_create
+ *
+ * \b Description
+ *
+ * Create thread pool for the parallel conversions
+ *
+ * \param nthreads number of threads, 0 for all cores
+ * \returns pool or NULL when out of memory
+ */
+
+struct fast_convert_pool *
+fast_convert_pool_create (unsigned int nthreads)
+{
+  struct fast_convert_pool *pool;
+  unsigned int i;
+
+  if (nthreads == 0) {
+#ifdef _SC_NPROCESSORS_ONLN
+    long n = sysconf (_SC_NPROCESSORS_ONLN);
+
+    nthreads = n > 0 ? n : 1;
+#else
+    nthreads = 1;
+#endif
+  }
+  pool = calloc (1, sizeof (*pool) + nthreads * sizeof (pool->w[0]));
+  if (pool == NULL) {
+    return NULL;
+  }
+  pthread_mutex_init (&pool->call, NULL);
+  pthread_mutex_init (&pool->lock, NULL);
+  pthread_cond_init (&pool->start, NULL);
+  pthread_cond_init (&pool->done, NULL);
+  pool->nthreads = nthreads;
+  for (i = 0; i < nthreads; i++) {
+    pthread_mutex_init (&pool->w[i].lock, NULL);
+    pool->w[i].pool = pool;
+    pool->w[i].chunk = POOL_START_CHUNK;
+    if (i && pthread_create (&pool->w[i].thread, NULL, pool_thread,
+			     &pool->w[i])) {
+      /* run with the threads that could be started */
+      pool->nthreads = i;
+      break;
+    }
+  }
+  return pool;
+}
+
+/** \brief fast_convert_pool_destroy
+ *
+ * \b Description
+ *
+ * Stop threads and free pool
+ *
+ * \param pool pool to free
+ */
+
+void
+fast_convert_pool_destroy (struct fast_convert_pool *pool)
+{
+  unsigned int i;
+
+  if (pool == NULL) {
+    return;
+  }
+  pthread_mutex_lock (&pool->lock);
+  pool->exit = 1;
+  pthread_cond_broadcast (&pool->start);
+  pthread_mutex_unlock (&pool->lock);
+  for (i = 1; i < pool->nthreads; i++) {
+    pthread_join (pool->w[i].thread, NULL);
+  }
+  for (i = 0; i < pool->nthreads; i++) {
+    pthread_mutex_destroy (&pool->w[i].lock);
+  }
+  pthread_mutex_destroy (&pool->call);
+  pthread_mutex_destroy (&pool->lock);
+  pthread_cond_destroy (&pool->start);
+  pthread_cond_destroy (&pool->done);
+  free (pool);
+}
+
+static void
+strtod_range (void *arg, size_t from, size_t to)
+{
+  struct strtod_job *job = (struct strtod_job *) arg;
+  const char *str;
+  char *endptr;
+  size_t i;
+
+  for (i = from; i < to; i++) {
+    str = job->buf + job->offsets[i];
+    job->out[i] = fast_strtod (str, &endptr);
+    if (job->len) {
+      job->len[i] = endptr - str;
+    }
+  }
+}
+
+/** \brief fast_strtod_parallel
+ *
+ * \b Description
+ *
+ * Convert n strings to double with fast_strtod in parallel
+ *
+ * \param pool thread pool, NULL to use the calling thread only
+ * \param buf string buffer
+ * \param offsets start of each string in buf
+ * \param n number of strings
+ * \param out converted values
+ * \param len optional number of characters used per string
+ */
+
+void
+fast_strtod_parallel (struct fast_convert_pool *pool, const char *buf,
+		      const size_t * offsets, size_t n, double *out,
+		      unsigned int *len)
+{
+  struct strtod_job job;
+
+  job.buf = buf;
+  job.offsets = offsets;
+  job.out = out;
+  job.len = len;
+  pool_run (pool, n, strtod_range, &job);
+}
+
+static void
+dtoa_range (void *arg, size_t from, size_t to)
+{
+  struct dtoa_job *job = (struct dtoa_job *) arg;
+  unsigned int l;
+  size_t i;
+
+  for (i = from; i < to; i++) {
+    l = fast_dtoa (job->v[i], job->size,
+		   job->arena + i * FAST_DTOA_PARALLEL_SLOT);
+    if (job->len) {
+      job->len[i] = l;
+    }
+  }
+}
+
+/** \brief fast_dtoa_parallel
+ *
+ * \b Description
+ *
+ * Convert n doubles to ascii with fast_dtoa in parallel
+ *
+ * \param pool thread pool, NULL to use the calling thread only
+ * \param v values
+ * \param n number of values
+ * \param size precision, at most PREC_DBL_NR
+ * \param arena output strings
+ * \param len optional string lengths
+ */
+
+void
+fast_dtoa_parallel (struct fast_convert_pool *pool, const double *v,
+		    size_t n, int size, char *arena, unsigned int *len)
+{
+  struct dtoa_job job;
+
+  job.v = v;
+  /* longer exact output does not fit in a slot */
+  job.size = size > PREC_DBL_NR ? PREC_DBL_NR : size;
+  job.arena = arena;
+  job.len = len;
+  pool_run (pool, n, dtoa_range, &job);
+}
@@ -0,0 +1,91 @@
+/* Copyright 2019 Herman ten Brugge
+ *
+ * Licensed under the Apache License, Version 2.0 <LICENSE-APACHE or
+ * http://www.apache.org/licenses/LICENSE-2.0> or the MIT license
+ * <LICENSE-MIT or http://opensource.org/licenses/MIT>, at your
+ * option. This file may not be copied, modified, or distributed
+ * except according to those terms.
+ */
+
+#ifndef __FAST_CONVERT_PARALLEL_H
+#define __FAST_CONVERT_PARALLEL_H
+
+#include "fast_convert.h"
+
+#if defined (__cplusplus)
+extern "C"
+{
+#endif
+
+/* Size of one string in the fast_dtoa_parallel arena */
+#define FAST_DTOA_PARALLEL_SLOT	32
+
+  struct fast_convert_pool;
+
+/** \brief fast_convert_pool_create
+ *
+ * \b Description
+ *
+ * Create thread pool for the parallel conversions. The calling thread
+ * is one of the threads. The pool can be reused for many calls.
+ *
+ * \param nthreads number of threads, 0 for all cores
+ * \returns pool or NULL when out of memory
+ */
+  extern struct fast_convert_pool *fast_convert_pool_create (unsigned int
+							     nthreads);
+
+/** \brief fast_convert_pool_destroy
+ *
+ * \b Description
+ *
+ * Stop threads and free pool
+ *
+ * \param pool pool to free
+ */
+  extern void fast_convert_pool_destroy (struct fast_convert_pool *pool);
+
+/** \brief fast_strtod_parallel
+ *
+ * \b Description
+ *
+ * Convert n strings to double with fast_strtod. String i starts at
+ * buf + offsets[i]. Large arrays are split in chunks that are divided
+ * over the pool threads. Idle threads steal work from busy threads.
+ * out[i] is the same as a single threaded loop.
+ *
+ * \param pool thread pool, NULL to use the calling thread only
+ * \param buf string buffer
+ * \param offsets start of each string in buf
+ * \param n number of strings
+ * \param out converted values
+ * \param len optional number of characters used per string
+ */
+  extern void fast_strtod_parallel (struct fast_convert_pool *pool,
+				    const char *buf, const size_t * offsets,
+				    size_t n, double *out, unsigned int *len);
+
+/** \brief fast_dtoa_parallel
+ *
+ * \b Description
+ *
+ * Convert n doubles to ascii with fast_dtoa. The string of v[i] is
+ * stored at arena + i * FAST_DTOA_PARALLEL_SLOT, so the arena must
+ * hold n * FAST_DTOA_PARALLEL_SLOT characters.
+ *
+ * \param pool thread pool, NULL to use the calling thread only
+ * \param v values
+ * \param n number of values
+ * \param size precision, at most PREC_DBL_NR
+ * \param arena output strings
+ * \param len optional string lengths
+ */
+  extern void fast_dtoa_parallel (struct fast_convert_pool *pool,
+				  const double *v, size_t n, int size,
+				  char *arena, unsigned int *len);
+
+#if defined (__cplusplus)
+}
+#endif
+
+#endif				/* __FAST_CONVERT_PARALLEL_H */
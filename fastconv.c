@@ -0,0 +1,1119 @@
+/* Copyright 2019 Herman ten Brugge
+ *
+ * Licensed under the Apache License, Version 2.0 <LICENSE-APACHE or
+ * http://www.apache.org/licenses/LICENSE-2.0> or the MIT license
+ * <LICENSE-MIT or http://opensource.org/licenses/MIT>, at your
+ * option. This file may not be copied, modified, or distributed
+ * except according to those terms.
+ */
+
+/* Convert a delimited text file with numbers (csv, tsv) to one raw
+   binary file per column. The input is mapped and split at line
+   boundaries over the threads. The threads first count their lines,
+   so every thread knows the row where its part starts and writes its
+   values with pwrite at that offset.
+
+   With -r the input is read in blocks instead. Several reads are kept
+   in flight with io_uring (pread when io_uring is not available) into
+   a fixed pool of buffers. The main thread handles the blocks in file
+   order: the partial line at the end of a block is moved in front of
+   the next block, the lines are counted to get the first row and the
+   block is queued for the threads. A buffer is read again when its
+   thread is done with it.
+
+   With -N the mapped input is split in more parts than threads. A part
+   belongs to the NUMA node that holds its first page. The threads are
+   bound round robin to the nodes, use a copy of the conversion tables
+   in the memory of their node and convert the parts of their node
+   first. Then they take parts of other nodes. */
+
+#define	_GNU_SOURCE		/* memrchr */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#endif
+#ifdef FASTCONV_NUMA
+#include <numa.h>
+#include <numaif.h>
+#endif
+#include "fast_convert.h"
+
+#define	FASTCONV_MAX_THREADS	256
+/* size of value buffer of one thread */
+#define	FASTCONV_BUFFER		(1 << 22)
+/* size of one read with -r */
+#define	FASTCONV_BLOCK		(1 << 22)
+/* longest line with -r */
+#define	FASTCONV_LINE		(1 << 16)
+/* reads in flight with -r */
+#define	FASTCONV_DEPTH		4
+/* parts per thread with -N */
+#define	FASTCONV_PARTS		4
+#define	FASTCONV_MAX_PARTS	(FASTCONV_MAX_THREADS * FASTCONV_PARTS)
+#define	FASTCONV_MAX_NODES	64
+
+#define	TYPE_F32	0
+#define	TYPE_F64	1
+#define	TYPE_I64	2
+
+#define	BUF_FREE	0
+#define	BUF_READING	1
+#define	BUF_READ	2
+#define	BUF_QUEUED	3
+
+static const char *const type_name[] = { "f32", "f64", "i64" };
+static const unsigned int type_size[] = { 4, 8, 8 };
+
+static struct fastconv_job
+{
+  const char *data;
+  size_t size;
+  int type;
+  char delim;
+  unsigned int ncols;
+  int *fd;
+} job;
+
+static struct fastconv_worker
+{
+  pthread_t thread;
+  const char *start;
+  const char *end;
+  uint64_t rows;
+  uint64_t first;
+  uint64_t bad;
+  int error;
+  unsigned int node;
+  uint64_t bytes;
+  double time;
+} workers[FASTCONV_MAX_THREADS];
+
+static struct fastconv_uring
+{
+  int fd;
+  unsigned int *sq_head;
+  unsigned int *sq_tail;
+  unsigned int *sq_mask;
+  unsigned int *sq_array;
+  unsigned int *cq_head;
+  unsigned int *cq_tail;
+  unsigned int *cq_mask;
+  struct io_uring_sqe *sqes;
+  struct io_uring_cqe *cqes;
+} uring;
+
+static struct fastconv_buffer
+{
+  char *mem;
+  off_t offset;
+  size_t len;
+  const char *start;
+  const char *end;
+  uint64_t first;
+  int state;
+} buffers[FASTCONV_MAX_THREADS + FASTCONV_DEPTH + 1];
+
+static struct fastconv_reader
+{
+  pthread_mutex_t lock;
+  pthread_cond_t queued;
+  pthread_cond_t freed;
+  unsigned int nbuf;
+  uint64_t next;
+  uint64_t end;
+  int done;
+  int use_uring;
+  int fd;
+} reader = {
+  .lock = PTHREAD_MUTEX_INITIALIZER,
+  .queued = PTHREAD_COND_INITIALIZER,
+  .freed = PTHREAD_COND_INITIALIZER
+};
+
+static struct fastconv_numa
+{
+  unsigned int nnodes;
+  unsigned int nparts;
+  const char *bnd[FASTCONV_MAX_PARTS + 1];
+  uint64_t first[FASTCONV_MAX_PARTS];
+  /* parts of node n are part[node_first[n]] .. part[node_first[n + 1] - 1] */
+  unsigned int part[FASTCONV_MAX_PARTS];
+  unsigned int node_first[FASTCONV_MAX_NODES + 1];
+  unsigned int node_next[FASTCONV_MAX_NODES];
+  void *tables[FASTCONV_MAX_NODES];
+  const char *prefix;
+  uint64_t rows;
+  int error;
+  pthread_barrier_t barrier;
+} numa;
+
+static double
+get_time (void)
+{
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void *
+count_lines (void *arg)
+{
+  struct fastconv_worker *w = (struct fastconv_worker *) arg;
+  const char *cp = w->start;
+  const char *nl;
+  uint64_t rows = 0;
+
+  while ((nl = memchr (cp, '\n', w->end - cp)) != NULL) {
+    rows++;
+    cp = nl + 1;
+  }
+  w->rows = rows + (cp < w->end);
+  return NULL;
+}
+
+/* Number of fields in first line */
+static unsigned int
+count_columns (const char *cp, const char *end)
+{
+  const char *eol = memchr (cp, '\n', end - cp);
+  unsigned int ncols = 1;
+
+  for (; cp < (eol ? eol : end); cp++) {
+    ncols += *cp == job.delim;
+  }
+  return ncols;
+}
+
+static int
+open_columns (const char *prefix, uint64_t rows)
+{
+  char name[4096];
+  unsigned int i;
+
+  job.fd = malloc (job.ncols * sizeof (int));
+  for (i = 0; i < job.ncols; i++) {
+    snprintf (name, sizeof (name), "%s.%u.%s", prefix, i,
+	      type_name[job.type]);
+    job.fd[i] = open (name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (job.fd[i] < 0 ||
+	ftruncate (job.fd[i], rows * type_size[job.type]) < 0) {
+      perror (name);
+      return -1;
+    }
+  }
+  return 0;
+}
+
+/* Convert one line. Missing fields, fields that are not a number, fields
+   with trailing characters and i64 fields that overflow are stored as nan
+   (0 for i64) and counted in bad. */
+static void
+convert_line (struct fastconv_worker *w, const char *cp, const char *eol,
+	      char *buf, size_t stride)
+{
+  unsigned int col;
+  char *endptr;
+  const char *next;
+  int ok;
+  enum fast_convert_status status;
+  union
+  {
+    float f;
+    double d;
+    int64_t i;
+  } v;
+
+  for (col = 0; col < job.ncols; col++) {
+    while (cp < eol && (*cp == ' ' || (*cp == '\t' && job.delim != '\t'))) {
+      cp++;
+    }
+    /* fast_strto* skip white space, so never start at end of line */
+    ok = cp < eol && *cp != job.delim && *cp != '\r';
+    endptr = (char *) cp;
+    status = FAST_CONVERT_OK;
+    switch (job.type) {
+    case TYPE_F32:
+      v.f = ok ? fast_strtof (cp, &endptr) : 0.0f;
+      break;
+    case TYPE_F64:
+      v.d = ok ? fast_strtod (cp, &endptr) : 0.0;
+      break;
+    default:
+      v.i = ok ? fast_strtos64_status (cp, &endptr, 10, &status) : 0;
+      break;
+    }
+    /* the whole field up to trailing blanks must be the number */
+    ok = endptr != cp && status != FAST_CONVERT_OVERFLOW;
+    cp = endptr;
+    while (cp < eol && (*cp == ' ' || (*cp == '\t' && job.delim != '\t'))) {
+      cp++;
+    }
+    ok &= cp == eol || *cp == job.delim || *cp == '\r';
+    if (!ok) {
+      switch (job.type) {
+      case TYPE_F32:
+	v.f = __builtin_nanf ("");
+	break;
+      case TYPE_F64:
+	v.d = __builtin_nan ("");
+	break;
+      default:
+	v.i = 0;
+	break;
+      }
+      w->bad++;
+    }
+    memcpy (buf + col * stride, &v, type_size[job.type]);
+    next = memchr (cp, job.delim, eol - cp);
+    cp = next ? next + 1 : eol;
+  }
+}
+
+static int
+flush_values (struct fastconv_worker *w, const char *buf, size_t stride,
+	      uint64_t row, uint64_t n)
+{
+  unsigned int col;
+  size_t len = n * type_size[job.type];
+  off_t offset = row * type_size[job.type];
+
+  for (col = 0; col < job.ncols; col++) {
+    if (pwrite (job.fd[col], buf + col * stride, len, offset) !=
+	(ssize_t) len) {
+      w->error = errno ? errno : EIO;
+      return -1;
+    }
+  }
+  return 0;
+}
+
+static size_t
+value_stride (void)
+{
+  uint64_t block = FASTCONV_BUFFER / ((uint64_t) job.ncols *
+				      type_size[job.type]);
+
+  return (block ? block : 1) * type_size[job.type];
+}
+
+/* Convert lines [cp, end) that start at row and write them */
+static void
+convert_lines (struct fastconv_worker *w, const char *cp, const char *end,
+	       uint64_t row, char *buf)
+{
+  unsigned int elem = type_size[job.type];
+  size_t stride = value_stride ();
+  uint64_t block = stride / elem;
+  uint64_t n = 0;
+  const char *eol;
+  char *last = NULL;
+
+  while (cp < end) {
+    eol = memchr (cp, '\n', end - cp);
+    if (eol == NULL) {
+      /* last line without newline may end at the end of the mapping */
+      last = malloc (end - cp + 2);
+      if (last == NULL) {
+	w->error = ENOMEM;
+	break;
+      }
+      memcpy (last, cp, end - cp);
+      last[end - cp] = '\n';
+      last[end - cp + 1] = '\0';
+      eol = last + (end - cp);
+      cp = last;
+    }
+    convert_line (w, cp, eol, buf + n * elem, stride);
+    cp = last ? end : eol + 1;
+    if (++n == block) {
+      if (flush_values (w, buf, stride, row, n)) {
+	break;
+      }
+      row += n;
+      n = 0;
+    }
+  }
+  if (n && w->error == 0) {
+    flush_values (w, buf, stride, row, n);
+  }
+  free (last);
+}
+
+static void *
+convert_part (void *arg)
+{
+  struct fastconv_worker *w = (struct fastconv_worker *) arg;
+  char *buf = malloc (value_stride () * job.ncols);
+
+  if (buf == NULL) {
+    w->error = ENOMEM;
+    return NULL;
+  }
+  convert_lines (w, w->start, w->end, w->first, buf);
+  free (buf);
+  return NULL;
+}
+
+/* Setup io_uring without liburing. Returns -1 if not available. */
+static int
+uring_init (unsigned int entries)
+{
+#if defined (__linux__) && defined (__NR_io_uring_setup)
+  struct io_uring_params p;
+  size_t sq_len;
+  size_t cq_len;
+  char *sq;
+  char *cq;
+
+  memset (&p, 0, sizeof (p));
+  uring.fd = syscall (__NR_io_uring_setup, entries, &p);
+  if (uring.fd < 0) {
+    return -1;
+  }
+  sq_len = p.sq_off.array + p.sq_entries * sizeof (unsigned int);
+  cq_len = p.cq_off.cqes + p.cq_entries * sizeof (struct io_uring_cqe);
+  if (p.features & IORING_FEAT_SINGLE_MMAP) {
+    sq_len = cq_len = sq_len > cq_len ? sq_len : cq_len;
+  }
+  sq = mmap (NULL, sq_len, PROT_READ | PROT_WRITE,
+	     MAP_SHARED | MAP_POPULATE, uring.fd, IORING_OFF_SQ_RING);
+  cq = (p.features & IORING_FEAT_SINGLE_MMAP) ? sq :
+    mmap (NULL, cq_len, PROT_READ | PROT_WRITE,
+	  MAP_SHARED | MAP_POPULATE, uring.fd, IORING_OFF_CQ_RING);
+  uring.sqes = mmap (NULL, p.sq_entries * sizeof (struct io_uring_sqe),
+		     PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+		     uring.fd, IORING_OFF_SQES);
+  if (sq == MAP_FAILED || cq == MAP_FAILED || uring.sqes == MAP_FAILED) {
+    close (uring.fd);
+    return -1;
+  }
+  uring.sq_head = (unsigned int *) (sq + p.sq_off.head);
+  uring.sq_tail = (unsigned int *) (sq + p.sq_off.tail);
+  uring.sq_mask = (unsigned int *) (sq + p.sq_off.ring_mask);
+  uring.sq_array = (unsigned int *) (sq + p.sq_off.array);
+  uring.cq_head = (unsigned int *) (cq + p.cq_off.head);
+  uring.cq_tail = (unsigned int *) (cq + p.cq_off.tail);
+  uring.cq_mask = (unsigned int *) (cq + p.cq_off.ring_mask);
+  uring.cqes = (struct io_uring_cqe *) (cq + p.cq_off.cqes);
+  return 0;
+#else
+  (void) entries;
+  return -1;
+#endif
+}
+
+static int
+uring_read (int fd, char *buf, size_t len, off_t offset, uint64_t data)
+{
+#if defined (__linux__) && defined (__NR_io_uring_setup)
+  unsigned int tail = *uring.sq_tail;
+  unsigned int idx = tail & *uring.sq_mask;
+  struct io_uring_sqe *sqe = &uring.sqes[idx];
+
+  memset (sqe, 0, sizeof (*sqe));
+  sqe->opcode = IORING_OP_READ;
+  sqe->fd = fd;
+  sqe->addr = (uintptr_t) buf;
+  sqe->len = len;
+  sqe->off = offset;
+  sqe->user_data = data;
+  uring.sq_array[idx] = idx;
+  __atomic_store_n (uring.sq_tail, tail + 1, __ATOMIC_RELEASE);
+  return syscall (__NR_io_uring_enter, uring.fd, 1, 0, 0, NULL, 0) == 1 ?
+    0 : -1;
+#else
+  (void) fd;
+  (void) buf;
+  (void) len;
+  (void) offset;
+  (void) data;
+  return -1;
+#endif
+}
+
+/* Wait for one read, returns its data and sets res */
+static uint64_t
+uring_wait (int *res)
+{
+#if defined (__linux__) && defined (__NR_io_uring_setup)
+  unsigned int head = *uring.cq_head;
+  struct io_uring_cqe *cqe;
+  uint64_t data;
+
+  while (head == __atomic_load_n (uring.cq_tail, __ATOMIC_ACQUIRE)) {
+    if (syscall (__NR_io_uring_enter, uring.fd, 0, 1,
+		 IORING_ENTER_GETEVENTS, NULL, 0) < 0 && errno != EINTR) {
+      *res = -errno;
+      return UINT64_MAX;
+    }
+  }
+  cqe = &uring.cqes[head & *uring.cq_mask];
+  *res = cqe->res;
+  data = cqe->user_data;
+  __atomic_store_n (uring.cq_head, head + 1, __ATOMIC_RELEASE);
+  return data;
+#else
+  *res = -ENOSYS;
+  return UINT64_MAX;
+#endif
+}
+
+/* Read rest of buffer after a short read */
+static int
+read_rest (struct fastconv_buffer *b, size_t want)
+{
+  char *data = b->mem + FASTCONV_LINE;
+  ssize_t len;
+
+  while (b->len < want) {
+    len = pread (reader.fd, data + b->len, want - b->len,
+		 b->offset + b->len);
+    if (len <= 0) {
+      return len < 0 ? -1 : 0;
+    }
+    b->len += len;
+  }
+  return 0;
+}
+
+static size_t
+block_len (struct fastconv_buffer *b)
+{
+  return job.size - b->offset < FASTCONV_BLOCK ?
+    job.size - b->offset : FASTCONV_BLOCK;
+}
+
+/* Start read of block seq */
+static int
+start_read (uint64_t seq)
+{
+  struct fastconv_buffer *b = &buffers[seq % reader.nbuf];
+
+  pthread_mutex_lock (&reader.lock);
+  while (b->state != BUF_FREE) {
+    pthread_cond_wait (&reader.freed, &reader.lock);
+  }
+  b->state = BUF_READING;
+  pthread_mutex_unlock (&reader.lock);
+  b->offset = seq * FASTCONV_BLOCK;
+  b->len = 0;
+  if (reader.use_uring &&
+      uring_read (reader.fd, b->mem + FASTCONV_LINE, block_len (b),
+		  b->offset, seq % reader.nbuf) == 0) {
+    return 0;
+  }
+  reader.use_uring = 0;
+  b->state = BUF_READ;
+  return read_rest (b, block_len (b));
+}
+
+/* Wait until block seq is read */
+static int
+wait_read (uint64_t seq)
+{
+  struct fastconv_buffer *b = &buffers[seq % reader.nbuf];
+  uint64_t i;
+  int res;
+
+  while (b->state == BUF_READING) {
+    i = uring_wait (&res);
+    if (i >= reader.nbuf) {
+      errno = -res;
+      return -1;
+    }
+    buffers[i].state = BUF_READ;
+    /* -EINVAL: kernel without IORING_OP_READ */
+    if (res < 0 && res != -EINVAL) {
+      errno = -res;
+      return -1;
+    }
+    if (res == -EINVAL) {
+      reader.use_uring = 0;
+    }
+    buffers[i].len = res > 0 ? res : 0;
+    if (read_rest (&buffers[i], block_len (&buffers[i])) < 0) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+static void *
+convert_queued (void *arg)
+{
+  struct fastconv_worker *w = (struct fastconv_worker *) arg;
+  struct fastconv_buffer *b;
+  char *buf = malloc (value_stride () * job.ncols);
+
+  if (buf == NULL) {
+    w->error = ENOMEM;
+  }
+  pthread_mutex_lock (&reader.lock);
+  for (;;) {
+    while (reader.next == reader.end && !reader.done) {
+      pthread_cond_wait (&reader.queued, &reader.lock);
+    }
+    if (reader.next == reader.end) {
+      break;
+    }
+    b = &buffers[reader.next++ % reader.nbuf];
+    pthread_mutex_unlock (&reader.lock);
+    if (buf) {
+      convert_lines (w, b->start, b->end, b->first, buf);
+    }
+    pthread_mutex_lock (&reader.lock);
+    b->state = BUF_FREE;
+    pthread_cond_broadcast (&reader.freed);
+  }
+  pthread_mutex_unlock (&reader.lock);
+  free (buf);
+  return NULL;
+}
+
+/* Convert input read with io_uring or pread */
+static int
+convert_read (int fd, const char *prefix, unsigned int nthreads,
+	      unsigned int ncols, int header, uint64_t * rows)
+{
+  static char carry[FASTCONV_LINE];
+  size_t carry_len = 0;
+  uint64_t nseq = (job.size + FASTCONV_BLOCK - 1) / FASTCONV_BLOCK;
+  uint64_t submit = 0;
+  uint64_t seq;
+  unsigned int i;
+  struct fastconv_buffer *b;
+  char *data;
+  char *end;
+  const char *nl;
+  struct fastconv_worker w;
+  int started = 0;
+  int ret = 0;
+
+  reader.fd = fd;
+  reader.nbuf = nthreads + FASTCONV_DEPTH + 1;
+  for (i = 0; i < reader.nbuf; i++) {
+    buffers[i].mem = malloc (FASTCONV_LINE + FASTCONV_BLOCK + 1);
+    buffers[i].state = BUF_FREE;
+    if (buffers[i].mem == NULL) {
+      perror ("malloc");
+      return -1;
+    }
+  }
+  *rows = 0;
+  job.ncols = ncols ? ncols : 1;
+  for (seq = 0; seq < nseq; seq++) {
+    while (submit < nseq && submit < seq + FASTCONV_DEPTH) {
+      if (start_read (submit++) < 0) {
+	perror ("read");
+	ret = -1;
+	break;
+      }
+    }
+    if (ret < 0 || wait_read (seq) < 0) {
+      perror ("read");
+      ret = -1;
+      break;
+    }
+    b = &buffers[seq % reader.nbuf];
+    data = b->mem + FASTCONV_LINE;
+    end = data + b->len;
+    if (b->len < block_len (b)) {
+      fprintf (stderr, "read: file is truncated\n");
+      ret = -1;
+      break;
+    }
+    /* put partial line of previous block in front */
+    b->start = data - carry_len;
+    memcpy ((char *) b->start, carry, carry_len);
+    carry_len = 0;
+    if (seq == nseq - 1) {
+      if (end > b->start && end[-1] != '\n') {
+	*end++ = '\n';
+      }
+    }
+    else {
+      nl = memrchr (data, '\n', b->len);
+      carry_len = nl ? end - (nl + 1) : FASTCONV_LINE + 1;
+      if (carry_len > FASTCONV_LINE) {
+	fprintf (stderr, "line longer than %u\n", FASTCONV_LINE);
+	ret = -1;
+	break;
+      }
+      memcpy (carry, nl + 1, carry_len);
+      end = (char *) nl + 1;
+    }
+    b->end = end;
+    if (seq == 0) {
+      if (header) {
+	nl = memchr (b->start, '\n', b->end - b->start);
+	b->start = nl ? nl + 1 : b->end;
+      }
+      if (ncols == 0) {
+	job.ncols = count_columns (b->start, b->end);
+      }
+      if (open_columns (prefix, 0) < 0) {
+	ret = -1;
+	break;
+      }
+      for (i = 0; i < nthreads; i++) {
+	pthread_create (&workers[i].thread, NULL, convert_queued,
+			&workers[i]);
+      }
+      started = 1;
+    }
+    w.start = b->start;
+    w.end = b->end;
+    count_lines (&w);
+    pthread_mutex_lock (&reader.lock);
+    b->first = *rows;
+    *rows += w.rows;
+    b->state = BUF_QUEUED;
+    reader.end++;
+    pthread_cond_signal (&reader.queued);
+    pthread_mutex_unlock (&reader.lock);
+  }
+  if (nseq == 0 && open_columns (prefix, 0) < 0) {
+    ret = -1;
+  }
+  pthread_mutex_lock (&reader.lock);
+  reader.done = 1;
+  pthread_cond_broadcast (&reader.queued);
+  pthread_mutex_unlock (&reader.lock);
+  if (started) {
+    for (i = 0; i < nthreads; i++) {
+      pthread_join (workers[i].thread, NULL);
+    }
+  }
+  /* wait for reads still in flight before the buffers are freed */
+  for (seq++; seq < submit; seq++) {
+    wait_read (seq);
+  }
+  for (i = 0; i < reader.nbuf; i++) {
+    free (buffers[i].mem);
+  }
+  return ret;
+}
+
+/* Map input, skip header and set number of columns. Sets first to the
+   start of the first line. Returns -1 if the input can not be mapped. */
+static int
+map_input (int fd, unsigned int ncols, int header, const char **first)
+{
+  const char *cp;
+  const char *eol;
+  void *map = (void *) "";
+
+  if (job.size) {
+    map = mmap (NULL, job.size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED) {
+      perror ("mmap");
+      return -1;
+    }
+    madvise (map, job.size, MADV_SEQUENTIAL);
+  }
+  job.data = (const char *) map;
+  cp = job.data;
+  if (header && job.size) {
+    eol = memchr (job.data, '\n', job.size);
+    cp = eol ? eol + 1 : job.data + job.size;
+  }
+  job.ncols = ncols ? ncols : count_columns (cp, job.data + job.size);
+  *first = cp;
+  return 0;
+}
+
+/* Split [bnd[0], bnd[n]) in n parts at line boundaries */
+static void
+split_lines (const char **bnd, unsigned int n)
+{
+  const char *cp;
+  const char *eol;
+  unsigned int i;
+
+  for (i = 1; i < n; i++) {
+    cp = job.data + job.size / n * i;
+    if (cp < bnd[i - 1]) {
+      cp = bnd[i - 1];
+    }
+    eol = memchr (cp, '\n', bnd[n] - cp);
+    bnd[i] = eol ? eol + 1 : bnd[n];
+  }
+}
+
+/* Convert mapped input */
+static int
+convert_mapped (int fd, const char *prefix, unsigned int nthreads,
+		unsigned int ncols, int header, uint64_t * rows)
+{
+  const char *bnd[FASTCONV_MAX_THREADS + 1];
+  unsigned int i;
+
+  if (map_input (fd, ncols, header, &bnd[0]) < 0) {
+    return -1;
+  }
+  bnd[nthreads] = job.data + job.size;
+  split_lines (bnd, nthreads);
+  for (i = 0; i < nthreads; i++) {
+    workers[i].start = bnd[i];
+    workers[i].end = bnd[i + 1];
+    pthread_create (&workers[i].thread, NULL, count_lines, &workers[i]);
+  }
+  *rows = 0;
+  for (i = 0; i < nthreads; i++) {
+    pthread_join (workers[i].thread, NULL);
+    workers[i].first = *rows;
+    *rows += workers[i].rows;
+  }
+  if (open_columns (prefix, *rows) < 0) {
+    return -1;
+  }
+  for (i = 0; i < nthreads; i++) {
+    pthread_create (&workers[i].thread, NULL, convert_part, &workers[i]);
+  }
+  for (i = 0; i < nthreads; i++) {
+    pthread_join (workers[i].thread, NULL);
+  }
+  if (job.size) {
+    munmap ((void *) job.data, job.size);
+  }
+  return 0;
+}
+
+/* Node of the memory of part p. Without libnuma or when the kernel
+   does not know, the parts are divided in equal ranges over the
+   nodes. */
+static unsigned int
+part_node (unsigned int p)
+{
+#ifdef FASTCONV_NUMA
+  uintptr_t page = (uintptr_t) numa.bnd[p] & ~(uintptr_t) (getpagesize () - 1);
+  void *addr = (void *) page;
+  int status = -1;
+
+  if (numa.nnodes > 1 && numa.bnd[p] < numa.bnd[p + 1]) {
+    /* the page must be mapped to get its node */
+    (void) *(volatile const char *) numa.bnd[p];
+    if (numa_move_pages (0, 1, &addr, NULL, &status, 0) == 0 &&
+	status >= 0 && (unsigned int) status < numa.nnodes) {
+      return status;
+    }
+  }
+#endif
+  return (uint64_t) p * numa.nnodes / numa.nparts;
+}
+
+/* Next part for a thread on node, parts of other nodes when the parts
+   of node are done. Returns -1 when all parts are taken. */
+static int
+next_part (unsigned int node)
+{
+  unsigned int i;
+  unsigned int n;
+  unsigned int k;
+
+  for (i = 0; i < numa.nnodes; i++) {
+    n = (node + i) % numa.nnodes;
+    k = __atomic_fetch_add (&numa.node_next[n], 1, __ATOMIC_RELAXED);
+    if (k < numa.node_first[n + 1] - numa.node_first[n]) {
+      return numa.part[numa.node_first[n] + k];
+    }
+  }
+  return -1;
+}
+
+static void *
+convert_node (void *arg)
+{
+  struct fastconv_worker *w = (struct fastconv_worker *) arg;
+  struct fastconv_worker part;
+  char *buf;
+  double start;
+  int p;
+
+#ifdef FASTCONV_NUMA
+  if (numa.nnodes > 1) {
+    numa_run_on_node (w->node);
+  }
+#endif
+  fast_convert_tables_use (numa.tables[w->node]);
+  /* allocated after binding, so the values are in local memory */
+  buf = malloc (value_stride () * job.ncols);
+  if (buf == NULL) {
+    w->error = ENOMEM;
+  }
+  while ((p = next_part (w->node)) >= 0) {
+    part.start = numa.bnd[p];
+    part.end = numa.bnd[p + 1];
+    count_lines (&part);
+    numa.first[p] = part.rows;
+  }
+  pthread_barrier_wait (&numa.barrier);
+  if (w == &workers[0]) {
+    for (p = 0; (unsigned int) p < numa.nparts; p++) {
+      part.rows = numa.first[p];
+      numa.first[p] = numa.rows;
+      numa.rows += part.rows;
+    }
+    memset (numa.node_next, 0, sizeof (numa.node_next));
+    numa.error = open_columns (numa.prefix, numa.rows);
+  }
+  pthread_barrier_wait (&numa.barrier);
+  start = get_time ();
+  while (buf && numa.error == 0 && (p = next_part (w->node)) >= 0) {
+    convert_lines (w, numa.bnd[p], numa.bnd[p + 1], numa.first[p], buf);
+    w->bytes += numa.bnd[p + 1] - numa.bnd[p];
+  }
+  w->time = get_time () - start;
+  fast_convert_tables_use (NULL);
+  free (buf);
+  return NULL;
+}
+
+/* Convert mapped input with threads bound to NUMA nodes */
+static int
+convert_numa (int fd, const char *prefix, unsigned int nthreads,
+	      unsigned int ncols, int header, uint64_t * rows)
+{
+  unsigned int node[FASTCONV_MAX_PARTS];
+  size_t tables_size = fast_convert_tables_size ();
+  unsigned int i;
+  unsigned int j;
+  unsigned int n;
+
+  numa.nnodes = 1;
+#ifdef FASTCONV_NUMA
+  if (numa_available () >= 0) {
+    numa.nnodes = numa_max_node () + 1;
+    if (numa.nnodes > FASTCONV_MAX_NODES) {
+      numa.nnodes = FASTCONV_MAX_NODES;
+    }
+  }
+#endif
+  if (map_input (fd, ncols, header, &numa.bnd[0]) < 0) {
+    return -1;
+  }
+  numa.nparts = nthreads * FASTCONV_PARTS;
+  numa.bnd[numa.nparts] = job.data + job.size;
+  split_lines (numa.bnd, numa.nparts);
+
+  /* sort parts by node */
+  for (i = 0; i < numa.nparts; i++) {
+    node[i] = part_node (i);
+  }
+  j = 0;
+  for (n = 0; n < numa.nnodes; n++) {
+    numa.node_first[n] = j;
+    for (i = 0; i < numa.nparts; i++) {
+      if (node[i] == n) {
+	numa.part[j++] = i;
+      }
+    }
+  }
+  numa.node_first[numa.nnodes] = j;
+
+  /* table copy per node that has threads */
+  for (n = 0; n < numa.nnodes && n < nthreads; n++) {
+#ifdef FASTCONV_NUMA
+    if (numa.nnodes > 1 && tables_size) {
+      numa.tables[n] = numa_alloc_onnode (tables_size, n);
+      if (numa.tables[n]) {
+	fast_convert_tables_copy (numa.tables[n]);
+      }
+    }
+#else
+    (void) tables_size;
+#endif
+  }
+  numa.prefix = prefix;
+  pthread_barrier_init (&numa.barrier, NULL, nthreads);
+  for (i = 0; i < nthreads; i++) {
+    workers[i].node = i % numa.nnodes;
+    pthread_create (&workers[i].thread, NULL, convert_node, &workers[i]);
+  }
+  for (i = 0; i < nthreads; i++) {
+    pthread_join (workers[i].thread, NULL);
+  }
+  pthread_barrier_destroy (&numa.barrier);
+  for (n = 0; n < numa.nnodes; n++) {
+#ifdef FASTCONV_NUMA
+    if (numa.tables[n]) {
+      numa_free (numa.tables[n], tables_size);
+    }
+#endif
+  }
+  if (job.size) {
+    munmap ((void *) job.data, job.size);
+  }
+  *rows = numa.rows;
+  return numa.error;
+}
+
+/* Print throughput of the threads of every node */
+static void
+print_nodes (unsigned int nthreads)
+{
+  unsigned int n;
+  unsigned int i;
+  unsigned int threads;
+  uint64_t bytes;
+  double time;
+
+  for (n = 0; n < numa.nnodes; n++) {
+    threads = 0;
+    bytes = 0;
+    time = 0;
+    for (i = 0; i < nthreads; i++) {
+      if (workers[i].node == n) {
+	threads++;
+	bytes += workers[i].bytes;
+	time = workers[i].time > time ? workers[i].time : time;
+      }
+    }
+    printf ("node %u: %u parts, %u threads, %.3f GB in %.3f s, %.2f GB/s\n",
+	    n, numa.node_first[n + 1] - numa.node_first[n], threads,
+	    bytes / 1e9, time, time > 0 ? bytes / 1e9 / time : 0.0);
+  }
+}
+
+static void
+usage (const char *name)
+{
+  printf ("Usage: %s [options] input prefix\n", name);
+  printf ("Write column n of input to prefix.n.type\n");
+  printf ("options:\n");
+  printf ("  -t threads  number of threads (default all cores)\n");
+  printf ("  -T type     f32, f64 (default) or i64\n");
+  printf ("  -d delim    field delimiter, 't' for tab (default ',')\n");
+  printf ("  -c columns  number of columns (default from first line)\n");
+  printf ("  -H          skip header line\n");
+  printf ("  -r mode     read with uring (pread if not available) or pread\n");
+  printf ("              instead of mmap\n");
+  printf ("  -N          bind threads to NUMA nodes and print throughput\n");
+  printf ("              per node\n");
+}
+
+int
+main (int argc, char **argv)
+{
+  long n = sysconf (_SC_NPROCESSORS_ONLN);
+  unsigned int nthreads;
+  unsigned int ncols = 0;
+  unsigned int i;
+  int header = 0;
+  int mode = 0;
+  int opt;
+  int fd;
+  int ret = 0;
+  struct stat st;
+  uint64_t rows = 0;
+  uint64_t bad = 0;
+  double start;
+  double end;
+
+  job.type = TYPE_F64;
+  job.delim = ',';
+  while ((opt = getopt (argc, argv, "t:T:d:c:Hr:N")) != -1) {
+    switch (opt) {
+    case 't':
+      n = atol (optarg);
+      break;
+    case 'T':
+      for (i = 0; i < 3 && strcmp (optarg, type_name[i]); i++);
+      if (i == 3) {
+	usage (argv[0]);
+	return 1;
+      }
+      job.type = i;
+      break;
+    case 'd':
+      job.delim = strcmp (optarg, "t") == 0 ? '\t' : optarg[0];
+      break;
+    case 'c':
+      ncols = atoi (optarg);
+      break;
+    case 'H':
+      header = 1;
+      break;
+    case 'r':
+      mode = strcmp (optarg, "uring") == 0 ? 1 :
+	strcmp (optarg, "pread") == 0 ? 2 : -1;
+      if (mode < 0) {
+	usage (argv[0]);
+	return 1;
+      }
+      break;
+    case 'N':
+      mode = 3;
+      break;
+    default:
+      usage (argv[0]);
+      return 1;
+    }
+  }
+  if (argc - optind != 2 || job.delim == '\0' || job.delim == '\n') {
+    usage (argv[0]);
+    return 1;
+  }
+  /* sysconf returns -1 on error */
+  nthreads = n < 1 ? 1 : n > FASTCONV_MAX_THREADS ? FASTCONV_MAX_THREADS : n;
+  fd = open (argv[optind], O_RDONLY);
+  if (fd < 0 || fstat (fd, &st) < 0) {
+    perror (argv[optind]);
+    return 1;
+  }
+  job.size = st.st_size;
+  start = get_time ();
+  if (mode == 3) {
+    ret = convert_numa (fd, argv[optind + 1], nthreads, ncols, header,
+			&rows);
+  }
+  else if (mode) {
+    reader.use_uring = mode == 1 && uring_init (FASTCONV_DEPTH) == 0;
+    ret = convert_read (fd, argv[optind + 1], nthreads, ncols, header,
+			&rows);
+  }
+  else {
+    ret = convert_mapped (fd, argv[optind + 1], nthreads, ncols, header,
+			  &rows);
+  }
+  if (ret < 0) {
+    return 1;
+  }
+  for (i = 0; i < nthreads; i++) {
+    bad += workers[i].bad;
+    if (workers[i].error) {
+      fprintf (stderr, "%s: %s\n", argv[optind + 1],
+	       strerror (workers[i].error));
+      ret = 1;
+    }
+  }
+  for (i = 0; i < job.ncols; i++) {
+    close (job.fd[i]);
+  }
+  end = get_time ();
+  printf ("%" PRIu64 " rows, %u columns, %.3f GB in %.3f s, %.2f GB/s%s\n",
+	  rows, job.ncols, job.size / 1e9, end - start,
+	  job.size / 1e9 / (end - start),
+	  mode == 0 ? "" : mode == 3 ? " (numa)" :
+	  reader.use_uring ? " (io_uring)" : " (pread)");
+  if (mode == 3) {
+    print_nodes (nthreads);
+  }
+  if (bad) {
+    printf ("%" PRIu64 " fields are not a number\n", bad);
+  }
+  free (job.fd);
+  close (fd);
+  return ret;
+}
@@ -0,0 +1,349 @@
+/* Copyright 2019 Herman ten Brugge
+ *
+ * Licensed under the Apache License, Version 2.0 <LICENSE-APACHE or
+ * http://www.apache.org/licenses/LICENSE-2.0> or the MIT license
+ * <LICENSE-MIT or http://opensource.org/licenses/MIT>, at your
+ * option. This file may not be copied, modified, or distributed
+ * except according to those terms.
+ */
+
+/* Convert raw binary files with numbers to delimited text. With one
+   input file the values are printed a number of columns per line, with
+   more input files every input is a column. The lines are split in
+   rounds of one chunk per thread. Every thread formats its chunk into
+   its own buffer and the buffers are written in order with one writev
+   per round. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include "fast_convert.h"
+
+#define	FASTFMT_MAX_THREADS	256
+#define	FASTFMT_MAX_INPUTS	1024
+/* values formatted by one thread per round */
+#define	FASTFMT_CHUNK		(1 << 16)
+/* longest value: sign, 17 digits, point, e-308 and delimiter */
+#define	FASTFMT_MAX_LEN		32
+
+#define	TYPE_F32	0
+#define	TYPE_F64	1
+#define	TYPE_I32	2
+#define	TYPE_I64	3
+
+static const char *const type_name[] = { "f32", "f64", "i32", "i64" };
+static const unsigned int type_size[] = { 4, 8, 4, 8 };
+
+static struct fastfmt_job
+{
+  const char *data[FASTFMT_MAX_INPUTS];
+  unsigned int ninputs;
+  uint64_t nvalues;
+  uint64_t nlines;
+  uint64_t chunk_lines;
+  unsigned int ncols;
+  int type;
+  int prec;
+  char delim;
+  unsigned int nthreads;
+  int out;
+  uint64_t written;
+  int error;
+  pthread_barrier_t barrier;
+} job;
+
+static struct fastfmt_worker
+{
+  pthread_t thread;
+  unsigned int id;
+  char *buf;
+  struct iovec *iov;
+} workers[FASTFMT_MAX_THREADS];
+
+static double
+get_time (void)
+{
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static inline char *
+format_value (char *cp, const char *data, uint64_t i)
+{
+  union
+  {
+    float f;
+    double d;
+    int32_t i32;
+    int64_t i64;
+  } v;
+
+  memcpy (&v, data + i * type_size[job.type], type_size[job.type]);
+  switch (job.type) {
+  case TYPE_F32:
+    return cp + fast_ftoa (v.f, job.prec, cp);
+  case TYPE_F64:
+    return cp + fast_dtoa (v.d, job.prec, cp);
+  case TYPE_I32:
+    return cp + fast_sint32 (v.i32, cp);
+  default:
+    return cp + fast_sint64 (v.i64, cp);
+  }
+}
+
+/* Format lines [first, first + n) into buf */
+static size_t
+format_lines (char *buf, uint64_t first, uint64_t n)
+{
+  char *cp = buf;
+  uint64_t line;
+  uint64_t i;
+  uint64_t end;
+  unsigned int col;
+
+  for (line = first; line < first + n; line++) {
+    if (job.ninputs > 1) {
+      for (col = 0; col < job.ninputs; col++) {
+	cp = format_value (cp, job.data[col], line);
+	*cp++ = job.delim;
+      }
+    }
+    else {
+      i = line * job.ncols;
+      end = i + job.ncols < job.nvalues ? i + job.ncols : job.nvalues;
+      for (; i < end; i++) {
+	cp = format_value (cp, job.data[0], i);
+	*cp++ = job.delim;
+      }
+    }
+    cp[-1] = '\n';
+  }
+  return cp - buf;
+}
+
+static int
+write_all (int fd, struct iovec *iov, int cnt)
+{
+  ssize_t len;
+
+  while (cnt) {
+    len = writev (fd, iov, cnt);
+    if (len < 0) {
+      if (errno == EINTR) {
+	continue;
+      }
+      return -1;
+    }
+    while (cnt && (size_t) len >= iov->iov_len) {
+      len -= iov->iov_len;
+      iov++;
+      cnt--;
+    }
+    if (cnt) {
+      iov->iov_base = (char *) iov->iov_base + len;
+      iov->iov_len -= len;
+    }
+  }
+  return 0;
+}
+
+static void *
+format_part (void *arg)
+{
+  struct fastfmt_worker *w = (struct fastfmt_worker *) arg;
+  uint64_t round = job.chunk_lines * job.nthreads;
+  uint64_t first;
+  uint64_t n;
+
+  for (first = 0; first < job.nlines; first += round) {
+    n = first + w->id * job.chunk_lines;
+    n = n < job.nlines ? job.nlines - n : 0;
+    if (n > job.chunk_lines) {
+      n = job.chunk_lines;
+    }
+    w->iov->iov_base = w->buf;
+    w->iov->iov_len =
+      n ? format_lines (w->buf, first + w->id * job.chunk_lines, n) : 0;
+    pthread_barrier_wait (&job.barrier);
+    if (w->id == 0 && job.error == 0) {
+      for (n = 0; n < job.nthreads; n++) {
+	job.written += w->iov[n].iov_len;
+      }
+      if (write_all (job.out, w->iov, job.nthreads) < 0) {
+	job.error = errno;
+      }
+    }
+    pthread_barrier_wait (&job.barrier);
+  }
+  return NULL;
+}
+
+static void
+usage (const char *name)
+{
+  printf ("Usage: %s [options] input...\n", name);
+  printf ("Print raw binary input as text, more inputs are columns\n");
+  printf ("options:\n");
+  printf ("  -t threads  number of threads (default all cores)\n");
+  printf ("  -T type     f32, f64 (default), i32 or i64\n");
+  printf ("  -p prec     precision (default %u for f32, %u for f64)\n",
+	  PREC_FLT_NR, PREC_DBL_NR);
+  printf ("  -d delim    field delimiter, 't' for tab (default ',')\n");
+  printf ("  -c columns  values per line for one input (default 1)\n");
+  printf ("  -o output   output file (default stdout)\n");
+}
+
+int
+main (int argc, char **argv)
+{
+  long n = sysconf (_SC_NPROCESSORS_ONLN);
+  unsigned int nthreads;
+  unsigned int i;
+  int opt;
+  int fd;
+  const char *output = NULL;
+  struct stat st;
+  struct iovec *iov;
+  uint64_t size = 0;
+  double start;
+  double end;
+
+  job.type = TYPE_F64;
+  job.prec = 0;
+  job.delim = ',';
+  job.ncols = 1;
+  job.out = STDOUT_FILENO;
+  while ((opt = getopt (argc, argv, "t:T:p:d:c:o:")) != -1) {
+    switch (opt) {
+    case 't':
+      n = atol (optarg);
+      break;
+    case 'T':
+      for (i = 0; i < 4 && strcmp (optarg, type_name[i]); i++);
+      if (i == 4) {
+	usage (argv[0]);
+	return 1;
+      }
+      job.type = i;
+      break;
+    case 'p':
+      job.prec = atoi (optarg);
+      break;
+    case 'd':
+      job.delim = strcmp (optarg, "t") == 0 ? '\t' : optarg[0];
+      break;
+    case 'c':
+      job.ncols = atoi (optarg);
+      break;
+    case 'o':
+      output = optarg;
+      break;
+    default:
+      usage (argv[0]);
+      return 1;
+    }
+  }
+  job.ninputs = argc - optind;
+  if (job.ninputs == 0 || job.ninputs > FASTFMT_MAX_INPUTS ||
+      job.ncols == 0 || job.delim == '\0') {
+    usage (argv[0]);
+    return 1;
+  }
+  /* precision is limited so a value fits in FASTFMT_MAX_LEN */
+  if (job.prec <= 0 || job.prec > PREC_DBL_NR) {
+    job.prec = job.type == TYPE_F32 ? PREC_FLT_NR : PREC_DBL_NR;
+  }
+  if (job.type == TYPE_F32 && job.prec > PREC_FLT_NR) {
+    job.prec = PREC_FLT_NR;
+  }
+  /* sysconf returns -1 on error */
+  nthreads = n < 1 ? 1 : n > FASTFMT_MAX_THREADS ? FASTFMT_MAX_THREADS : n;
+  start = get_time ();
+  for (i = 0; i < job.ninputs; i++) {
+    fd = open (argv[optind + i], O_RDONLY);
+    if (fd < 0 || fstat (fd, &st) < 0) {
+      perror (argv[optind + i]);
+      return 1;
+    }
+    if (i && (uint64_t) st.st_size / type_size[job.type] != job.nvalues) {
+      fprintf (stderr, "%s: size differs from %s\n", argv[optind + i],
+	       argv[optind]);
+      return 1;
+    }
+    job.nvalues = st.st_size / type_size[job.type];
+    job.data[i] = "";
+    if (st.st_size) {
+      job.data[i] = mmap (NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (job.data[i] == MAP_FAILED) {
+	perror ("mmap");
+	return 1;
+      }
+      madvise ((void *) job.data[i], st.st_size, MADV_SEQUENTIAL);
+    }
+    close (fd);
+    size += st.st_size;
+  }
+  if (job.ninputs > 1) {
+    job.ncols = job.ninputs;
+    job.nlines = job.nvalues;
+  }
+  else {
+    job.nlines = (job.nvalues + job.ncols - 1) / job.ncols;
+  }
+  if (output) {
+    job.out = open (output, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (job.out < 0) {
+      perror (output);
+      return 1;
+    }
+  }
+
+  job.nthreads = nthreads;
+  job.chunk_lines = FASTFMT_CHUNK / job.ncols;
+  if (job.chunk_lines == 0) {
+    job.chunk_lines = 1;
+  }
+  iov = malloc (nthreads * sizeof (struct iovec));
+  pthread_barrier_init (&job.barrier, NULL, nthreads);
+  for (i = 0; i < nthreads; i++) {
+    workers[i].id = i;
+    workers[i].iov = iov + i;
+    workers[i].buf = malloc (job.chunk_lines * job.ncols * FASTFMT_MAX_LEN);
+    if (workers[i].buf == NULL) {
+      perror ("malloc");
+      return 1;
+    }
+  }
+  for (i = 0; i < nthreads; i++) {
+    pthread_create (&workers[i].thread, NULL, format_part, &workers[i]);
+  }
+  for (i = 0; i < nthreads; i++) {
+    pthread_join (workers[i].thread, NULL);
+    free (workers[i].buf);
+  }
+  pthread_barrier_destroy (&job.barrier);
+  free (iov);
+  if (output) {
+    close (job.out);
+  }
+  end = get_time ();
+  if (job.error) {
+    fprintf (stderr, "%s: %s\n", output ? output : "stdout",
+	     strerror (job.error));
+    return 1;
+  }
+  fprintf (stderr, "%" PRIu64 " lines, %.3f GB to %.3f GB text in %.3f s, "
+	   "%.2f GB/s\n", job.nlines, size / 1e9, job.written / 1e9,
+	   end - start, job.written / 1e9 / (end - start));
+  return 0;
+}
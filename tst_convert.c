@@ -13,7 +13,22 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <float.h>
+#include <errno.h>
+#include <unistd.h>
+#include <pthread.h>
 #include "fast_convert.h"
+#include "fast_convert_parallel.h"
+#if defined (__linux__) && !defined (WIN)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#endif
+/* the __float128 tests need libquadmath, see QUAD_LIBS in Makefile */
+#if defined (__SIZEOF_FLOAT128__) && defined (__SIZEOF_INT128__) && \
+    !defined (WIN)
+#define	TST_FLOAT128
+#include <quadmath.h>
+#endif
 
 /* See: https://en.wikipedia.org/wiki/Linear_congruential_generator */
 #define RAND_IA         UINT64_C(0x5851F42D4C957F2D)
@@ -22,8 +37,30 @@
 #define N       	(1<<20)
 #define M       	(N - 1)
 
+#define	VERIFY_BLOCK	(1 << 16)
+#define	VERIFY_MAX	256
+
+#define	CACHE_READS	8
+#define	CACHE_OTHER	(1 << 21)
+
 static char str[N][70];
 
+static struct verify_worker
+{
+  pthread_mutex_t lock;
+  pthread_t thread;
+  uint64_t next;
+  uint64_t end;
+  uint64_t steals;
+  uint64_t fmt_diff;
+  uint64_t parse_diff;
+  uint64_t round_diff;
+} verify_workers[VERIFY_MAX];
+
+static unsigned int verify_nthreads;
+static uint64_t verify_done;
+static pthread_mutex_t verify_print = PTHREAD_MUTEX_INITIALIZER;
+
 static double
 get_time (void)
 {
@@ -91,6 +128,420 @@ init (uint64_t r, unsigned int sign, unsigned int size, unsigned int base,
   return r;
 }
 
+#ifdef FAST_CONVERT_STATS
+static void *
+stats_thread (void *arg)
+{
+  fast_strtos64 ("9223372036854775808", NULL, 10);
+  return arg;
+}
+#endif
+
+static double
+small_to_double (uint32_t bits, int man, int exp)
+{
+  int bias = (1 << (exp - 1)) - 1;
+  int e = (int) (bits >> man) & ((1 << exp) - 1);
+  double m = bits & ((1u << man) - 1);
+  double v;
+
+  if (e == (1 << exp) - 1) {
+    v = m ? NAN : INFINITY;
+  }
+  else if (e) {
+    v = ldexp (m + ldexp (1.0, man), e - bias - man);
+  }
+  else {
+    v = ldexp (m, 1 - bias - man);
+  }
+  return bits >> (man + exp) ? -v : v;
+}
+
+static uint32_t
+small_from_double (double v, int man, int exp)
+{
+  int bias = (1 << (exp - 1)) - 1;
+  uint32_t inf = ((1u << exp) - 1) << man;
+  uint32_t sign = signbit (v) ? 1u << (man + exp) : 0;
+  uint32_t bits;
+  double q;
+  int e;
+  int ulp;
+
+  if (isnan (v)) {
+    return sign | inf | (1u << (man - 1));
+  }
+  frexp (fabs (v), &e);
+  ulp = e - 1 - man;
+  if (ulp < 1 - bias - man) {
+    ulp = 1 - bias - man;
+  }
+  q = rint (ldexp (fabs (v), -ulp));
+  if (q >= ldexp (1.0, man + 2)) {
+    return sign | inf;
+  }
+  bits = (uint32_t) q + (q ? (uint32_t) (ulp + bias + man - 1) << man : 0);
+  return sign | (bits > inf ? inf : bits);
+}
+
+static int
+verify_same (float a, float b)
+{
+  union
+  {
+    uint32_t u;
+    float f;
+  } ta, tb;
+
+  if (isnan (a) || isnan (b)) {
+    return isnan (a) && isnan (b) && signbit (a) == signbit (b);
+  }
+  ta.f = a;
+  tb.f = b;
+  return ta.u == tb.u;
+}
+
+static void
+verify_range (struct verify_worker *w, uint64_t from, uint64_t to)
+{
+  uint64_t i;
+  int diff;
+  char line[100];
+  char line2[100];
+  union
+  {
+    uint32_t u;
+    float f;
+  } tf;
+  float rf;
+  float rl;
+
+  for (i = from; i < to; i++) {
+    tf.u = i;
+    fast_ftoa (tf.f, PREC_FLT_NR, line);
+    sprintf (line2, "%." PREC_FLT "g", tf.f);
+    rf = fast_strtof (line, NULL);
+    rl = strtof (line, NULL);
+    diff = 0;
+    if (strcmp (line, line2)) {
+      w->fmt_diff++;
+      diff = 1;
+    }
+    if (!verify_same (rf, rl)) {
+      w->parse_diff++;
+      diff = 1;
+    }
+    if (!verify_same (rf, tf.f)) {
+      w->round_diff++;
+      diff = 1;
+    }
+    if (diff) {
+      pthread_mutex_lock (&verify_print);
+      printf ("\n%u %s %s %.9g %.9g\n", tf.u, line, line2, rf, rl);
+      pthread_mutex_unlock (&verify_print);
+    }
+  }
+}
+
+static int
+verify_steal (struct verify_worker *w)
+{
+  unsigned int i;
+  uint64_t best;
+  uint64_t mid;
+  struct verify_worker *v;
+
+  for (;;) {
+    v = NULL;
+    best = 0;
+    for (i = 0; i < verify_nthreads; i++) {
+      uint64_t left =
+	__atomic_load_n (&verify_workers[i].end, __ATOMIC_RELAXED) -
+	__atomic_load_n (&verify_workers[i].next, __ATOMIC_RELAXED);
+
+      if (&verify_workers[i] != w && left > best) {
+	best = left;
+	v = &verify_workers[i];
+      }
+    }
+    if (v == NULL) {
+      return 0;
+    }
+    pthread_mutex_lock (&v->lock);
+    if (v->end - v->next <= VERIFY_BLOCK) {
+      /* Too small to split. Let the owner finish it. */
+      pthread_mutex_unlock (&v->lock);
+      for (i = 0; i < verify_nthreads; i++) {
+	if (__atomic_load_n (&verify_workers[i].end, __ATOMIC_RELAXED) -
+	    __atomic_load_n (&verify_workers[i].next, __ATOMIC_RELAXED) >
+	    VERIFY_BLOCK) {
+	  break;
+	}
+      }
+      if (i == verify_nthreads) {
+	return 0;
+      }
+      continue;
+    }
+    mid = v->next + (v->end - v->next) / 2;
+    pthread_mutex_lock (&w->lock);
+    w->next = mid;
+    w->end = v->end;
+    w->steals++;
+    pthread_mutex_unlock (&w->lock);
+    v->end = mid;
+    pthread_mutex_unlock (&v->lock);
+    return 1;
+  }
+}
+
+static void *
+verify_thread (void *arg)
+{
+  struct verify_worker *w = (struct verify_worker *) arg;
+  uint64_t from;
+  uint64_t to;
+
+  do {
+    for (;;) {
+      pthread_mutex_lock (&w->lock);
+      from = w->next;
+      to = from + VERIFY_BLOCK < w->end ? from + VERIFY_BLOCK : w->end;
+      w->next = to;
+      pthread_mutex_unlock (&w->lock);
+      if (from == to) {
+	break;
+      }
+      verify_range (w, from, to);
+      __atomic_fetch_add (&verify_done, to - from, __ATOMIC_RELAXED);
+    }
+  } while (verify_steal (w));
+  return NULL;
+}
+
+static uint64_t
+verify_all (unsigned int nthreads)
+{
+  unsigned int i;
+  uint64_t total = UINT64_C (1) << 32;
+  uint64_t done;
+  uint64_t steals = 0;
+  uint64_t fmt_diff = 0;
+  uint64_t parse_diff = 0;
+  uint64_t round_diff = 0;
+  double start = get_time ();
+  double now;
+
+  if (nthreads == 0) {
+#ifdef WIN
+    long n = pthread_num_processors_np ();
+#else
+    long n = sysconf (_SC_NPROCESSORS_ONLN);
+#endif
+
+    /* sysconf returns -1 on error */
+    nthreads = n > 0 ? n : 1;
+  }
+  if (nthreads > VERIFY_MAX) {
+    nthreads = VERIFY_MAX;
+  }
+  verify_nthreads = nthreads;
+  verify_done = 0;
+  for (i = 0; i < nthreads; i++) {
+    pthread_mutex_init (&verify_workers[i].lock, NULL);
+    verify_workers[i].next = total * i / nthreads;
+    verify_workers[i].end = total * (i + 1) / nthreads;
+  }
+  for (i = 0; i < nthreads; i++) {
+    pthread_create (&verify_workers[i].thread, NULL, verify_thread,
+		    &verify_workers[i]);
+  }
+  do {
+    sleep (1);
+    done = __atomic_load_n (&verify_done, __ATOMIC_RELAXED);
+    now = get_time ();
+    pthread_mutex_lock (&verify_print);
+    printf ("\r%6.2f%% %8.2f Mvalues/s", 100.0 * done / total,
+	    done / ((now - start) / 1e3));
+    fflush (stdout);
+    pthread_mutex_unlock (&verify_print);
+  } while (done < total);
+  printf ("\n");
+  for (i = 0; i < nthreads; i++) {
+    pthread_join (verify_workers[i].thread, NULL);
+    pthread_mutex_destroy (&verify_workers[i].lock);
+    steals += verify_workers[i].steals;
+    fmt_diff += verify_workers[i].fmt_diff;
+    parse_diff += verify_workers[i].parse_diff;
+    round_diff += verify_workers[i].round_diff;
+  }
+  printf ("threads: %u, steals: %" PRIu64 "\n", nthreads, steals);
+  printf ("fast_ftoa != sprintf: %" PRIu64 "\n", fmt_diff);
+  printf ("fast_strtof != strtof: %" PRIu64 "\n", parse_diff);
+  printf ("fast_strtof (fast_ftoa) != value: %" PRIu64 "\n", round_diff);
+  return fmt_diff + parse_diff + round_diff;
+}
+
+static int
+cache_counter (int last_level)
+{
+#if defined (__linux__) && !defined (WIN)
+  struct perf_event_attr pe;
+
+  memset (&pe, 0, sizeof (pe));
+  pe.size = sizeof (pe);
+  pe.type = PERF_TYPE_HW_CACHE;
+  pe.config = (last_level ? PERF_COUNT_HW_CACHE_LL : PERF_COUNT_HW_CACHE_L1D) |
+    (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+    (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+  pe.exclude_kernel = 1;
+  pe.exclude_hv = 1;
+  return syscall (SYS_perf_event_open, &pe, 0, -1, -1, 0);
+#else
+  return -1;
+#endif
+}
+
+static uint64_t
+cache_read (int fd)
+{
+  uint64_t v = 0;
+
+  if (fd >= 0 && read (fd, &v, sizeof (v)) != sizeof (v)) {
+    v = 0;
+  }
+  return v;
+}
+
+static void
+cache_print (int fd, uint64_t m0, uint64_t m1, uint64_t count)
+{
+  char tmp[32];
+
+  if (fd >= 0) {
+    sprintf (tmp, "%.3f", ((double) m1 - (double) m0) / count);
+  }
+  else {
+    strcpy (tmp, "n/a");
+  }
+  printf (" %14s", tmp);
+}
+
+/* Mixed workload: every fast_dtoa/fast_strtod pair is surrounded by
+   CACHE_READS random reads from a working set of other code (a json
+   parser for example). The loop is run with and without the
+   conversions and the difference is the cost of the conversions under
+   cache pressure. Cache misses need perf events, else n/a is shown. */
+static void
+cache_bench (uint64_t r)
+{
+  static const unsigned int wset[] = {
+    0, 16 << 10, 32 << 10, 256 << 10, 1 << 20, CACHE_OTHER
+  };
+  static unsigned char other[CACHE_OTHER];
+  static double dv[N / 4];
+  uint64_t count = N / 4;
+  uint64_t i;
+  uint64_t x;
+  uint64_t m[2][4];
+  unsigned int k;
+  unsigned int w;
+  unsigned int pass;
+  int fd[2];
+  double t[2];
+  uint64_t sum = 0;
+  char line[64];
+  union
+  {
+    double d;
+    uint64_t u;
+  } td;
+
+  for (i = 0; i < count; i++) {
+    r = r * RAND_IA + RAND_IC;
+    td.u = r;
+    if (((td.u >> 52) & 0x7FF) == 0x7FF) {
+      td.u ^= UINT64_C (1) << 62;
+    }
+    dv[i] = td.d;
+    fast_dtoa (dv[i], PREC_DBL_NR, str[i]);
+  }
+  memset (other, 1, sizeof (other));
+  fd[0] = cache_counter (0);
+  fd[1] = cache_counter (1);
+  printf ("working set  ns/conv  L1d miss/conv   LL miss/conv\n");
+  for (w = 0; w < sizeof (wset) / sizeof (wset[0]); w++) {
+    for (pass = 0; pass < 2; pass++) {
+      x = r;
+      m[0][pass * 2] = cache_read (fd[0]);
+      m[1][pass * 2] = cache_read (fd[1]);
+      t[pass] = get_time ();
+      for (i = 0; i < count; i++) {
+	if (wset[w]) {
+	  for (k = 0; k < CACHE_READS; k++) {
+	    x = x * RAND_IA + RAND_IC;
+	    sum += other[(x >> 32) & (wset[w] - 64)];
+	  }
+	}
+	if (pass) {
+	  fast_dtoa (dv[i], PREC_DBL_NR, line);
+	  sum += (fast_strtod (str[i], NULL) < 0.0) + line[0];
+	}
+      }
+      t[pass] = get_time () - t[pass];
+      m[0][pass * 2 + 1] = cache_read (fd[0]);
+      m[1][pass * 2 + 1] = cache_read (fd[1]);
+    }
+    printf ("%8u KB %8.2f", wset[w] >> 10, (t[1] - t[0]) / count);
+    for (k = 0; k < 2; k++) {
+      cache_print (fd[k], m[k][1] - m[k][0] + m[k][2], m[k][3], count);
+    }
+    printf ("\n");
+  }
+  printf ("%" PRIu64 "\n", sum);
+  for (k = 0; k < 2; k++) {
+    if (fd[k] >= 0) {
+      close (fd[k]);
+    }
+  }
+}
+
+struct num_list
+{
+  double *v;
+  size_t n;
+  size_t max;
+};
+
+static void
+num_list_add (void *arg, double v)
+{
+  struct num_list *l = (struct num_list *) arg;
+
+  if (l->n < l->max) {
+    l->v[l->n] = v;
+  }
+  l->n++;
+}
+
+struct scan_list
+{
+  struct fast_scan_number *num;
+  size_t n;
+  size_t max;
+};
+
+static void
+scan_list_add (void *arg, const struct fast_scan_number *num)
+{
+  struct scan_list *l = (struct scan_list *) arg;
+
+  if (l->n < l->max) {
+    l->num[l->n] = *num;
+  }
+  l->n++;
+}
+
 int
 main (int argc, char **argv)
 {
@@ -107,6 +558,7 @@ main (int argc, char **argv)
   uint64_t r = 1234567890;
   uint64_t max = UINT64_C (4294967295);
   char *endptr;
+  char *endptr2;
   double start;
   double end;
   union
@@ -243,6 +695,40 @@ main (int argc, char **argv)
     0x0030000000000000,
     0x7FEFFFFFFFFFFFFF,
   };
+  static const struct
+  {
+    const char *s;
+    int base;
+    enum fast_convert_status st[4];	/* s32, u32, s64, u64 */
+  } sttst[] = {
+    {"123", 0, {FAST_CONVERT_OK, FAST_CONVERT_OK,
+		FAST_CONVERT_OK, FAST_CONVERT_OK}},
+    {"", 0, {FAST_CONVERT_NO_DIGITS, FAST_CONVERT_NO_DIGITS,
+	     FAST_CONVERT_NO_DIGITS, FAST_CONVERT_NO_DIGITS}},
+    {"  -", 10, {FAST_CONVERT_NO_DIGITS, FAST_CONVERT_NO_DIGITS,
+		 FAST_CONVERT_NO_DIGITS, FAST_CONVERT_NO_DIGITS}},
+    {"9", 8, {FAST_CONVERT_NO_DIGITS, FAST_CONVERT_NO_DIGITS,
+	      FAST_CONVERT_NO_DIGITS, FAST_CONVERT_NO_DIGITS}},
+    {"12ab", 10, {FAST_CONVERT_TRAILING, FAST_CONVERT_TRAILING,
+		  FAST_CONVERT_TRAILING, FAST_CONVERT_TRAILING}},
+    {"0x", 0, {FAST_CONVERT_TRAILING, FAST_CONVERT_TRAILING,
+	       FAST_CONVERT_TRAILING, FAST_CONVERT_TRAILING}},
+    {"zz", 36, {FAST_CONVERT_OK, FAST_CONVERT_OK,
+		FAST_CONVERT_OK, FAST_CONVERT_OK}},
+    {"4294967296", 10, {FAST_CONVERT_OVERFLOW, FAST_CONVERT_OVERFLOW,
+			FAST_CONVERT_OK, FAST_CONVERT_OK}},
+    {"0x1ffffffff", 0, {FAST_CONVERT_OVERFLOW, FAST_CONVERT_OVERFLOW,
+			FAST_CONVERT_OK, FAST_CONVERT_OK}},
+    {"18446744073709551616", 0, {FAST_CONVERT_OVERFLOW, FAST_CONVERT_OVERFLOW,
+				 FAST_CONVERT_OVERFLOW,
+				 FAST_CONVERT_OVERFLOW}},
+    {"-9223372036854775809", 0, {FAST_CONVERT_OVERFLOW,
+				 FAST_CONVERT_NO_DIGITS,
+				 FAST_CONVERT_OVERFLOW,
+				 FAST_CONVERT_NO_DIGITS}}
+  };
+  enum fast_convert_status st[4];
+  static const int esize[] = { 18, 25, 40, 100, 800 };
   char line[1000];
   char line2[1000];
 
@@ -682,6 +1168,181 @@ main (int argc, char **argv)
       }
     }
   }
+  if (fast_base_uint64 (0, line, 16, 0) != 1 || strcmp (line, "0") ||
+      fast_base_uint64 (UINT64_C (18446744073709551615), line, 16, 1) != 16 ||
+      strcmp (line, "FFFFFFFFFFFFFFFF") ||
+      fast_base_uint64 (UINT64_C (0x123456789abcdef), line, 16, 0) != 15 ||
+      strcmp (line, "123456789abcdef") ||
+      fast_base_uint64 (UINT64_C (18446744073709551615), line, 8, 0) != 22 ||
+      strcmp (line, "1777777777777777777777") ||
+      fast_base_uint32 (5, line, 2, 0) != 3 || strcmp (line, "101") ||
+      fast_base_uint32 (1023, line, 32, 1) != 2 || strcmp (line, "VV") ||
+      fast_base_sint64 (INT64_MIN, line, 16, 0) != 17 ||
+      strcmp (line, "-8000000000000000") ||
+      fast_base_sint32 (-4, line, 4, 0) != 3 || strcmp (line, "-10")) {
+    printf ("fast_base_uint64: power of two base failed %s\n", line);
+  }
+  if (fast_base_uint64 (UINT64_C (18446744073709551615), line, 36, 0) != 13 ||
+      strcmp (line, "3w5e11264sgsf") ||
+      fast_base_uint64 (UINT64_C (18446744073709551615), line, 3, 0) != 41 ||
+      strcmp (line, "11112220022122120101211020120210210211220") ||
+      fast_base_sint64 (INT64_MIN, line, 7, 0) != 24 ||
+      strcmp (line, "-22341010611245052052301") ||
+      fast_base_uint32 (0, line, 36, 0) != 1 || strcmp (line, "0")) {
+    printf ("fast_base_uint64: chunked base failed %s\n", line);
+  }
+  if (fast_base_sint32 (-5, line, 37, 0) != 1 || strcmp (line, "-") ||
+      fast_base_sint64 (-5, line, 1, 0) != 1 || strcmp (line, "-") ||
+      fast_base_sint64 (5, line, 1, 0) != 0 || strcmp (line, "") ||
+      fast_base_uint32 (5, line, 0, 0) != 0 || strcmp (line, "")) {
+    printf ("fast_base_sint64: invalid base failed %s\n", line);
+  }
+  for (i = 0; i < 10000; i++) {
+    static const char *hfmt[] = {
+      "%" PRIx64, "%" PRIX64, "0x%" PRIx64, "0X%" PRIx64 "g", "000%" PRIx64,
+      "%" PRIx64 "fff"
+    };
+    static uint64_t hr = 1;
+    uint64_t h;
+
+    hr = hr * RAND_IA + RAND_IC;
+    h = hr >> (i % 64);
+    sprintf (line, hfmt[i % 6], h);
+    errno = 0;
+    h = strtoull (line, &endptr2, i & 8 ? 16 : 0);
+    if (errno == 0 &&
+	(fast_strtou64 (line, &endptr, i & 8 ? 16 : 0) != h ||
+	 endptr != endptr2)) {
+      printf ("fast_strtou64: hex failed %s\n", line);
+    }
+    if (errno == 0 && (h >> 32) == 0 &&
+	(fast_strtou32 (line, &endptr, i & 8 ? 16 : 0) != h ||
+	 endptr != endptr2)) {
+      printf ("fast_strtou32: hex failed %s\n", line);
+    }
+  }
+  if (fast_strtou64_status ("0x00000000123456789abcdef01", &endptr, 0,
+			    &st[3]) != UINT64_C (0x123456789abcdef0) ||
+      *endptr != '1' || st[3] != FAST_CONVERT_OVERFLOW ||
+      fast_strtou32_status ("fedcba987", &endptr, 16,
+			    &st[1]) != 0xfedcba98 ||
+      *endptr != '7' || st[1] != FAST_CONVERT_OVERFLOW ||
+      fast_strtou64 ("0x0", &endptr, 16) != 0 || *endptr != '\0' ||
+      fast_strtou64 ("0xg", &endptr, 16) != 0 || *endptr != 'x') {
+    printf ("fast_strtou64: hex overflow failed\n");
+  }
+  {
+    /* digits up to and across a page end use the byte loop */
+    static char page[3 * 4096];
+    char *p = page + 4096 - ((uintptr_t) page & 4095);
+
+    memset (page, 'a', sizeof (page));
+    for (i = 4096 - 24; i < 4096 + 8; i++) {
+      memcpy (p + i, "123456789abcdef0g", 17);
+      if (fast_strtou64 (p + i, &endptr, 16) !=
+	  UINT64_C (0x123456789abcdef0) || endptr != p + i + 16) {
+	printf ("fast_strtou64: hex at page offset %u failed\n",
+		(unsigned int) i);
+      }
+      memset (p + i, 'a', 17);
+    }
+  }
+  for (i = 0; i < sizeof (sttst) / sizeof (sttst[0]); i++) {
+    errno = 0;
+    fast_strtos32_status (sttst[i].s, &endptr, sttst[i].base, &st[0]);
+    fast_strtou32_status (sttst[i].s, &endptr, sttst[i].base, &st[1]);
+    fast_strtos64_status (sttst[i].s, &endptr, sttst[i].base, &st[2]);
+    fast_strtou64_status (sttst[i].s, &endptr, sttst[i].base, &st[3]);
+    for (j = 0; j < 4; j++) {
+      if (st[j] != sttst[i].st[j]) {
+	printf ("fast_strto*_status: failed %s %u: %d\n", sttst[i].s, j,
+		st[j]);
+      }
+    }
+    if (errno) {
+      printf ("fast_strto*_status: errno changed for %s\n", sttst[i].s);
+    }
+  }
+  if (fast_strtos32_status ("-2147483648", &endptr, 10, &st[0]) !=
+      INT32_MIN || st[0] != FAST_CONVERT_OK ||
+      fast_strtou64_status ("0xffffffffffffffff0", &endptr, 0, &st[3]) !=
+      UINT64_MAX || st[3] != FAST_CONVERT_OVERFLOW || *endptr != '0') {
+    printf ("fast_strto*_status: failed value\n");
+  }
+#ifdef __SIZEOF_INT128__
+  {
+    unsigned __int128 u128 = ~(unsigned __int128) 0;
+    __int128 s128 = (__int128) ((unsigned __int128) 1 << 127);
+    enum fast_convert_status st128;
+    uint64_t r128 = 1;
+
+    if (fast_uint128 (u128, line) != 39 ||
+	strcmp (line, "340282366920938463463374607431768211455") ||
+	fast_sint128 (s128, line) != 40 ||
+	strcmp (line, "-170141183460469231731687303715884105728") ||
+	fast_base_uint128 (u128, line, 16, 0) != 32 ||
+	strcmp (line, "ffffffffffffffffffffffffffffffff") ||
+	fast_base_sint128 (s128, line, 16, 1) != 33 ||
+	strcmp (line, "-80000000000000000000000000000000") ||
+	fast_uint128 ((unsigned __int128) UINT64_C (10000000000000000000) *
+		      UINT64_C (10000000000000000000), line) != 39 ||
+	strcmp (line, "100000000000000000000000000000000000000")) {
+      printf ("fast_uint128: conversion failed %s\n", line);
+    }
+    if (fast_strtou128 ("340282366920938463463374607431768211455", &endptr,
+			10) != u128 || *endptr != '\0' ||
+	fast_strtos128 ("-170141183460469231731687303715884105728", &endptr,
+			0) != s128 || *endptr != '\0' ||
+	fast_strtou128 ("0xffffffffffffffffffffffffffffffff", &endptr,
+			0) != u128 || *endptr != '\0') {
+      printf ("fast_strtou128: conversion failed\n");
+    }
+    fast_strtou128_status ("340282366920938463463374607431768211456",
+			   &endptr, 10, &st128);
+    if (*endptr != '6' || st128 != FAST_CONVERT_OVERFLOW) {
+      printf ("fast_strtou128: failed endptr %s\n", endptr);
+    }
+    fast_strtos128_status ("170141183460469231731687303715884105728",
+			   &endptr, 10, &st128);
+    if (*endptr != '8' || st128 != FAST_CONVERT_OVERFLOW) {
+      printf ("fast_strtos128: failed endptr %s\n", endptr);
+    }
+    for (i = 0; i < 1000; i++) {
+      r128 = r128 * RAND_IA + RAND_IC;
+      u128 = ((unsigned __int128) r128 << 64) >> (i % 128);
+      r128 = r128 * RAND_IA + RAND_IC;
+      u128 |= r128 >> (i % 64);
+      len = 0;
+      do {
+	line2[len++] = '0' + (int) (u128 % 10);
+      } while ((u128 /= 10) != 0);
+      for (j = 0; j < len; j++) {
+	line[j] = line2[len - 1 - j];
+      }
+      line[len] = '\0';
+      u128 = fast_strtou128 (line, &endptr, 10);
+      if (fast_uint128 (u128, line2) != len || strcmp (line, line2) ||
+	  *endptr != '\0') {
+	printf ("fast_uint128: conversion failed for %s %s\n", line, line2);
+      }
+      for (j = 2; j <= 36; j++) {
+	s128 = (__int128) u128 >> (i & 1);
+	len = fast_base_sint128 (s128, line, j, i & 2);
+	if (fast_strtos128 (line, &endptr, j) != s128 ||
+	    *endptr != '\0' || len != strlen (line)) {
+	  printf ("fast_base_sint128: conversion failed for %s(%u)\n", line,
+		  j);
+	}
+	len = fast_base_uint128 (u128, line, j, i & 2);
+	if (fast_strtou128 (line, &endptr, j) != u128 ||
+	    *endptr != '\0' || len != strlen (line)) {
+	  printf ("fast_base_uint128: conversion failed for %s(%u)\n", line,
+		  j);
+	}
+      }
+    }
+  }
+#endif
   for (i = 0; i < sizeof (ftst) / sizeof (ftst[0]); i++) {
     tf.u = ftst[i];
     fast_ftoa (tf.f, PREC_FLT_NR, line);
@@ -733,9 +1394,80 @@ main (int argc, char **argv)
       fast_dtoa (107696295750000, 10, line) != 15 ||
       strcmp (line, "1.076962958e+14") ||
       fast_dtoa (9.5202756046990724e-14, 1, line) != 5 ||
-      strcmp (line, "1e-13")) {
+      strcmp (line, "1e-13") ||
+      fast_dtoa (-9007199254740991.0, PREC_DBL_NR, line) != 17 ||
+      strcmp (line, "-9007199254740991") ||
+      fast_dtoa (9007199254740992.0, PREC_DBL_NR, line) != 16 ||
+      strcmp (line, "9007199254740992") ||
+      fast_dtoa (1e15, 16, line) != 16 ||
+      strcmp (line, "1000000000000000") ||
+      fast_dtoa (1e15, 15, line) != 5 ||
+      strcmp (line, "1e+15") ||
+      fast_dtoa (4503599627370497.0, 30, line) != 16 ||
+      strcmp (line, "4503599627370497")) {
     printf ("fast_dtoa: size failed: %s\n", line);
   }
+  for (i = 0; i < sizeof (ftst) / sizeof (ftst[0]); i++) {
+    tf.u = ftst[i];
+    len = fast_ftoa_p6 (tf.f, line);
+    fast_ftoa (tf.f, 6, line2);
+    if (strcmp (line, line2) || len != strlen (line2)) {
+      printf ("fast_ftoa_p6: failed 0x%08x %s\n", ftst[i], line);
+    }
+  }
+  for (i = 0; i < sizeof (dtst) / sizeof (dtst[0]); i++) {
+    td.ul = dtst[i];
+    len = fast_dtoa_p6 (td.d, line);
+    fast_dtoa (td.d, 6, line2);
+    if (strcmp (line, line2) || len != strlen (line2)) {
+      printf ("fast_dtoa_p6: failed 0x%016" PRIx64 " %s\n", dtst[i], line);
+    }
+    len = fast_dtoa_p15 (td.d, line);
+    fast_dtoa (td.d, 15, line2);
+    if (strcmp (line, line2) || len != strlen (line2)) {
+      printf ("fast_dtoa_p15: failed 0x%016" PRIx64 " %s\n", dtst[i], line);
+    }
+  }
+  if (fast_dtoa_p6 (0.1, line) != 3 || strcmp (line, "0.1") ||
+      fast_dtoa_p6 (999999.5, line) != 5 || strcmp (line, "1e+06") ||
+      fast_dtoa_p15 (0.1 + 0.2, line) != 3 || strcmp (line, "0.3") ||
+      fast_dtoa_p6 (123456, line) != 6 || strcmp (line, "123456") ||
+      fast_dtoa_p6 (1234567, line) != 11 || strcmp (line, "1.23457e+06") ||
+      fast_dtoa_p15 (-9007199254740991.0, line) != 21 ||
+      strcmp (line, "-9.00719925474099e+15") ||
+      fast_ftoa_p6 (3.14159274f, line) != 7 || strcmp (line, "3.14159")) {
+    printf ("fast_dtoa_p6/p15: failed: %s\n", line);
+  }
+  for (i = 0; i < sizeof (esize) / sizeof (esize[0]); i++) {
+    for (j = 0; j < sizeof (ftst) / sizeof (ftst[0]); j++) {
+      tf.u = ftst[j];
+      len = fast_ftoa (tf.f, esize[i], line);
+      sprintf (line2, "%.*g", esize[i], tf.f);
+      if (strcmp (line, line2) || len != strlen (line2)) {
+	printf ("fast_ftoa: exact failed 0x%08x %d %s\n", ftst[j],
+		esize[i], line);
+      }
+    }
+    for (j = 0; j < sizeof (dtst) / sizeof (dtst[0]); j++) {
+      td.ul = dtst[j];
+      len = fast_dtoa (td.d, esize[i], line);
+      sprintf (line2, "%.*g", esize[i], td.d);
+      if (strcmp (line, line2) || len != strlen (line2)) {
+	printf ("fast_dtoa: exact failed 0x%016" PRIx64 " %d %s\n",
+		dtst[j], esize[i], line);
+      }
+    }
+  }
+  if (fast_dtoa (0.5, 40, line) != 3 ||
+      strcmp (line, "0.5") ||
+      fast_dtoa (0.1, 20, line) != 22 ||
+      strcmp (line, "0.10000000000000000555") ||
+      fast_dtoa (1e23, 30, line) != 23 ||
+      strcmp (line, "99999999999999991611392") ||
+      fast_dtoa (-1.0 / 1024 / 1024 / 1024, 20, line) != 26 ||
+      strcmp (line, "-9.3132257461547851562e-10")) {
+    printf ("fast_dtoa: exact failed: %s\n", line);
+  }
   for (i = 0; i < sizeof (ftst) / sizeof (ftst[0]); i++) {
     tf.u = ftst[i];
 #ifdef WIN
@@ -918,6 +1650,532 @@ main (int argc, char **argv)
       *endptr != '\0') {
     printf ("fast_strtod: conversion failed %s\n", endptr);
   }
+  if (fast_htoa (0x3C00, line) != 1 || strcmp (line, "1") ||
+      fast_htoa (0x7BFF, line) != 8 || strcmp (line, "6.55e+04") ||
+      fast_htoa (0x0001, line) != 5 || strcmp (line, "6e-08") ||
+      fast_htoa (0x3555, line) != 6 || strcmp (line, "0.3333") ||
+      fast_htoa (0xFC00, line) != 4 || strcmp (line, "-inf") ||
+      fast_htoa (0x8000, line) != 2 || strcmp (line, "-0")) {
+    printf ("fast_htoa: failed %s\n", line);
+  }
+  if (fast_bf16toa (0x3F80, line) != 1 || strcmp (line, "1") ||
+      fast_bf16toa (0x4049, line) != 4 || strcmp (line, "3.14") ||
+      fast_bf16toa (0x7F7F, line) != 8 || strcmp (line, "3.39e+38") ||
+      fast_bf16toa (0x0001, line) != 5 || strcmp (line, "9e-41")) {
+    printf ("fast_bf16toa: failed %s\n", line);
+  }
+  if (fast_strtoh ("1.00048828125", &endptr) != 0x3C00 || *endptr ||
+      fast_strtoh ("1.00048828125000001", &endptr) != 0x3C01 || *endptr ||
+      fast_strtoh ("1.0004882812499999999", &endptr) != 0x3C00 ||
+      fast_strtoh ("1.00146484375", &endptr) != 0x3C02 ||
+      fast_strtoh ("0.0146484375e-1", &endptr) != 0x1600 ||
+      fast_strtoh ("65520", &endptr) != 0x7C00 ||
+      fast_strtoh ("65519.99", &endptr) != 0x7BFF ||
+      fast_strtoh ("-2.98023223876953125e-8", &endptr) != 0x8000 ||
+      fast_strtoh ("2.98023223876953125000001e-8", &endptr) != 0x0001 ||
+      fast_strtoh ("-nan", &endptr) != 0xFE00 || *endptr) {
+    printf ("fast_strtoh: failed %s\n", endptr);
+  }
+  if (fast_strtobf16 ("1.00390625", &endptr) != 0x3F80 || *endptr ||
+      fast_strtobf16 ("1.003906250000000001", &endptr) != 0x3F81 ||
+      fast_strtobf16 ("1e39", &endptr) != 0x7F80 ||
+      fast_strtobf16 ("3.14", &endptr) != 0x4049) {
+    printf ("fast_strtobf16: failed %s\n", endptr);
+  }
+  /* hex input that is a tie after rounding to double */
+  if (fast_strtoh ("0x1.002000000000000001p0", NULL) != 0x3C01 ||
+      fast_strtoh ("0x1.005fffffffffffffffp0", NULL) != 0x3C01 ||
+      fast_strtoh ("-0x0.8030000000000000000001p1", NULL) != 0xBC02 ||
+      fast_strtoh ("0x1.002p0", NULL) != 0x3C00 ||
+      fast_strtobf16 ("0x1.01000000000000001p0", NULL) != 0x3F81 ||
+      fast_strtobf16 ("0x101.00000000000000001p-8", NULL) != 0x3F81) {
+    printf ("fast_strtoh: hex tie failed\n");
+  }
+  {
+    static const long double ldtst[] = {
+      1.0L / 3.0L, 0.1L, -2.5L, 1e4000L, 123456789012345678901.0L,
+      LDBL_MAX, LDBL_MIN, LDBL_MIN / 3.0L, LDBL_TRUE_MIN, 0.0L, -0.0L,
+      INFINITY, -INFINITY, NAN
+    };
+    static const int ldsize[] = { 1, 5, PREC_LDBL_NR, 30, 60 };
+    static const char *const ldhex[] = {
+      "0x1.0000000000000002p0", "0x1.fffffffffffffffep16383",
+      "0x1.00000000000000008p0", "0x1.00000000000000018p0",
+      "0x1.000000000000000080000000000000000001p0",
+      "-0x1.fffffffffffffffffp0", "0x1.ffffffffffffffffp16383",
+      "0x1p-16445", "0x1p-16446", "0x1.8p-16446", "0x1.0000000001p-16446",
+      "0x0.00000000000000000000000000000000001p-100", "0xabcdef0123456789.ap3"
+    };
+    long double ld;
+
+    for (i = 0; i < sizeof (ldtst) / sizeof (ldtst[0]); i++) {
+      for (j = 0; j < sizeof (ldsize) / sizeof (ldsize[0]); j++) {
+	len = fast_ldtoa (ldtst[i], ldsize[j], line);
+	sprintf (line2, "%.*Lg", ldsize[j], ldtst[i]);
+	if (len != strlen (line) || strcmp (line, line2)) {
+	  printf ("fast_ldtoa: failed %s %s\n", line, line2);
+	}
+      }
+      sprintf (line, "%." PREC_LDBL "Lg", ldtst[i]);
+      ld = fast_strtold (line, &endptr);
+      if ((ld != ldtst[i] && !isnan (ld)) || *endptr ||
+	  signbit (ld) != signbit (ldtst[i])) {
+	printf ("fast_strtold: failed %s\n", line);
+      }
+    }
+    /* 1 + 2^-64 is halfway between 1 and 1 + 2^-63 */
+    if (fast_strtold
+	("1.0000000000000000000542101086242752217003726400434970855712890625",
+	 &endptr) != 1.0L || *endptr ||
+	fast_strtold
+	("1.00000000000000000005421010862427522170037264004349708557128906251",
+	 &endptr) != 1.0L + LDBL_EPSILON || *endptr ||
+	fast_strtold ("0x1.8p-16440", &endptr) != ldexpl (3.0L, -16441) ||
+	fast_strtold ("1e5000", &endptr) != INFINITY ||
+	fast_strtold ("-1e-5000", &endptr) != 0.0L) {
+      printf ("fast_strtold: failed %s\n", endptr);
+    }
+    /* hex needs 17 digits for 64 bits, ties and sticky digits */
+    for (i = 0; i < sizeof (ldhex) / sizeof (ldhex[0]); i++) {
+      ld = fast_strtold (ldhex[i], &endptr);
+      if (memcmp (&ld, &(long double) { strtold (ldhex[i], &endptr2) }, 10)
+	  || endptr != endptr2) {
+	printf ("fast_strtold: failed %s\n", ldhex[i]);
+      }
+    }
+  }
+#ifdef TST_FLOAT128
+  {
+    static const int qsize[] = { 1, 7, PREC_FLT128_NR, 50 };
+    __float128 qtst[] = {
+      1.0Q / 3.0Q, 0.1Q, -2.5Q, 1e4000Q, FLT128_MAX, FLT128_MIN,
+      FLT128_MIN / 3.0Q, FLT128_DENORM_MIN, 0.0Q, -0.0Q,
+      1.0Q / 0.0Q, -1.0Q / 0.0Q
+    };
+    __float128 q;
+
+    for (i = 0; i < sizeof (qtst) / sizeof (qtst[0]); i++) {
+      for (j = 0; j < sizeof (qsize) / sizeof (qsize[0]); j++) {
+	len = fast_qtoa (qtst[i], qsize[j], line);
+	quadmath_snprintf (line2, sizeof (line2), "%.*Qg", qsize[j],
+			   qtst[i]);
+	if (len != strlen (line) || strcmp (line, line2)) {
+	  printf ("fast_qtoa: failed %s %s\n", line, line2);
+	}
+      }
+      quadmath_snprintf (line, sizeof (line), "%." PREC_FLT128 "Qg",
+			 qtst[i]);
+      q = fast_strtoq (line, &endptr);
+      if (memcmp (&q, &qtst[i], sizeof (q)) || *endptr) {
+	printf ("fast_strtoq: failed %s\n", line);
+      }
+      quadmath_snprintf (line, sizeof (line), "%Qa", qtst[i]);
+      q = fast_strtoq (line, &endptr);
+      if (memcmp (&q, &qtst[i], sizeof (q)) || *endptr) {
+	printf ("fast_strtoq: failed %s\n", line);
+      }
+    }
+    /* 1 + 2^-113 is halfway between 1 and 1 + 2^-112 */
+    if (fast_strtoq ("1.000000000000000000000000000000000096296497219361792"
+		     "65279889712924636592690508241076940976199693977832794"
+		     "189453125", &endptr) != 1.0Q || *endptr ||
+	fast_strtoq ("1.000000000000000000000000000000000096296497219361792"
+		     "65279889712924636592690508241076940976199693977832794"
+		     "1894531251", &endptr) != 1.0Q + FLT128_EPSILON ||
+	fast_strtoq ("0x1.00000000000000000000000000008p0", &endptr) != 1.0Q
+	|| fast_strtoq ("0x1.000000000000000000000000000081p0",
+			&endptr) != 1.0Q + FLT128_EPSILON ||
+	fast_strtoq ("1e5000", &endptr) != 1.0Q / 0.0Q) {
+      printf ("fast_strtoq: failed %s\n", endptr);
+    }
+  }
+#endif
+  /* overflow sets ERANGE like strtod */
+  {
+    static const char *const big[] = { "1e39", "0x1p2000" };
+    static const char *const bigd[] = { "1e309", "0x1p2000" };
+
+    for (i = 0; i < sizeof (big) / sizeof (big[0]); i++) {
+      errno = 0;
+      fast_strtof (big[i], NULL);
+      if (errno != ERANGE) {
+	printf ("fast_strtof: no ERANGE for %s\n", big[i]);
+      }
+      errno = 0;
+      fast_strtod (bigd[i], NULL);
+      if (errno != ERANGE) {
+	printf ("fast_strtod: no ERANGE for %s\n", bigd[i]);
+      }
+    }
+    errno = 0;
+    fast_strtold ("1e5000", NULL);
+    if (errno != ERANGE) {
+      printf ("fast_strtold: no ERANGE for 1e5000\n");
+    }
+#ifdef TST_FLOAT128
+    errno = 0;
+    fast_strtoq ("1e5000", NULL);
+    if (errno != ERANGE) {
+      printf ("fast_strtoq: no ERANGE for 1e5000\n");
+    }
+#endif
+  }
+  {
+    static const char *const nums[] = {
+      "1.5", "-2e3", "+3.25e-2", ".5", "0.000123", "1e", "7e+", "nan",
+      "-inf", "infinity", "nan(0x1)", "1e400", "-1e-400", "0",
+      "12345678901234567890123456789012345678901234", "9007199254740993"
+    };
+    static const char *const sep[] = { " ", ",", "\n", " - ", "\tabc " };
+    unsigned int n = sizeof (nums) / sizeof (nums[0]);
+    double v[sizeof (nums) / sizeof (nums[0])];
+    double res[sizeof (nums) / sizeof (nums[0])];
+    struct fast_num_parser np;
+    struct num_list l;
+    char text[512];
+    size_t len;
+    size_t split;
+    size_t cnt;
+
+    text[0] = '\0';
+    for (i = 0; i < n; i++) {
+      v[i] = fast_strtod (nums[i], NULL);
+      strcat (text, nums[i]);
+      strcat (text, sep[i % 5]);
+    }
+    /* last number is completed by fast_num_parser_finish */
+    len = strlen (text) - strlen (sep[(n - 1) % 5]);
+    l.v = res;
+    l.max = n;
+    fast_num_parser_init (&np, num_list_add, &l);
+    for (split = 0; split <= len; split++) {
+      l.n = 0;
+      cnt = fast_num_parser_feed (&np, text, split);
+      cnt += fast_num_parser_feed (&np, text + split, len - split);
+      cnt += fast_num_parser_finish (&np);
+      if (cnt != n || l.n != n || memcmp (v, res, sizeof (v))) {
+	printf ("fast_num_parser: failed split %u\n", (unsigned int) split);
+      }
+    }
+    l.n = 0;
+    for (split = 0; split < len; split++) {
+      fast_num_parser_feed (&np, text + split, 1);
+    }
+    fast_num_parser_finish (&np);
+    if (l.n != n || memcmp (v, res, sizeof (v))) {
+      printf ("fast_num_parser: failed single bytes\n");
+    }
+  }
+  {
+    /* letters that do not complete inf or a nan payload start again */
+    static const char text[] =
+      "inan -infinan infinf nan(754 nan(12)5 nan(1e3_x) nan(1e3 x "
+      "nan(12345678901234567890123456789012345678901234";
+    size_t len = strlen (text);
+    double v[20];
+    double res[20];
+    unsigned int n = 0;
+    struct fast_num_parser np;
+    struct num_list l;
+    const char *cp = text;
+    char *endptr;
+    size_t split;
+    size_t cnt;
+
+    while (*cp) {
+      v[n] = fast_strtod (cp, &endptr);
+      if (endptr != cp) {
+	n++;
+	cp = endptr;
+      }
+      else {
+	cp++;
+      }
+    }
+    l.v = res;
+    l.max = n;
+    fast_num_parser_init (&np, num_list_add, &l);
+    for (split = 0; split <= len; split++) {
+      l.n = 0;
+      cnt = fast_num_parser_feed (&np, text, split);
+      cnt += fast_num_parser_feed (&np, text + split, len - split);
+      cnt += fast_num_parser_finish (&np);
+      if (cnt != n || l.n != n || memcmp (v, res, n * sizeof (v[0]))) {
+	printf ("fast_num_parser: failed letters split %u\n",
+		(unsigned int) split);
+      }
+    }
+    l.n = 0;
+    for (split = 0; split < len; split++) {
+      fast_num_parser_feed (&np, text + split, 1);
+    }
+    fast_num_parser_finish (&np);
+    if (l.n != n || memcmp (v, res, n * sizeof (v[0]))) {
+      printf ("fast_num_parser: failed letters single bytes\n");
+    }
+  }
+  {
+    static const struct
+    {
+      const char *str;
+      enum fast_number_kind kind;
+    } cls[] = {
+      {"123", FAST_NUMBER_INT},
+      {"  -42,", FAST_NUMBER_INT},
+      {"+0", FAST_NUMBER_INT},
+      {"1.5", FAST_NUMBER_FLOAT},
+      {".5e-3x", FAST_NUMBER_FLOAT},
+      {"1.", FAST_NUMBER_FLOAT},
+      {"7e", FAST_NUMBER_FLOAT},
+      {"0x1.8p3", FAST_NUMBER_HEX},
+      {"-0X.Ap", FAST_NUMBER_HEX},
+      {"0x", FAST_NUMBER_INT},
+      {"0xg", FAST_NUMBER_INT},
+      {"inf", FAST_NUMBER_INF},
+      {"-Infinity", FAST_NUMBER_INF},
+      {"infinit", FAST_NUMBER_INF},
+      {"nan", FAST_NUMBER_NAN},
+      {"NaN(abc_1)", FAST_NUMBER_NAN},
+      {"nan(abc", FAST_NUMBER_NAN},
+      {"", FAST_NUMBER_INVALID},
+      {"-", FAST_NUMBER_INVALID},
+      {".", FAST_NUMBER_INVALID},
+      {"in", FAST_NUMBER_INVALID},
+      {"abc", FAST_NUMBER_INVALID},
+      {"e5", FAST_NUMBER_INVALID}
+    };
+    enum fast_number_kind kind;
+    size_t len;
+    size_t k;
+    const char *str;
+
+    for (i = 0; i < sizeof (cls) / sizeof (cls[0]); i++) {
+      str = cls[i].str;
+      fast_strtod (str, &endptr);
+      fast_classify_number (str, str + strlen (str), &kind, &len);
+      if (kind != cls[i].kind || str + len != endptr) {
+	printf ("fast_classify_number: failed %s %d %u\n", str, kind,
+		(unsigned int) len);
+      }
+      /* a shorter end must not be passed */
+      for (k = 0; k < strlen (str); k++) {
+	memcpy (line, str, k);
+	line[k] = '\0';
+	fast_strtod (line, &endptr);
+	fast_classify_number (str, str + k, &kind, &len);
+	if (line + len != endptr) {
+	  printf ("fast_classify_number: failed %s end %u\n", str,
+		  (unsigned int) k);
+	}
+      }
+    }
+  }
+  {
+    static const struct
+    {
+      const char *col[6];
+      enum fast_column_type type;
+    } cols[] = {
+      {{"1", "-22", "", "+333", "123456789", NULL}, FAST_COLUMN_INT32},
+      {{"2147483647", "-2147483648", NULL}, FAST_COLUMN_INT32},
+      {{"1", "2147483648", "-5", NULL}, FAST_COLUMN_INT64},
+      {{"9223372036854775807", "-9223372036854775808", NULL},
+       FAST_COLUMN_INT64},
+      {{"21.3", "-0.5", "17", "1e10", "nan", NULL}, FAST_COLUMN_FLOAT},
+      {{"1.5", "16777216", "inf", "0x1.8p3", "3.40282347e38", NULL},
+       FAST_COLUMN_FLOAT},
+      {{"1.5", "16777217", NULL}, FAST_COLUMN_DOUBLE},
+      {{"0.1", "0.123456789", NULL}, FAST_COLUMN_DOUBLE},
+      {{"1", "9223372036854775808", NULL}, FAST_COLUMN_DOUBLE},
+      {{"1e39", "2", NULL}, FAST_COLUMN_DOUBLE},
+      {{"1", "2x", NULL}, FAST_COLUMN_STRING},
+      {{"1", "1e", "abc", NULL}, FAST_COLUMN_STRING},
+      {{"1.5", "1..5", NULL}, FAST_COLUMN_STRING},
+      {{"", "", NULL}, FAST_COLUMN_INT32},
+      {{"1", "1.00000000000000000000000000000000000000001", NULL},
+       FAST_COLUMN_DOUBLE},
+      {{"1.50000000000000000000000000000000000000000", "-0", NULL},
+       FAST_COLUMN_FLOAT}
+    };
+    char buf[256];
+    size_t offsets[7];
+    size_t k;
+    size_t pad;
+    enum fast_column_type type;
+
+    for (i = 0; i < sizeof (cols) / sizeof (cols[0]); i++) {
+      /* with and without room for 32 byte loads after the strings */
+      for (pad = 0; pad <= 32; pad += 32) {
+	offsets[0] = 0;
+	for (k = 0; cols[i].col[k]; k++) {
+	  strcpy (buf + offsets[k], cols[i].col[k]);
+	  offsets[k + 1] = offsets[k] + strlen (cols[i].col[k]);
+	}
+	memset (buf + offsets[k], '9', pad);
+	type = fast_infer_column_type (buf, offsets, k);
+	if (type != cols[i].type) {
+	  printf ("fast_infer_column_type: failed %u %d %d\n",
+		  (unsigned int) i, type, cols[i].type);
+	}
+      }
+    }
+  }
+  {
+    static const char text[] =
+      "took 5. x=-5 2019-10-19 v1.2.3 -.5e3 3eggs 1e+ 0x1Fp1 +7 "
+      "99999999999999999999 end 42";
+    static const struct
+    {
+      const char *str;
+      enum fast_number_kind kind;
+    } nums[] = {
+      {"5", FAST_NUMBER_INT},
+      {"-5", FAST_NUMBER_INT},
+      {"2019", FAST_NUMBER_INT},
+      {"10", FAST_NUMBER_INT},
+      {"19", FAST_NUMBER_INT},
+      {"1.2", FAST_NUMBER_FLOAT},
+      {"3", FAST_NUMBER_INT},
+      {"-.5e3", FAST_NUMBER_FLOAT},
+      {"3", FAST_NUMBER_INT},
+      {"1", FAST_NUMBER_INT},
+      {"0x1Fp1", FAST_NUMBER_HEX},
+      {"+7", FAST_NUMBER_INT},
+      {"99999999999999999999", FAST_NUMBER_FLOAT},
+      {"42", FAST_NUMBER_INT}
+    };
+    struct fast_scan_number found[20];
+    struct scan_list l;
+    size_t cnt;
+
+    l.num = found;
+    l.max = 20;
+    /* the last number ends at the end of the text */
+    l.n = 0;
+    cnt = fast_scan_numbers (text, strlen (text), scan_list_add, &l);
+    if (cnt != l.n || l.n != sizeof (nums) / sizeof (nums[0])) {
+      printf ("fast_scan_numbers: failed count %u\n", (unsigned int) l.n);
+    }
+    for (i = 0; i < l.n && i < sizeof (nums) / sizeof (nums[0]); i++) {
+      if (found[i].kind != nums[i].kind ||
+	  found[i].len != strlen (nums[i].str) ||
+	  memcmp (text + found[i].pos, nums[i].str, found[i].len) ||
+	  found[i].d != fast_strtod (nums[i].str, NULL) ||
+	  (found[i].kind == FAST_NUMBER_INT &&
+	   found[i].i != fast_strtos64 (nums[i].str, NULL, 10))) {
+	printf ("fast_scan_numbers: failed %s\n", nums[i].str);
+      }
+    }
+  }
+  {
+    static double dv[N / 16];
+    static double dv2[N / 16];
+    static char arena[N / 16 * FAST_DTOA_PARALLEL_SLOT];
+    static size_t offsets[N / 16];
+    static unsigned int len[N / 16];
+    struct fast_convert_pool *pool = fast_convert_pool_create (4);
+    unsigned int n = N / 16;
+    uint64_t x = 1;
+
+    for (i = 0; i < n; i++) {
+      x = x * RAND_IA + RAND_IC;
+      td.ul = x;
+      if (((td.ul >> 52) & 0x7FF) == 0x7FF) {
+	td.ul ^= UINT64_C (1) << 62;
+      }
+      dv[i] = td.d;
+      offsets[i] = (size_t) i * FAST_DTOA_PARALLEL_SLOT;
+    }
+    fast_dtoa_parallel (pool, dv, n, PREC_DBL_NR, arena, len);
+    fast_strtod_parallel (pool, arena, offsets, n, dv2, NULL);
+    for (i = 0; i < n; i++) {
+      if (fast_dtoa (dv[i], PREC_DBL_NR, line) != len[i] ||
+	  strcmp (line, arena + offsets[i]) || dv[i] != dv2[i]) {
+	printf ("fast_dtoa_parallel: failed %s %s\n", line,
+		arena + offsets[i]);
+	break;
+      }
+    }
+    fast_dtoa_parallel (NULL, dv, 3, 6, arena, NULL);
+    fast_dtoa (dv[1], 6, line);
+    fast_strtod_parallel (NULL, "12 -0x1p3", offsets, 1, dv2, len);
+    if (strcmp (arena + FAST_DTOA_PARALLEL_SLOT, line) ||
+	dv2[0] != 12.0 || len[0] != 2) {
+      printf ("fast_strtod_parallel: failed\n");
+    }
+    fast_convert_pool_destroy (pool);
+  }
+#ifdef FAST_CONVERT_STATS
+  {
+    struct fast_convert_stats stats;
+    pthread_t thread;
+
+    fast_convert_stats_reset ();
+    fast_dtoa (4.9406564584124654e-324, PREC_DBL_NR, line);
+    fast_ftoa (1.40129846e-45f, PREC_FLT_NR, line);
+    fast_dtoa (2.5, 1, line);
+    fast_dtoa (1e15, PREC_DBL_NR, line);
+    fast_dtoa (1e15, 6, line);
+    fast_strtod ("0x1p3", NULL);
+    fast_strtof ("inf", NULL);
+    fast_dtoa (fast_strtod ("nan", NULL), PREC_DBL_NR, line);
+    fast_strtod ("1234567890123456789012345678901234567890", NULL);
+    fast_strtou32 ("4294967297", NULL, 10);
+    pthread_create (&thread, NULL, stats_thread, NULL);
+    pthread_join (thread, NULL);
+    fast_convert_stats_get (&stats);
+    if (stats.subnormal != 2 || stats.round_half != 1 ||
+	stats.hex_float != 1 || stats.inf_nan != 3 ||
+	stats.truncated != 1 || stats.int_overflow != 2 ||
+	stats.integer != 1) {
+      printf ("fast_convert_stats: failed %" PRIu64 " %" PRIu64 " %" PRIu64
+	      " %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64 "\n",
+	      stats.subnormal, stats.round_half, stats.hex_float,
+	      stats.inf_nan, stats.truncated, stats.int_overflow,
+	      stats.integer);
+    }
+  }
+#endif
+  if (fast_convert_tables_size ()) {
+    void *tables = malloc (fast_convert_tables_size ());
+    char line2[100];
+    uint64_t x = 1;
+
+    fast_convert_tables_copy (tables);
+    for (i = 0; i < N / 16; i++) {
+      x = x * RAND_IA + RAND_IC;
+      td.ul = x;
+      tf.u = x >> 32;
+      fast_convert_tables_use (NULL);
+      fast_dtoa (td.d, PREC_DBL_NR, line);
+      fast_ftoa (tf.f, PREC_FLT_NR, line + 50);
+      rd.d = fast_strtod (line, NULL);
+      rf.f = fast_strtof (line + 50, NULL);
+      fast_convert_tables_use (tables);
+      fast_dtoa (td.d, PREC_DBL_NR, line2);
+      fast_ftoa (tf.f, PREC_FLT_NR, line2 + 50);
+      rd2.d = fast_strtod (line2, NULL);
+      rf2.f = fast_strtof (line2 + 50, NULL);
+      if (strcmp (line, line2) || strcmp (line + 50, line2 + 50) ||
+	  rd.ul != rd2.ul || rf.u != rf2.u) {
+	printf ("fast_convert_tables_use: failed %s %s\n", line, line2);
+	break;
+      }
+    }
+    /* num3 is the last table, corrupt its entry for 123 */
+    memcpy ((char *) tables + fast_convert_tables_size () - 3000 + 123 * 3,
+	    "xyz", 3);
+    fast_sint32 (123, line2);
+    if (strcmp (line2, "xyz")) {
+      printf ("fast_convert_tables_use: copy not used %s\n", line2);
+    }
+    fast_convert_tables_use (NULL);
+    fast_sint32 (123, line2);
+    if (strcmp (line2, "123")) {
+      printf ("fast_convert_tables_use: copy still used %s\n", line2);
+    }
+    free (tables);
+  }
   if (argc < 2 || strlen (argv[1]) == 0) {
     printf ("Usage: %s option\n", argv[0]);
     printf ("options:\n");
@@ -934,6 +2192,19 @@ main (int argc, char **argv)
     printf ("  c count differences float\n");
     printf ("  C count differences double\n");
     printf ("  i test interger functions\n");
+    printf ("  v verify all floats with all cores (optional thread count)\n");
+    printf ("  x test base conversion functions\n");
+    printf ("  h test all half float and bfloat16 values\n");
+    printf ("  l test long double convert\n");
+    printf ("  q test __float128 convert\n");
+    printf ("  m test double convert with cache pressure\n");
+    printf ("  r test fixed precision fast_dtoa_p6/p15 and fast_ftoa_p6\n");
+    printf ("  z test integer valued double convert\n");
+    printf ("  b test streaming fast_num_parser\n");
+    printf ("  a test parallel fast_dtoa/fast_strtod (optional thread count)\n");
+    printf ("  k test fast_classify_number\n");
+    printf ("  e test fast_infer_column_type\n");
+    printf ("  n test fast_scan_numbers\n");
     printf ("  if option after first one is 'n' then no check is done\n");
     exit (1);
   }
@@ -1272,6 +2543,633 @@ main (int argc, char **argv)
     }
     printf ("fast: %" PRIu64 ", libc: %" PRIu64 "\n", nf, nl);
   }
+  else if (argv[1][0] == 'v') {
+    c = verify_all (argc > 2 ? atoi (argv[2]) : 0);
+    end = get_time ();
+    printf ("%s: %.2f\n", argv[1], (end - start) / 1e9);
+    return c != 0;
+  }
+  else if (argv[1][0] == 'x') {
+    static const int xbase[] = { 2, 8, 10, 16, 36 };
+    uint64_t count = 10000000;
+    uint64_t rsave = r;
+
+    for (j = 0; j < sizeof (xbase) / sizeof (xbase[0]); j++) {
+      r = rsave;
+      start = get_time ();
+      for (i = 0; i < count; i++) {
+	r = r * RAND_IA + RAND_IC;
+	fast_base_uint64 (r >> (i & 63), line, xbase[j], 0);
+      }
+      end = get_time ();
+      printf ("fast_base_uint64(%2d): %12.9f\n", xbase[j],
+	      (end - start) / 1e9);
+    }
+    c = 0;
+    r = rsave;
+    start = get_time ();
+    for (i = 0; i < count; i++) {
+      r = r * RAND_IA + RAND_IC;
+      sprintf (line2, "%" PRIo64, r >> (i & 63));
+    }
+    end = get_time ();
+    printf ("sprintf(%%o):          %12.9f\n", (end - start) / 1e9);
+    r = rsave;
+    start = get_time ();
+    for (i = 0; i < count; i++) {
+      r = r * RAND_IA + RAND_IC;
+      sprintf (line2, "%" PRIx64, r >> (i & 63));
+    }
+    end = get_time ();
+    printf ("sprintf(%%x):          %12.9f\n", (end - start) / 1e9);
+    r = rsave;
+    for (i = 0; i < count; i++) {
+      r = r * RAND_IA + RAND_IC;
+      fast_base_uint64 (r >> (i & 63), line, 16, i & 1);
+      sprintf (line2, i & 1 ? "%" PRIX64 : "%" PRIx64, r >> (i & 63));
+      c += strcmp (line, line2) != 0;
+      fast_base_uint64 (r >> (i & 63), line, 8, 0);
+      sprintf (line2, "%" PRIo64, r >> (i & 63));
+      c += strcmp (line, line2) != 0;
+    }
+    if (c) {
+      printf ("fast_base_uint64: %" PRIu64 " differences\n", c);
+    }
+  }
+  else if (argv[1][0] == 'h') {
+    static const struct
+    {
+      const char *name;
+      int man;
+      int exp;
+      int prec;
+    } htst[] = {
+      {"half", 10, 5, PREC_HALF_NR},
+      {"bfloat16", 7, 8, PREC_BF16_NR}
+    };
+
+    char *cp;
+    int k;
+
+    c = 0;
+    for (j = 0; j < sizeof (htst) / sizeof (htst[0]); j++) {
+      for (i = 0; i < 65536; i++) {
+	double v = small_to_double ((uint32_t) i, htst[j].man, htst[j].exp);
+	uint32_t h;
+	int p;
+
+	len = j ? fast_bf16toa ((uint16_t) i, line)
+	  : fast_htoa ((uint16_t) i, line);
+	/* shortest correctly rounded string with sprintf/strtod */
+	for (p = 1; p < htst[j].prec; p++) {
+	  sprintf (line2, "%.*g", p, v);
+	  if (small_from_double (strtod (line2, NULL), htst[j].man,
+				 htst[j].exp) == i) {
+	    break;
+	  }
+	}
+	sprintf (line2, "%.*g", p, v);
+	h = j ? fast_strtobf16 (line, &endptr) : fast_strtoh (line, &endptr);
+	if (len != strlen (line) || strcmp (line, line2) || *endptr ||
+	    (h != i && !isnan (v))) {
+	  if (c++ < 10) {
+	    printf ("%s: 0x%04x %s %s 0x%04x\n", htst[j].name,
+		    (unsigned int) i, line, line2, h);
+	  }
+	}
+	/* parse halfway point to next value and just below and above it */
+	if (isnan (v) || isinf (v) || ((i + 1) & 0x7FFF) == 0 ||
+	    isinf (small_to_double ((uint32_t) i + 1, htst[j].man,
+				    htst[j].exp))) {
+	  continue;
+	}
+	sprintf (line, "%.150e", (v + small_to_double ((uint32_t) i + 1,
+						       htst[j].man,
+						       htst[j].exp)) / 2);
+	cp = strchr (line, 'e');
+	for (k = cp - line - 1; line[k] == '0' || line[k] == '.'; k--);
+	for (p = 0; p < 3; p++) {
+	  strcpy (line2, line);
+	  if (p) {
+	    /* last non zero digit minus 1 followed by 9's or plus 0..01 */
+	    line2[k] -= p == 1;
+	    sprintf (line2 + k + 1, "%s%s%s", line[k + 1] == '.' ? "." : "",
+		     p == 1 ? "9999999999" : "0000000001", cp);
+	  }
+	  h = j ? fast_strtobf16 (line2, NULL) : fast_strtoh (line2, NULL);
+	  if (h != (p == 0 ? (i + (i & 1)) : p == 1 ? i : i + 1)) {
+	    if (c++ < 10) {
+	      printf ("%s: 0x%04x %s 0x%04x\n", htst[j].name,
+		      (unsigned int) i, line2, h);
+	    }
+	  }
+	}
+      }
+    }
+    if (c) {
+      printf ("fast_htoa/fast_strtoh: %" PRIu64 " differences\n", c);
+    }
+  }
+  else if (argv[1][0] == 'l') {
+    static long double lv[N / 4];
+    uint64_t count = N / 4;
+    long double sum = 0;
+
+    for (i = 0; i < count; i++) {
+      r = r * RAND_IA + RAND_IC;
+      lv[i] = ldexpl ((long double) (r | UINT64_C (0x8000000000000000)),
+		      (int) ((r >> 16) % 32700) - 16350 - 63);
+      if (i & 1) {
+	lv[i] = -lv[i];
+      }
+    }
+    start = get_time ();
+    for (i = 0; i < count; i++) {
+      fast_ldtoa (lv[i], PREC_LDBL_NR, line);
+    }
+    end = get_time ();
+    printf ("fast_ldtoa:   %12.9f\n", (end - start) / 1e9);
+    start = get_time ();
+    for (i = 0; i < count; i++) {
+      sprintf (line, "%." PREC_LDBL "Lg", lv[i]);
+    }
+    end = get_time ();
+    printf ("sprintf:      %12.9f\n", (end - start) / 1e9);
+    for (i = 0; i < count; i++) {
+      sprintf (str[i], "%." PREC_LDBL "Lg", lv[i]);
+    }
+    start = get_time ();
+    for (i = 0; i < count; i++) {
+      sum += fast_strtold (str[i], NULL);
+    }
+    end = get_time ();
+    printf ("fast_strtold: %12.9f\n", (end - start) / 1e9);
+    start = get_time ();
+    for (i = 0; i < count; i++) {
+      sum += strtold (str[i], NULL);
+    }
+    end = get_time ();
+    printf ("strtold:      %12.9f %Lg\n", (end - start) / 1e9, sum);
+    c = 0;
+    for (i = 0; i < count; i++) {
+      /* exact digits above PREC_LDBL_NR can need a large bignum */
+      j = 1 + (unsigned int) (i % PREC_LDBL_NR) + ((i & 4095) ? 0 : 40);
+      fast_ldtoa (lv[i], j, line);
+      sprintf (line2, "%.*Lg", j, lv[i]);
+      c += strcmp (line, line2) != 0;
+      c += fast_strtold (str[i], NULL) != lv[i];
+      /* random digits and exponents */
+      r = r * RAND_IA + RAND_IC;
+      sprintf (line, "%" PRIu64 "%" PRIu64 "e%d", r, r >> (r & 63),
+	       (int) (r % 9960) - 4990);
+      c += fast_strtold (line, NULL) != strtold (line, NULL);
+    }
+    if (c) {
+      printf ("fast_ldtoa/fast_strtold: %" PRIu64 " differences\n", c);
+    }
+  }
+#ifdef TST_FLOAT128
+  else if (argv[1][0] == 'q') {
+    static __float128 qv[N / 4];
+    uint64_t count = N / 4;
+    __float128 sum = 0;
+    union
+    {
+      unsigned __int128 u;
+      __float128 q;
+    } tq, rq;
+
+    for (i = 0; i < count; i++) {
+      r = r * RAND_IA + RAND_IC;
+      tq.u = ((unsigned __int128) r << 64) | (r * RAND_IA);
+      /* random sign and mantissa, no inf/nan */
+      if ((tq.u >> 112 & 0x7FFF) == 0x7FFF) {
+	tq.u -= (unsigned __int128) 1 << 112;
+      }
+      qv[i] = tq.q;
+    }
+    start = get_time ();
+    for (i = 0; i < count; i++) {
+      fast_qtoa (qv[i], PREC_FLT128_NR, line);
+    }
+    end = get_time ();
+    printf ("fast_qtoa:         %12.9f\n", (end - start) / 1e9);
+    start = get_time ();
+    for (i = 0; i < count; i++) {
+      quadmath_snprintf (line, sizeof (line), "%." PREC_FLT128 "Qg", qv[i]);
+    }
+    end = get_time ();
+    printf ("quadmath_snprintf: %12.9f\n", (end - start) / 1e9);
+    for (i = 0; i < count; i++) {
+      quadmath_snprintf (str[i], sizeof (str[i]), "%." PREC_FLT128 "Qg",
+			 qv[i]);
+    }
+    start = get_time ();
+    for (i = 0; i < count; i++) {
+      sum += fast_strtoq (str[i], NULL);
+    }
+    end = get_time ();
+    printf ("fast_strtoq:       %12.9f\n", (end - start) / 1e9);
+    start = get_time ();
+    for (i = 0; i < count; i++) {
+      sum += strtoflt128 (str[i], NULL);
+    }
+    end = get_time ();
+    printf ("strtoflt128:       %12.9f %g\n", (end - start) / 1e9,
+	    (double) sum);
+    c = 0;
+    for (i = 0; i < count; i++) {
+      /* exact digits above PREC_FLT128_NR can need a large bignum */
+      j = 1 + (unsigned int) (i % PREC_FLT128_NR) + ((i & 4095) ? 0 : 40);
+      fast_qtoa (qv[i], j, line);
+      quadmath_snprintf (line2, sizeof (line2), "%.*Qg", j, qv[i]);
+      c += strcmp (line, line2) != 0;
+      tq.q = fast_strtoq (str[i], NULL);
+      rq.q = qv[i];
+      c += tq.u != rq.u;
+      /* random digits and exponents */
+      r = r * RAND_IA + RAND_IC;
+      sprintf (line, "%" PRIu64 "%" PRIu64 "%" PRIu64 "e%d", r,
+	       r >> (r & 63), r * RAND_IA, (int) (r % 10000) - 5000);
+      tq.q = fast_strtoq (line, NULL);
+      rq.q = strtoflt128 (line, NULL);
+      c += tq.u != rq.u;
+    }
+    if (c) {
+      printf ("fast_qtoa/fast_strtoq: %" PRIu64 " differences\n", c);
+    }
+  }
+#endif
+  else if (argv[1][0] == 'm') {
+    cache_bench (r);
+  }
+  else if (argv[1][0] == 'r') {
+    static double dv[N];
+    static float fv[N];
+    static const int prec[] = { 6, 15 };
+    unsigned int k;
+
+    for (i = 0; i < N; i++) {
+      do {
+	r = r * RAND_IA + RAND_IC;
+	td.ul = r;
+      } while (isnan (td.d) || isinf (td.d));
+      dv[i] = td.d;
+      do {
+	r = r * RAND_IA + RAND_IC;
+	tf.u = r >> 32;
+      } while (isnan (tf.f) || isinf (tf.f));
+      fv[i] = tf.f;
+    }
+    c = 0;
+    for (k = 0; k < 2; k++) {
+      start = get_time ();
+      for (i = 0; i < N; i++) {
+	fast_dtoa (dv[i], prec[k], line);
+      }
+      end = get_time ();
+      printf ("fast_dtoa (%2d):  %12.9f\n", prec[k], (end - start) / 1e9);
+      start = get_time ();
+      for (i = 0; i < N; i++) {
+	if (k) {
+	  fast_dtoa_p15 (dv[i], line);
+	}
+	else {
+	  fast_dtoa_p6 (dv[i], line);
+	}
+      }
+      end = get_time ();
+      printf ("fast_dtoa_p%d:%s   %12.9f\n", prec[k], k ? "" : " ",
+	      (end - start) / 1e9);
+      for (i = 0; i < N; i++) {
+	fast_dtoa (dv[i], prec[k], line);
+	if (k) {
+	  fast_dtoa_p15 (dv[i], line2);
+	}
+	else {
+	  fast_dtoa_p6 (dv[i], line2);
+	}
+	c += strcmp (line, line2) != 0;
+      }
+    }
+    start = get_time ();
+    for (i = 0; i < N; i++) {
+      fast_ftoa (fv[i], 6, line);
+    }
+    end = get_time ();
+    printf ("fast_ftoa (6):    %12.9f\n", (end - start) / 1e9);
+    start = get_time ();
+    for (i = 0; i < N; i++) {
+      fast_ftoa_p6 (fv[i], line);
+    }
+    end = get_time ();
+    printf ("fast_ftoa_p6:     %12.9f\n", (end - start) / 1e9);
+    for (i = 0; i < max; i += 97) {
+      tf.u = i;
+      fast_ftoa (tf.f, 6, line);
+      fast_ftoa_p6 (tf.f, line2);
+      c += strcmp (line, line2) != 0;
+    }
+    if (c) {
+      printf ("fast_dtoa_p6/p15/fast_ftoa_p6: %" PRIu64 " differences\n", c);
+    }
+  }
+  else if (argv[1][0] == 'z') {
+    static const double p10[16] = {
+      1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+      1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15
+    };
+    static double dv[N];
+    static double dv2[N];
+
+    /* counts, ids, timestamps and round numbers like 5e12 */
+    for (i = 0; i < N; i++) {
+      r = r * RAND_IA + RAND_IC;
+      switch (r & 3) {
+      case 0:
+	dv[i] = (double) (r >> 11);
+	break;
+      case 1:
+	dv[i] = (double) ((r >> 8) & 0xFFFF);
+	break;
+      case 2:
+	dv[i] = 1.7e12 + (double) (r >> 40);
+	break;
+      default:
+	dv[i] = (double) (r >> 54) * p10[(r >> 8) % 16];
+	break;
+      }
+      /* same digits scaled below 1, so no value takes the integer path */
+      dv2[i] = dv[i] * 1e-20;
+    }
+    start = get_time ();
+    for (i = 0; i < N; i++) {
+      fast_dtoa (dv[i], PREC_DBL_NR, line);
+    }
+    end = get_time ();
+    printf ("fast_dtoa: %12.9f\n", (end - start) / 1e9);
+    start = get_time ();
+    for (i = 0; i < N; i++) {
+      fast_dtoa (dv2[i], PREC_DBL_NR, line);
+    }
+    end = get_time ();
+    printf ("generic:   %12.9f\n", (end - start) / 1e9);
+    start = get_time ();
+    for (i = 0; i < N; i++) {
+      sprintf (line, "%." PREC_DBL "g", dv[i]);
+    }
+    end = get_time ();
+    printf ("sprintf:   %12.9f\n", (end - start) / 1e9);
+    c = 0;
+    for (i = 0; i < N; i++) {
+      fast_dtoa (dv[i], PREC_DBL_NR, line);
+      sprintf (line2, "%." PREC_DBL "g", dv[i]);
+      c += strcmp (line, line2) != 0;
+      fast_dtoa (dv[i], 6, line);
+      sprintf (line2, "%.6g", dv[i]);
+      c += strcmp (line, line2) != 0;
+    }
+    if (c) {
+      printf ("fast_dtoa: %" PRIu64 " differences\n", c);
+    }
+  }
+  else if (argv[1][0] == 'a') {
+    static double dv[N];
+    static double dv2[N];
+    static char arena[N * FAST_DTOA_PARALLEL_SLOT];
+    static char arena2[N * FAST_DTOA_PARALLEL_SLOT];
+    static size_t offsets[N];
+    struct fast_convert_pool *pool =
+      fast_convert_pool_create (argc > 2 ? atoi (argv[2]) : 0);
+
+    /* 1 of 8 values is a slow subnormal or hex string */
+    for (i = 0; i < N; i++) {
+      r = r * RAND_IA + RAND_IC;
+      td.ul = (r & 7) == 0 ? r >> 13 : r;
+      if (((td.ul >> 52) & 0x7FF) == 0x7FF) {
+	td.ul ^= UINT64_C (1) << 62;
+      }
+      dv[i] = td.d;
+      offsets[i] = i * FAST_DTOA_PARALLEL_SLOT;
+    }
+    start = get_time ();
+    fast_dtoa_parallel (NULL, dv, N, PREC_DBL_NR, arena, NULL);
+    end = get_time ();
+    printf ("fast_dtoa:            %12.9f\n", (end - start) / 1e9);
+    start = get_time ();
+    fast_dtoa_parallel (pool, dv, N, PREC_DBL_NR, arena2, NULL);
+    end = get_time ();
+    printf ("fast_dtoa_parallel:   %12.9f\n", (end - start) / 1e9);
+    for (i = 0; i < N; i += 8) {
+      sprintf (&arena[i * FAST_DTOA_PARALLEL_SLOT], "%a", dv[i]);
+    }
+    start = get_time ();
+    fast_strtod_parallel (NULL, arena, offsets, N, dv, NULL);
+    end = get_time ();
+    printf ("fast_strtod:          %12.9f\n", (end - start) / 1e9);
+    start = get_time ();
+    fast_strtod_parallel (pool, arena, offsets, N, dv2, NULL);
+    end = get_time ();
+    printf ("fast_strtod_parallel: %12.9f\n", (end - start) / 1e9);
+    c = 0;
+    for (i = 0; i < N; i++) {
+      c += memcmp (&dv[i], &dv2[i], sizeof (double)) != 0 ||
+	(i & 7 && strcmp (&arena[i * FAST_DTOA_PARALLEL_SLOT],
+			  &arena2[i * FAST_DTOA_PARALLEL_SLOT]));
+    }
+    if (c) {
+      printf ("fast_dtoa_parallel/fast_strtod_parallel: %" PRIu64
+	      " differences\n", c);
+    }
+    fast_convert_pool_destroy (pool);
+  }
+  else if (argv[1][0] == 'b') {
+    static char text[N * 26];
+    static double dv[N];
+    static double dv2[N];
+    struct fast_num_parser np;
+    struct num_list l;
+    char *cp = text;
+    char *endptr;
+    size_t len;
+    size_t pos;
+    size_t chunk;
+
+    for (i = 0; i < N; i++) {
+      r = r * RAND_IA + RAND_IC;
+      td.ul = r;
+      if (((td.ul >> 52) & 0x7FF) == 0x7FF) {
+	td.ul ^= UINT64_C (1) << 62;
+      }
+      cp += fast_dtoa (td.d, PREC_DBL_NR, cp);
+      *cp++ = (i & 7) == 7 ? '\n' : ',';
+    }
+    len = cp - text;
+    start = get_time ();
+    cp = text;
+    for (i = 0; i < N; i++) {
+      dv[i] = fast_strtod (cp, &endptr);
+      cp = endptr + 1;
+    }
+    end = get_time ();
+    printf ("fast_strtod:     %12.9f\n", (end - start) / 1e9);
+    /* input arrives in 64 KB chunks, numbers are split at the ends */
+    l.v = dv2;
+    l.n = 0;
+    l.max = N;
+    fast_num_parser_init (&np, num_list_add, &l);
+    start = get_time ();
+    for (pos = 0; pos < len; pos += chunk) {
+      chunk = len - pos < 65536 ? len - pos : 65536;
+      fast_num_parser_feed (&np, text + pos, chunk);
+    }
+    fast_num_parser_finish (&np);
+    end = get_time ();
+    printf ("fast_num_parser: %12.9f\n", (end - start) / 1e9);
+    if (l.n != N || memcmp (dv, dv2, sizeof (dv))) {
+      printf ("fast_num_parser: %" PRIu64 " values differ\n", (uint64_t) l.n);
+    }
+  }
+  else if (argv[1][0] == 'k') {
+    static char text[N * 26];
+    static size_t lens[N];
+    enum fast_number_kind kind;
+    char *cp = text;
+    char *last;
+    size_t len;
+    uint64_t kinds[FAST_NUMBER_NAN + 1] = { 0 };
+
+    for (i = 0; i < N; i++) {
+      r = r * RAND_IA + RAND_IC;
+      td.ul = r;
+      /* mix of ints and doubles */
+      if (i & 1) {
+	cp += fast_sint64 ((int64_t) r >> (r & 63), cp);
+      }
+      else {
+	cp += fast_dtoa (td.d, PREC_DBL_NR, cp);
+      }
+      *cp++ = (i & 7) == 7 ? '\n' : ',';
+    }
+    last = cp;
+    start = get_time ();
+    cp = text;
+    for (i = 0; i < N; i++) {
+      fast_strtod (cp, &endptr);
+      lens[i] = endptr - cp;
+      cp = endptr + 1;
+    }
+    end = get_time ();
+    printf ("fast_strtod:          %12.9f\n", (end - start) / 1e9);
+    start = get_time ();
+    cp = text;
+    c = 0;
+    for (i = 0; i < N; i++) {
+      fast_classify_number (cp, last, &kind, &len);
+      kinds[kind]++;
+      c += len != lens[i];
+      cp += len + 1;
+    }
+    end = get_time ();
+    printf ("fast_classify_number: %12.9f\n", (end - start) / 1e9);
+    printf ("int %" PRIu64 ", float %" PRIu64 ", inf %" PRIu64 ", nan %"
+	    PRIu64 ", invalid %" PRIu64 ", length differs %" PRIu64 "\n",
+	    kinds[FAST_NUMBER_INT], kinds[FAST_NUMBER_FLOAT],
+	    kinds[FAST_NUMBER_INF], kinds[FAST_NUMBER_NAN],
+	    kinds[FAST_NUMBER_INVALID], c);
+  }
+  else if (argv[1][0] == 'e') {
+    static char text[N * 26];
+    static size_t offsets[N + 1];
+    static const char *const names[] = {
+      "int32", "int64", "float", "double", "string"
+    };
+    enum fast_column_type type;
+    char *cp;
+
+    for (j = 0; j < 4; j++) {
+      cp = text;
+      for (i = 0; i < N; i++) {
+	offsets[i] = cp - text;
+	r = r * RAND_IA + RAND_IC;
+	switch (j) {
+	case 0:
+	  cp += fast_sint32 ((int32_t) (r >> 32) >> (r & 31), cp);
+	  break;
+	case 1:
+	  cp += fast_sint64 ((int64_t) r >> (r & 31), cp);
+	  break;
+	case 2:
+	  /* sensor value with one decimal */
+	  cp += fast_dtoa ((double) ((int) (r >> 48) - 32768) / 10, 6, cp);
+	  break;
+	default:
+	  td.ul = r >> 2;
+	  cp += fast_dtoa (td.d, PREC_DBL_NR, cp);
+	  break;
+	}
+      }
+      offsets[N] = cp - text;
+      start = get_time ();
+      type = fast_infer_column_type (text, offsets, N);
+      end = get_time ();
+      printf ("%-6s %-6s %12.9f %.2f GB/s\n", names[j], names[type],
+	      (end - start) / 1e9, offsets[N] / (end - start));
+    }
+  }
+  else if (argv[1][0] == 'n') {
+    static char text[N * 64];
+    static struct fast_scan_number found[N * 4];
+    static double dv[N * 4];
+    struct scan_list l;
+    char *cp = text;
+    size_t n = 0;
+
+    /* log lines with a time stamp, an int and a double */
+    for (i = 0; i < N; i++) {
+      r = r * RAND_IA + RAND_IC;
+      td.ul = r;
+      td.d = (double) (r >> 40) / 1000;
+      cp += sprintf (cp, "[%02u:%02u] request id=", (unsigned int) (i % 24),
+		     (unsigned int) (i % 60));
+      cp += fast_sint64 ((int64_t) (r & 0xFFFFFF), cp);
+      cp += sprintf (cp, " took ");
+      cp += fast_dtoa (td.d, 6, cp);
+      cp += sprintf (cp, " ms\n");
+    }
+    len = cp - text;
+    /* fast_strtod at every position that can start a number */
+    start = get_time ();
+    for (cp = text; cp < text + len;) {
+      double v = fast_strtod (cp, &endptr);
+
+      if (endptr != cp) {
+	dv[n++] = v;
+	cp = endptr;
+      }
+      else {
+	cp++;
+      }
+    }
+    end = get_time ();
+    printf ("fast_strtod:       %12.9f %" PRIu64 " numbers\n",
+	    (end - start) / 1e9, (uint64_t) n);
+    l.num = found;
+    l.n = 0;
+    l.max = N * 4;
+    start = get_time ();
+    fast_scan_numbers (text, len, scan_list_add, &l);
+    end = get_time ();
+    printf ("fast_scan_numbers: %12.9f %" PRIu64 " numbers\n",
+	    (end - start) / 1e9, (uint64_t) l.n);
+    for (i = 0; i < n && i < l.n; i++) {
+      if (found[i].d != dv[i]) {
+	printf ("fast_scan_numbers: failed at %" PRIu64 " %.17g %.17g\n",
+		(uint64_t) found[i].pos, found[i].d, dv[i]);
+	break;
+      }
+    }
+  }
   else if (argv[1][0] == 'c') {
     c = 0;
     for (i = 0; i <= max; i++) {